@@ -14,6 +14,8 @@
 
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
 #include <geos/triangulate/VoronoiDiagramBuilder.h>
+#include <geos/triangulate/quadedge/JumpAndWalkQuadEdgeLocator.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
 #include <geos/geom/CoordinateArraySequence.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/profiler.h>
@@ -41,9 +43,14 @@ public:
 
         voronoi(seq);
         voronoi(*geom);
+        voronoi(seq, true);
 
         delaunay(seq);
         delaunay(*geom);
+        delaunay(seq, true);
+
+        walk(seq, false);
+        walk(seq, true);
 
         std::cout << std::endl;
     }
@@ -52,12 +59,13 @@ private:
     geos::util::Profiler* profiler = geos::util::Profiler::instance();
 
     template<typename T>
-    void voronoi(const T & sites) {
-        auto sw = profiler->get(std::string("Voronoi from ") + typeid(T).name());
+    void voronoi(const T & sites, bool isHilbertOrder = false) {
+        auto sw = profiler->get(std::string("Voronoi from ") + typeid(T).name() + (isHilbertOrder ? " (Hilbert)" : ""));
         sw->start();
 
         geos::triangulate::VoronoiDiagramBuilder vdb;
         vdb.setSites(sites);
+        vdb.setHilbertOrder(isHilbertOrder);
 
         auto result = vdb.getDiagram(*gfact);
 
@@ -66,18 +74,39 @@ private:
     }
 
     template<typename T>
-    void delaunay(const T & seq) {
-        auto sw = profiler->get(std::string("Delaunay from ") + typeid(T).name());
+    void delaunay(const T & seq, bool isHilbertOrder = false) {
+        auto sw = profiler->get(std::string("Delaunay from ") + typeid(T).name() + (isHilbertOrder ? " (Hilbert)" : ""));
         sw->start();
 
         geos::triangulate::DelaunayTriangulationBuilder dtb;
         dtb.setSites(seq);
+        dtb.setHilbertOrder(isHilbertOrder);
 
         auto result = dtb.getTriangles(*gfact);
 
         sw->stop();
         std::cout << sw->name << ": " << result->getNumGeometries() << ": " << *sw << std::endl;
     }
+
+    void walk(const geos::geom::CoordinateSequence& seq, bool isHilbertOrder) {
+        using geos::triangulate::DelaunayTriangulationBuilder;
+        using geos::triangulate::IncrementalDelaunayTriangulator;
+        using namespace geos::triangulate::quadedge;
+
+        auto sites = DelaunayTriangulationBuilder::unique(&seq);
+        auto vertices = DelaunayTriangulationBuilder::toVertices(*sites);
+        DelaunayTriangulationBuilder::sortVertices(vertices, isHilbertOrder);
+
+        geos::geom::Envelope env = sites->getEnvelope();
+        QuadEdgeSubdivision subdiv(env, 0.0);
+        auto locator = new JumpAndWalkQuadEdgeLocator(&subdiv, env, vertices.size());
+        subdiv.setLocator(std::unique_ptr<QuadEdgeLocator>(locator));
+        IncrementalDelaunayTriangulator(&subdiv).insertSites(vertices);
+
+        std::cout << "Locate steps per site" << (isHilbertOrder ? " (Hilbert)" : "") << ": "
+                  << static_cast<double>(locator->getStepCount()) / static_cast<double>(locator->getLocateCount())
+                  << ", restarts: " << locator->getRestartCount() << std::endl;
+    }
 };
 
 int main() {
@@ -47,5 +47,25 @@ static void BM_IndexedPointInAreaLocator(benchmark::State& state) {
 
 BENCHMARK(BM_IndexedPointInAreaLocator);
 
+static void BM_IndexedPointInAreaLocatorGrid(benchmark::State& state) {
+    auto gfact = GeometryFactory::getDefaultInstance();
+    SineStarFactory ssf(gfact);
+    auto poly = ssf.createSineStar();
+    auto geom = Densifier::densify(poly.get(), 1);
+
+    std::default_random_engine e(12345);
+    std::uniform_real_distribution<> xdist(poly->getEnvelopeInternal()->getMinX(), poly->getEnvelopeInternal()->getMaxX());
+    std::uniform_real_distribution<> ydist(poly->getEnvelopeInternal()->getMinY(), poly->getEnvelopeInternal()->getMaxY());
+
+    IndexedPointInAreaLocator ipa(*geom, static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        Coordinate c(xdist(e), ydist(e));
+        ipa.locate(&c);
+    }
+}
+
+BENCHMARK(BM_IndexedPointInAreaLocatorGrid)->Arg(0)->Arg(64)->Arg(256);
+
 BENCHMARK_MAIN();
 
@@ -475,6 +475,13 @@ extern "C" {
         return GEOSLargestEmptyCircle_r(handle, g, boundary, tolerance);
     }
 
+    int
+    GEOSMaximumInscribedCircle_batch(const Geometry* const* geoms, size_t ngeoms, double tolerance,
+                                     double* centers, double* radii, int nthreads)
+    {
+        return GEOSMaximumInscribedCircle_batch_r(handle, geoms, ngeoms, tolerance, centers, radii, nthreads);
+    }
+
     Geometry*
     GEOSMinimumWidth(const Geometry* g)
     {
@@ -578,6 +585,23 @@ extern "C" {
         return GEOSClipByRect_r(handle, g, xmin, ymin, xmax, ymax);
     }
 
+    int
+    GEOSClipByGrid(const Geometry* g, double xorigin, double yorigin, double cellWidth, double cellHeight,
+                   double buffer, GEOSGridClipCallback callback, void* userdata)
+    {
+        return GEOSClipByGrid_r(handle, g, xorigin, yorigin, cellWidth, cellHeight, buffer, callback, userdata);
+    }
+
+    int
+    GEOSEncodeTile(const Geometry* g, double xmin, double ymin, double xmax, double ymax,
+                   unsigned int extent, unsigned int buffer, double tolerance,
+                   int* type, int** coords, unsigned int* ncoords,
+                   unsigned int** parts, unsigned int* nparts)
+    {
+        return GEOSEncodeTile_r(handle, g, xmin, ymin, xmax, ymax, extent, buffer, tolerance,
+                                type, coords, ncoords, parts, nparts);
+    }
+
 
 
 //-------------------------------------------------------------------
@@ -1128,6 +1152,12 @@ extern "C" {
         return GEOSTopologyPreserveSimplify_r(handle, g, tolerance);
     }
 
+    Geometry*
+    GEOSSimplifyVW(const Geometry* g, double tolerance, int preserveTopology)
+    {
+        return GEOSSimplifyVW_r(handle, g, tolerance, preserveTopology);
+    }
+
 
     /* WKT Reader */
     WKTReader*
@@ -1377,6 +1407,18 @@ extern "C" {
         return GEOSPreparedDistance_r(handle, g1, g2, dist);
     }
 
+    Geometry*
+    GEOSPreparedIntersection(const geos::geom::prep::PreparedGeometry* g1, const Geometry* g2)
+    {
+        return GEOSPreparedIntersection_r(handle, g1, g2);
+    }
+
+    Geometry*
+    GEOSPreparedDifference(const geos::geom::prep::PreparedGeometry* g1, const Geometry* g2)
+    {
+        return GEOSPreparedDifference_r(handle, g1, g2);
+    }
+
     GEOSSTRtree*
     GEOSSTRtree_create(std::size_t nodeCapacity)
     {
@@ -1416,6 +1458,39 @@ extern "C" {
         return GEOSSTRtree_nearest_generic_r(handle, tree, item, itemEnvelope, distancefn, userdata);
     }
 
+    int
+    GEOSSTRtree_nearest_k(GEOSSTRtree* tree,
+                          const geos::geom::Geometry* const* geoms,
+                          size_t ngeoms,
+                          size_t k,
+                          double maxDistance,
+                          const geos::geom::Geometry** results,
+                          double* distances,
+                          size_t* numResults)
+    {
+        return GEOSSTRtree_nearest_k_r(handle, tree, geoms, ngeoms, k, maxDistance,
+                                       results, distances, numResults);
+    }
+
+    int
+    GEOSSTRtree_join(GEOSSTRtree* tree1,
+                     GEOSSTRtree* tree2,
+                     GEOSJoinCallback callback,
+                     void* userdata)
+    {
+        return GEOSSTRtree_join_r(handle, tree1, tree2, callback, userdata);
+    }
+
+    int
+    GEOSSTRtree_joinWithinDistance(GEOSSTRtree* tree1,
+                                   GEOSSTRtree* tree2,
+                                   double distance,
+                                   GEOSJoinCallback callback,
+                                   void* userdata)
+    {
+        return GEOSSTRtree_joinWithinDistance_r(handle, tree1, tree2, distance, callback, userdata);
+    }
+
     void
     GEOSSTRtree_iterate(GEOSSTRtree* tree,
                         GEOSQueryCallback callback,
@@ -1496,6 +1571,66 @@ extern "C" {
         return GEOSGeom_createEmptyPolygon_r(handle);
     }
 
+    int
+    GEOSArea_batch(const Geometry* const* geoms, size_t ngeoms, double* out, int nthreads)
+    {
+        return GEOSArea_batch_r(handle, geoms, ngeoms, out, nthreads);
+    }
+
+    int
+    GEOSLength_batch(const Geometry* const* geoms, size_t ngeoms, double* out, int nthreads)
+    {
+        return GEOSLength_batch_r(handle, geoms, ngeoms, out, nthreads);
+    }
+
+    int
+    GEOSisEmpty_batch(const Geometry* const* geoms, size_t ngeoms, char* out, int nthreads)
+    {
+        return GEOSisEmpty_batch_r(handle, geoms, ngeoms, out, nthreads);
+    }
+
+    int
+    GEOSisSimple_batch(const Geometry* const* geoms, size_t ngeoms, char* out, int nthreads)
+    {
+        return GEOSisSimple_batch_r(handle, geoms, ngeoms, out, nthreads);
+    }
+
+    int
+    GEOSisValid_batch(const Geometry* const* geoms, size_t ngeoms, char* out, int nthreads)
+    {
+        return GEOSisValid_batch_r(handle, geoms, ngeoms, out, nthreads);
+    }
+
+    int
+    GEOSEnvelope_batch(const Geometry* const* geoms, size_t ngeoms, Geometry** out, int nthreads)
+    {
+        return GEOSEnvelope_batch_r(handle, geoms, ngeoms, out, nthreads);
+    }
+
+    int
+    GEOSGetCentroid_batch(const Geometry* const* geoms, size_t ngeoms, Geometry** out, int nthreads)
+    {
+        return GEOSGetCentroid_batch_r(handle, geoms, ngeoms, out, nthreads);
+    }
+
+    int
+    GEOSPointOnSurface_batch(const Geometry* const* geoms, size_t ngeoms, Geometry** out, int nthreads)
+    {
+        return GEOSPointOnSurface_batch_r(handle, geoms, ngeoms, out, nthreads);
+    }
+
+    int
+    GEOSHilbertSort(Geometry** geoms, size_t ngeoms, const double* extent, size_t* order, int nthreads)
+    {
+        return GEOSHilbertSort_r(handle, geoms, ngeoms, extent, order, nthreads);
+    }
+
+    int
+    GEOSHilbertSortCoords(double* x, double* y, size_t n, const double* extent, size_t* order, int nthreads)
+    {
+        return GEOSHilbertSortCoords_r(handle, x, y, n, extent, order, nthreads);
+    }
+
     int
     GEOSOrientationIndex(double Ax, double Ay, double Bx, double By,
                          double Px, double Py)
@@ -1569,6 +1704,18 @@ extern "C" {
         return GEOSDelaunayTriangulation_r(handle, g, tolerance, onlyEdges);
     }
 
+    Geometry*
+    GEOSConstrainedDelaunayTriangulation(const Geometry* g, int onlyEdges)
+    {
+        return GEOSConstrainedDelaunayTriangulation_r(handle, g, onlyEdges);
+    }
+
+    Geometry*
+    GEOSPolygonTriangulation(const Geometry* g)
+    {
+        return GEOSPolygonTriangulation_r(handle, g);
+    }
+
     Geometry*
     GEOSVoronoiDiagram(const Geometry* g, const Geometry* env, double tolerance, int onlyEdges)
     {
@@ -21,7 +21,9 @@
 #include <geos/geom/Geometry.h>
 #include <geos/geom/prep/PreparedGeometry.h>
 #include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/prep/PreparedGeometryCache.h>
 #include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryComponentFilter.h>
 #include <geos/geom/Polygon.h>
 #include <geos/geom/Point.h>
 #include <geos/geom/MultiPoint.h>
@@ -46,6 +48,7 @@
 #include <geos/io/WKTWriter.h>
 #include <geos/io/WKBWriter.h>
 #include <geos/algorithm/BoundaryNodeRule.h>
+#include <geos/algorithm/ConvexHull.h>
 #include <geos/algorithm/MinimumBoundingCircle.h>
 #include <geos/algorithm/MinimumDiameter.h>
 #include <geos/algorithm/Orientation.h>
@@ -55,6 +58,7 @@
 #include <geos/algorithm/distance/DiscreteFrechetDistance.h>
 #include <geos/simplify/DouglasPeuckerSimplifier.h>
 #include <geos/simplify/TopologyPreservingSimplifier.h>
+#include <geos/simplify/VWSimplifier.h>
 #include <geos/noding/GeometryNoder.h>
 #include <geos/noding/Noder.h>
 #include <geos/operation/buffer/BufferBuilder.h>
@@ -68,9 +72,12 @@
 #include <geos/operation/overlayng/PrecisionReducer.h>
 #include <geos/operation/overlayng/OverlayNG.h>
 #include <geos/operation/overlayng/OverlayNGRobust.h>
+#include <geos/operation/overlayng/PreparedOverlay.h>
 #include <geos/operation/overlayng/UnaryUnionNG.h>
 #include <geos/operation/intersection/Rectangle.h>
 #include <geos/operation/intersection/RectangleIntersection.h>
+#include <geos/operation/intersection/RectangleGridIntersection.h>
+#include <geos/operation/intersection/TileEncoder.h>
 #include <geos/operation/polygonize/Polygonizer.h>
 #include <geos/operation/polygonize/BuildArea.h>
 #include <geos/operation/relate/RelateOp.h>
@@ -80,14 +87,19 @@
 #include <geos/operation/valid/IsValidOp.h>
 #include <geos/operation/valid/MakeValid.h>
 #include <geos/precision/GeometryPrecisionReducer.h>
+#include <geos/shape/fractal/CurveSort.h>
 #include <geos/linearref/LengthIndexedLine.h>
+#include <geos/triangulate/ConstrainedDelaunayTriangulationBuilder.h>
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
 #include <geos/triangulate/VoronoiDiagramBuilder.h>
+#include <geos/triangulate/polygon/PolygonTriangulator.h>
 #include <geos/util.h>
+#include <geos/util/Executor.h>
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/util/Interrupt.h>
 #include <geos/util/UniqueCoordinateArrayFilter.h>
 #include <geos/util/Machine.h>
+#include <geos/util/Stats.h>
 #include <geos/version.h>
 
 // This should go away
@@ -102,6 +114,11 @@
 #include <sstream>
 #include <string>
 #include <memory>
+#include <new>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4099)
@@ -188,6 +205,9 @@ typedef struct GEOSContextHandle_HS {
     uint8_t WKBOutputDims;
     int WKBByteOrder;
     int initialized;
+    std::shared_ptr<geos::util::Executor> executor;
+    std::size_t grainSize;
+    std::shared_ptr<geos::geom::prep::PreparedGeometryCache> preparedCache;
 
     GEOSContextHandle_HS()
         :
@@ -197,7 +217,8 @@ typedef struct GEOSContextHandle_HS {
         noticeData(nullptr),
         errorMessageOld(nullptr),
         errorMessageNew(nullptr),
-        errorData(nullptr)
+        errorData(nullptr),
+        grainSize(1024)
     {
         memset(msgBuffer, 0, sizeof(msgBuffer));
         geomFactory = GeometryFactory::getDefaultInstance();
@@ -422,6 +443,81 @@ inline void execute(GEOSContextHandle_t extHandle, F&& f) {
     }
 }
 
+// Compute the lazily cached envelopes and coordinate dimensions of a
+// geometry and its components, so that threads only read them.
+class CachePrimingFilter : public geos::geom::GeometryComponentFilter {
+public:
+    void filter_ro(const Geometry* g) override
+    {
+        g->getEnvelopeInternal();
+        g->getCoordinateDimension();
+    }
+};
+
+// Process the items [0, ngeoms) of a geometry array in ranges, using the
+// given context handle to process errors, and its threads if it has any.
+// Return 1 on success, 0 on error.
+template<typename F>
+inline int executeBatchRanges(GEOSContextHandle_t extHandle,
+                              const Geometry* const* geoms, std::size_t ngeoms,
+                              int nthreads, F&& processRange) {
+    return execute(extHandle, 0, [&]() {
+        GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if (handle->executor && nthreads != 1) {
+            // a geometry may appear more than once in the array
+            CachePrimingFilter filter;
+            for (std::size_t i = 0; i < ngeoms; i++) {
+                if (geoms[i]) {
+                    geoms[i]->apply_ro(&filter);
+                }
+            }
+            std::size_t maxThreads = nthreads > 1 ? static_cast<std::size_t>(nthreads) : 0;
+            handle->executor->parallelFor(ngeoms, handle->grainSize, processRange, maxThreads);
+        } else {
+            processRange(0, ngeoms);
+        }
+        return 1;
+    });
+}
+
+// Apply a function to each geometry of an array, using the given context
+// handle to process errors, and its threads if it has any.
+// NULL geometries give nullval.
+// Return 1 on success, 0 on error.
+template<typename T, typename F>
+inline int executeBatch(GEOSContextHandle_t extHandle,
+                        const Geometry* const* geoms, std::size_t ngeoms,
+                        T* out, T nullval, int nthreads, F&& f) {
+    return executeBatchRanges(extHandle, geoms, ngeoms, nthreads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            out[i] = geoms[i] ? f(geoms[i]) : nullval;
+        }
+    });
+}
+
+// Apply a function returning a new geometry to each geometry of an array.
+// On error the geometries already created are destroyed,
+// leaving the output filled with nullptr.
+template<typename F>
+inline int executeBatchGeometries(GEOSContextHandle_t extHandle,
+                                  const Geometry* const* geoms, std::size_t ngeoms,
+                                  Geometry** out, int nthreads, F&& f) {
+    std::fill(out, out + ngeoms, nullptr);
+    int ret = executeBatch(extHandle, geoms, ngeoms, out, static_cast<Geometry*>(nullptr), nthreads,
+                           [&](const Geometry* g) -> Geometry* {
+        std::unique_ptr<Geometry> result = f(g);
+        result->setSRID(g->getSRID());
+        return result.release();
+    });
+    if (ret == 0) {
+        for (std::size_t i = 0; i < ngeoms; i++) {
+            delete out[i];
+            out[i] = nullptr;
+        }
+    }
+    return ret;
+}
+
 extern "C" {
 
     GEOSContextHandle_t
@@ -491,6 +587,119 @@ extern "C" {
         return handle->setErrorHandler(ef, userData);
     }
 
+    int
+    GEOSContext_setThreads_r(GEOSContextHandle_t extHandle, int nthreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            if (nthreads < 0) {
+                throw IllegalArgumentException("Number of threads must not be negative");
+            }
+
+            std::size_t numThreads = nthreads > 0 ? static_cast<std::size_t>(nthreads)
+                                                  : geos::util::Executor::getHardwareConcurrency();
+            if (numThreads == 1) {
+                handle->executor.reset();
+            } else {
+                handle->executor = std::make_shared<geos::util::Executor>(numThreads);
+            }
+            return static_cast<int>(numThreads);
+        });
+    }
+
+    int
+    GEOSContext_shareThreads_r(GEOSContextHandle_t extHandle, GEOSContextHandle_t source)
+    {
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            GEOSContextHandleInternal_t* sourceHandle = reinterpret_cast<GEOSContextHandleInternal_t*>(source);
+            if (sourceHandle == nullptr || !sourceHandle->initialized) {
+                throw IllegalArgumentException("Invalid source context");
+            }
+
+            handle->executor = sourceHandle->executor;
+            return 1;
+        });
+    }
+
+    size_t
+    GEOSContext_setGrainSize_r(GEOSContextHandle_t extHandle, size_t grainSize)
+    {
+        GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return 0;
+        }
+
+        std::size_t previous = handle->grainSize;
+        handle->grainSize = std::max<std::size_t>(grainSize, 1);
+        return previous;
+    }
+
+    int
+    GEOSContext_setPreparedCache_r(GEOSContextHandle_t extHandle, size_t maxEntries, size_t minPoints)
+    {
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            if (maxEntries == 0) {
+                handle->preparedCache.reset();
+            } else {
+                handle->preparedCache = std::make_shared<geos::geom::prep::PreparedGeometryCache>(maxEntries, minPoints);
+            }
+            return 1;
+        });
+    }
+
+    int
+    GEOSContext_sharePreparedCache_r(GEOSContextHandle_t extHandle, GEOSContextHandle_t source)
+    {
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            GEOSContextHandleInternal_t* sourceHandle = reinterpret_cast<GEOSContextHandleInternal_t*>(source);
+            if (sourceHandle == nullptr || !sourceHandle->initialized) {
+                throw IllegalArgumentException("Invalid source context");
+            }
+
+            handle->preparedCache = sourceHandle->preparedCache;
+            return 1;
+        });
+    }
+
+    int
+    GEOSContext_setStatsEnabled_r(GEOSContextHandle_t extHandle, int enabled)
+    {
+        return execute(extHandle, -1, [&]() {
+            return geos::util::Stats::setEnabled(enabled != 0) ? 1 : 0;
+        });
+    }
+
+    int
+    GEOSContext_getStats_r(GEOSContextHandle_t extHandle, size_t* counts, double* seconds, int size)
+    {
+        using geos::util::Stats;
+
+        return execute(extHandle, 0, [&]() {
+            Stats::Snapshot snapshot = Stats::getSnapshot();
+            int n = std::min(size, static_cast<int>(Stats::NUM_STAGES));
+            for (int i = 0; i < n; i++) {
+                if (counts != nullptr) {
+                    counts[i] = static_cast<size_t>(snapshot.counts[i]);
+                }
+                if (seconds != nullptr) {
+                    seconds[i] = static_cast<double>(snapshot.nanoseconds[i]) * 1e-9;
+                }
+            }
+            return static_cast<int>(Stats::NUM_STAGES);
+        });
+    }
+
+    void
+    GEOSContext_resetStats_r(GEOSContextHandle_t extHandle)
+    {
+        execute(extHandle, [&]() {
+            geos::util::Stats::reset();
+        });
+    }
+
     void
     finishGEOS_r(GEOSContextHandle_t extHandle)
     {
@@ -811,7 +1020,10 @@ extern "C" {
     GEOSHausdorffDistance_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2, double* dist)
     {
         return execute(extHandle, 0, [&]() {
-            *dist = DiscreteHausdorffDistance::distance(*g1, *g2);
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            DiscreteHausdorffDistance hd(*g1, *g2);
+            hd.setExecutor(handle->executor.get());
+            *dist = hd.distance();
             return 1;
         });
     }
@@ -821,7 +1033,11 @@ extern "C" {
                                    double densifyFrac, double* dist)
     {
         return execute(extHandle, 0, [&]() {
-            *dist = DiscreteHausdorffDistance::distance(*g1, *g2, densifyFrac);
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            DiscreteHausdorffDistance hd(*g1, *g2);
+            hd.setDensifyFraction(densifyFrac);
+            hd.setExecutor(handle->executor.get());
+            *dist = hd.distance();
             return 1;
         });
     }
@@ -1193,7 +1409,9 @@ extern "C" {
     GEOSConvexHull_r(GEOSContextHandle_t extHandle, const Geometry* g1)
     {
         return execute(extHandle, [&]() {
-            auto g3 = g1->convexHull();
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            geos::algorithm::ConvexHull hull(g1, handle->executor.get());
+            auto g3 = hull.getConvexHull();
             g3->setSRID(g1->getSRID());
             return g3.release();
         });
@@ -1233,6 +1451,32 @@ extern "C" {
         });
     }
 
+    int
+    GEOSMaximumInscribedCircle_batch_r(GEOSContextHandle_t extHandle, const Geometry* const* geoms,
+                                       size_t ngeoms, double tolerance, double* centers, double* radii,
+                                       int nthreads)
+    {
+        return executeBatchRanges(extHandle, geoms, ngeoms, nthreads, [&](std::size_t begin, std::size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                if (geoms[i] == nullptr || geoms[i]->isEmpty()) {
+                    centers[2 * i] = centers[2 * i + 1] = std::numeric_limits<double>::quiet_NaN();
+                    if (radii != nullptr) {
+                        radii[i] = std::numeric_limits<double>::quiet_NaN();
+                    }
+                    continue;
+                }
+                geos::algorithm::construct::MaximumInscribedCircle mic(geoms[i], tolerance);
+                auto radiusLine = mic.getRadiusLine();
+                const geos::geom::Coordinate& center = radiusLine->getCoordinateN(0);
+                centers[2 * i] = center.x;
+                centers[2 * i + 1] = center.y;
+                if (radii != nullptr) {
+                    radii[i] = center.distance(radiusLine->getCoordinateN(1));
+                }
+            }
+        });
+    }
+
     Geometry*
     GEOSMinimumWidth_r(GEOSContextHandle_t extHandle, const Geometry* g)
     {
@@ -1462,6 +1706,58 @@ extern "C" {
         });
     }
 
+    int
+    GEOSClipByGrid_r(GEOSContextHandle_t extHandle, const Geometry* g,
+                     double xorigin, double yorigin, double cellWidth, double cellHeight, double buffer,
+                     GEOSGridClipCallback callback, void* userdata)
+    {
+        return execute(extHandle, 0, [&]() {
+            using geos::operation::intersection::RectangleGridIntersection;
+            auto tiles = RectangleGridIntersection::clip(*g, xorigin, yorigin, cellWidth, cellHeight, buffer);
+            for (auto& tile : tiles) {
+                tile.geom->setSRID(g->getSRID());
+                callback(tile.col, tile.row, tile.geom.release(), userdata);
+            }
+            return 1;
+        });
+    }
+
+    int
+    GEOSEncodeTile_r(GEOSContextHandle_t extHandle, const Geometry* g,
+                     double xmin, double ymin, double xmax, double ymax,
+                     unsigned int extent, unsigned int buffer, double tolerance,
+                     int* type, int** coords, unsigned int* ncoords,
+                     unsigned int** parts, unsigned int* nparts)
+    {
+        return execute(extHandle, 0, [&]() {
+            using geos::operation::intersection::TileEncoder;
+            TileEncoder encoder(geos::geom::Envelope(xmin, xmax, ymin, ymax), extent, buffer);
+            encoder.setSimplifyTolerance(tolerance);
+            TileEncoder::Result result;
+            encoder.encode(*g, result);
+
+            int* coordBuf = nullptr;
+            unsigned int* partBuf = nullptr;
+            if (!result.isEmpty()) {
+                coordBuf = static_cast<int*>(malloc(result.coords.size() * sizeof(int)));
+                partBuf = static_cast<unsigned int*>(malloc(result.parts.size() * sizeof(unsigned int)));
+                if (coordBuf == nullptr || partBuf == nullptr) {
+                    free(coordBuf);
+                    free(partBuf);
+                    throw std::bad_alloc();
+                }
+                std::copy(result.coords.begin(), result.coords.end(), coordBuf);
+                std::copy(result.parts.begin(), result.parts.end(), partBuf);
+            }
+            *type = result.type;
+            *coords = coordBuf;
+            *ncoords = static_cast<unsigned int>(result.coords.size() / 2);
+            *parts = partBuf;
+            *nparts = static_cast<unsigned int>(result.parts.size());
+            return 1;
+        });
+    }
+
 //-------------------------------------------------------------------
 // memory management functions
 //------------------------------------------------------------------
@@ -2778,7 +3074,26 @@ extern "C" {
         using namespace geos::simplify;
 
         return execute(extHandle, [&]() {
-            Geometry::Ptr g3(TopologyPreservingSimplifier::simplify(g1, tolerance));
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            TopologyPreservingSimplifier simp(g1);
+            simp.setDistanceTolerance(tolerance);
+            simp.setExecutor(handle->executor.get());
+            Geometry::Ptr g3(simp.getResultGeometry());
+            g3->setSRID(g1->getSRID());
+            return g3.release();
+        });
+    }
+
+    Geometry*
+    GEOSSimplifyVW_r(GEOSContextHandle_t extHandle, const Geometry* g1, double tolerance, int preserveTopology)
+    {
+        using namespace geos::simplify;
+
+        return execute(extHandle, [&]() {
+            VWSimplifier simp(g1);
+            simp.setDistanceTolerance(tolerance);
+            simp.setPreserveTopology(preserveTopology != 0);
+            Geometry::Ptr g3(simp.getResultGeometry());
             g3->setSRID(g1->getSRID());
             return g3.release();
         });
@@ -3044,6 +3359,10 @@ extern "C" {
     GEOSPrepare_r(GEOSContextHandle_t extHandle, const Geometry* g)
     {
         return execute(extHandle, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            if (handle->preparedCache) {
+                return handle->preparedCache->prepare(*g).release();
+            }
             return geos::geom::prep::PreparedGeometryFactory::prepare(g).release();
         });
     }
@@ -3168,6 +3487,34 @@ extern "C" {
         });
     }
 
+    Geometry*
+    GEOSPreparedIntersection_r(GEOSContextHandle_t extHandle,
+                               const geos::geom::prep::PreparedGeometry* pg, const Geometry* g)
+    {
+        using geos::operation::overlayng::PreparedOverlay;
+
+        return execute(extHandle, [&]() {
+            PreparedOverlay op(*pg);
+            auto g3 = op.intersection(g);
+            g3->setSRID(pg->getGeometry().getSRID());
+            return g3.release();
+        });
+    }
+
+    Geometry*
+    GEOSPreparedDifference_r(GEOSContextHandle_t extHandle,
+                             const geos::geom::prep::PreparedGeometry* pg, const Geometry* g)
+    {
+        using geos::operation::overlayng::PreparedOverlay;
+
+        return execute(extHandle, [&]() {
+            PreparedOverlay op(*pg);
+            auto g3 = op.difference(g);
+            g3->setSRID(g->getSRID());
+            return g3.release();
+        });
+    }
+
 //-----------------------------------------------------------------
 // STRtree
 //-----------------------------------------------------------------
@@ -3259,6 +3606,109 @@ extern "C" {
         });
     }
 
+    int
+    GEOSSTRtree_nearest_k_r(GEOSContextHandle_t extHandle,
+                            GEOSSTRtree* tree,
+                            const geos::geom::Geometry* const* geoms,
+                            std::size_t ngeoms,
+                            std::size_t k,
+                            double maxDistance,
+                            const geos::geom::Geometry** results,
+                            double* distances,
+                            std::size_t* numResults)
+    {
+        struct GeometryDistance {
+            double operator()(void* a, void* b) const {
+                return static_cast<const Geometry*>(a)->distance(static_cast<const Geometry*>(b));
+            }
+        };
+
+        return execute(extHandle, 0, [&]() {
+            std::vector<std::pair<geos::geom::Envelope, void*>> queries;
+            queries.reserve(ngeoms);
+            for(std::size_t i = 0; i < ngeoms; i++) {
+                queries.emplace_back(*geoms[i]->getEnvelopeInternal(), (void*) geoms[i]);
+            }
+            if(maxDistance < 0) {
+                maxDistance = std::numeric_limits<double>::infinity();
+            }
+
+            GeometryDistance itemDistance;
+            tree->nearestNeighbours(queries, itemDistance, k, maxDistance,
+            [&](std::size_t i, const std::vector<std::pair<void*, double>>& nearest) {
+                numResults[i] = nearest.size();
+                for(std::size_t j = 0; j < nearest.size(); j++) {
+                    results[i * k + j] = static_cast<const Geometry*>(nearest[j].first);
+                    if(distances) {
+                        distances[i * k + j] = nearest[j].second;
+                    }
+                }
+            });
+            return 1;
+        });
+    }
+
+    int
+    GEOSSTRtree_join_r(GEOSContextHandle_t extHandle,
+                       GEOSSTRtree* tree1,
+                       GEOSSTRtree* tree2,
+                       GEOSJoinCallback callback,
+                       void* userdata)
+    {
+        return execute(extHandle, 0, [&]() {
+            auto visitor = [&](void* item1, void* item2) {
+                callback(item1, item2, userdata);
+            };
+            if(tree2 == nullptr || tree2 == tree1) {
+                tree1->selfJoin(visitor);
+            }
+            else {
+                tree1->join(*tree2, visitor);
+            }
+            return 1;
+        });
+    }
+
+    int
+    GEOSSTRtree_joinWithinDistance_r(GEOSContextHandle_t extHandle,
+                                     GEOSSTRtree* tree1,
+                                     GEOSSTRtree* tree2,
+                                     double distance,
+                                     GEOSJoinCallback callback,
+                                     void* userdata)
+    {
+        using geos::geom::prep::PreparedGeometry;
+        using geos::geom::prep::PreparedGeometryFactory;
+
+        return execute(extHandle, 0, [&]() {
+            if(!(distance >= 0)) {
+                throw IllegalArgumentException("Join distance must be non-negative");
+            }
+
+            // geometries are prepared the first time they are tested
+            std::unordered_map<const Geometry*, std::unique_ptr<PreparedGeometry>> prepared;
+            auto visitor = [&](void* item1, void* item2) {
+                const Geometry* g1 = static_cast<const Geometry*>(item1);
+                const Geometry* g2 = static_cast<const Geometry*>(item2);
+                std::unique_ptr<PreparedGeometry>& pg = prepared[g1];
+                if(!pg) {
+                    pg = PreparedGeometryFactory::prepare(g1);
+                }
+                bool isWithinDistance = distance > 0 ? pg->distance(g2) <= distance : pg->intersects(g2);
+                if(isWithinDistance) {
+                    callback(item1, item2, userdata);
+                }
+            };
+            if(tree2 == nullptr || tree2 == tree1) {
+                tree1->selfJoin(distance, visitor);
+            }
+            else {
+                tree1->join(*tree2, distance, visitor);
+            }
+            return 1;
+        });
+    }
+
     void
     GEOSSTRtree_iterate_r(GEOSContextHandle_t extHandle,
                           GEOSSTRtree* tree,
@@ -3384,6 +3834,166 @@ extern "C" {
         });
     }
 
+    int
+    GEOSArea_batch_r(GEOSContextHandle_t extHandle, const Geometry* const* geoms, size_t ngeoms,
+                     double* out, int nthreads)
+    {
+        return executeBatch(extHandle, geoms, ngeoms, out, std::numeric_limits<double>::quiet_NaN(), nthreads,
+                            [](const Geometry* g) {
+            return g->getArea();
+        });
+    }
+
+    int
+    GEOSLength_batch_r(GEOSContextHandle_t extHandle, const Geometry* const* geoms, size_t ngeoms,
+                       double* out, int nthreads)
+    {
+        return executeBatch(extHandle, geoms, ngeoms, out, std::numeric_limits<double>::quiet_NaN(), nthreads,
+                            [](const Geometry* g) {
+            return g->getLength();
+        });
+    }
+
+    int
+    GEOSisEmpty_batch_r(GEOSContextHandle_t extHandle, const Geometry* const* geoms, size_t ngeoms,
+                        char* out, int nthreads)
+    {
+        return executeBatch(extHandle, geoms, ngeoms, out, char(2), nthreads,
+                            [](const Geometry* g) -> char {
+            return g->isEmpty();
+        });
+    }
+
+    int
+    GEOSisSimple_batch_r(GEOSContextHandle_t extHandle, const Geometry* const* geoms, size_t ngeoms,
+                         char* out, int nthreads)
+    {
+        return executeBatch(extHandle, geoms, ngeoms, out, char(2), nthreads,
+                            [](const Geometry* g) -> char {
+            return g->isSimple();
+        });
+    }
+
+    int
+    GEOSisValid_batch_r(GEOSContextHandle_t extHandle, const Geometry* const* geoms, size_t ngeoms,
+                        char* out, int nthreads)
+    {
+        return executeBatch(extHandle, geoms, ngeoms, out, char(2), nthreads,
+                            [](const Geometry* g) -> char {
+            return geos::operation::valid::IsValidOp::isValid(g);
+        });
+    }
+
+    int
+    GEOSEnvelope_batch_r(GEOSContextHandle_t extHandle, const Geometry* const* geoms, size_t ngeoms,
+                         Geometry** out, int nthreads)
+    {
+        return executeBatchGeometries(extHandle, geoms, ngeoms, out, nthreads,
+                                      [](const Geometry* g) {
+            return g->getEnvelope();
+        });
+    }
+
+    int
+    GEOSGetCentroid_batch_r(GEOSContextHandle_t extHandle, const Geometry* const* geoms, size_t ngeoms,
+                            Geometry** out, int nthreads)
+    {
+        return executeBatchGeometries(extHandle, geoms, ngeoms, out, nthreads,
+                                      [](const Geometry* g) -> std::unique_ptr<Geometry> {
+            std::unique_ptr<Geometry> ret = g->getCentroid();
+            if(ret == nullptr) {
+                ret = g->getFactory()->createPoint();
+            }
+            return ret;
+        });
+    }
+
+    int
+    GEOSPointOnSurface_batch_r(GEOSContextHandle_t extHandle, const Geometry* const* geoms, size_t ngeoms,
+                               Geometry** out, int nthreads)
+    {
+        return executeBatchGeometries(extHandle, geoms, ngeoms, out, nthreads,
+                                      [](const Geometry* g) -> std::unique_ptr<Geometry> {
+            std::unique_ptr<Geometry> ret = g->getInteriorPoint();
+            if(ret == nullptr) {
+                ret = g->getFactory()->createPoint();
+            }
+            return ret;
+        });
+    }
+
+    int
+    GEOSHilbertSort_r(GEOSContextHandle_t extHandle, Geometry** geoms, size_t ngeoms,
+                      const double* extent, size_t* order, int nthreads)
+    {
+        using geos::shape::fractal::Curve;
+
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            geos::util::Executor* executor = nthreads != 1 ? handle->executor.get() : nullptr;
+            std::size_t maxThreads = nthreads > 1 ? static_cast<std::size_t>(nthreads) : 0;
+
+            const geos::geom::Envelope nullEnv;
+            std::vector<const geos::geom::Envelope*> envs(ngeoms);
+            for (std::size_t i = 0; i < ngeoms; i++) {
+                envs[i] = geoms[i] ? geoms[i]->getEnvelopeInternal() : &nullEnv;
+            }
+
+            std::unique_ptr<geos::geom::Envelope> env;
+            if (extent) {
+                env.reset(new geos::geom::Envelope(extent[0], extent[2], extent[1], extent[3]));
+            }
+
+            std::vector<std::size_t> ord = geos::shape::fractal::order(envs, Curve::HILBERT, env.get(),
+                                                                       executor, maxThreads);
+
+            std::vector<Geometry*> sorted(ngeoms);
+            for (std::size_t i = 0; i < ngeoms; i++) {
+                sorted[i] = geoms[ord[i]];
+            }
+            std::copy(sorted.begin(), sorted.end(), geoms);
+            if (order) {
+                std::copy(ord.begin(), ord.end(), order);
+            }
+            return 1;
+        });
+    }
+
+    int
+    GEOSHilbertSortCoords_r(GEOSContextHandle_t extHandle, double* x, double* y, size_t n,
+                            const double* extent, size_t* order, int nthreads)
+    {
+        using geos::shape::fractal::Curve;
+
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            geos::util::Executor* executor = nthreads != 1 ? handle->executor.get() : nullptr;
+            std::size_t maxThreads = nthreads > 1 ? static_cast<std::size_t>(nthreads) : 0;
+
+            std::unique_ptr<geos::geom::Envelope> env;
+            if (extent) {
+                env.reset(new geos::geom::Envelope(extent[0], extent[2], extent[1], extent[3]));
+            }
+
+            std::vector<std::size_t> ord = geos::shape::fractal::order(x, y, n, Curve::HILBERT, env.get(),
+                                                                       executor, maxThreads);
+
+            std::vector<double> sorted(n);
+            for (std::size_t i = 0; i < n; i++) {
+                sorted[i] = x[ord[i]];
+            }
+            std::copy(sorted.begin(), sorted.end(), x);
+            for (std::size_t i = 0; i < n; i++) {
+                sorted[i] = y[ord[i]];
+            }
+            std::copy(sorted.begin(), sorted.end(), y);
+            if (order) {
+                std::copy(ord.begin(), ord.end(), order);
+            }
+            return 1;
+        });
+    }
+
     int GEOSOrientationIndex_r(GEOSContextHandle_t extHandle,
                                double Ax, double Ay, double Bx, double By, double Px, double Py)
     {
@@ -3596,6 +4206,40 @@ extern "C" {
         });
     }
 
+    Geometry*
+    GEOSConstrainedDelaunayTriangulation_r(GEOSContextHandle_t extHandle, const Geometry* g1, int onlyEdges)
+    {
+        using geos::triangulate::ConstrainedDelaunayTriangulationBuilder;
+
+        return execute(extHandle, [&]() -> Geometry* {
+            ConstrainedDelaunayTriangulationBuilder builder;
+            builder.setConstraints(*g1);
+
+            if(onlyEdges) {
+                Geometry* out = builder.getEdges(*g1->getFactory()).release();
+                out->setSRID(g1->getSRID());
+                return out;
+            }
+            else {
+                Geometry* out = builder.getTriangles(*g1->getFactory()).release();
+                out->setSRID(g1->getSRID());
+                return out;
+            }
+        });
+    }
+
+    Geometry*
+    GEOSPolygonTriangulation_r(GEOSContextHandle_t extHandle, const Geometry* g1)
+    {
+        using geos::triangulate::polygon::PolygonTriangulator;
+
+        return execute(extHandle, [&]() -> Geometry* {
+            Geometry* out = PolygonTriangulator::triangulate(g1).release();
+            out->setSRID(g1->getSRID());
+            return out;
+        });
+    }
+
     Geometry*
     GEOSVoronoiDiagram_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* env, double tolerance,
                          int onlyEdges)
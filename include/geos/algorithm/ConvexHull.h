@@ -16,6 +16,11 @@
  *
  * Last port: algorithm/ConvexHull.java r407 (JTS-1.12+)
  *
+ **********************************************************************
+ *
+ * NOTES: changed from JTS design, computing the hull with Andrew's
+ *        monotone chain instead of a Graham scan.
+ *
  **********************************************************************/
 
 #ifndef GEOS_ALGORITHM_CONVEXHULL_H
@@ -40,6 +45,9 @@ namespace geom {
 class Geometry;
 class GeometryFactory;
 }
+namespace util {
+class Executor;
+}
 }
 
 namespace geos {
@@ -51,108 +59,36 @@ namespace algorithm { // geos::algorithm
  * The convex hull is the smallest convex Geometry that contains all the
  * points in the input Geometry.
  *
- * Uses the Graham Scan algorithm.
- *
- * Last port: algorithm/ConvexHull.java rev. 1.26 (JTS-1.7)
+ * Uses Andrew's monotone chain algorithm, after discarding the points
+ * inside the octagon of the extreme points in the 8 directions at
+ * multiples of 45 degrees. Large inputs can be split between the threads
+ * of a util::Executor, the hull being the hull of the hulls of the parts.
  *
  */
 class GEOS_DLL ConvexHull {
 private:
     const geom::GeometryFactory* geomFactory;
-    geom::Coordinate::ConstVect inputPts;
+    util::Executor* executor;
+    std::vector<geom::Coordinate> inputPts;
 
     void extractCoordinates(const geom::Geometry* geom);
 
-    /// Create a CoordinateSequence from the Coordinate::ConstVect
-    /// This is needed to construct the geometries.
-    /// Here coordinate copies happen
-    /// The returned object is newly allocated !NO EXCEPTION SAFE!
-    std::unique_ptr<geom::CoordinateSequence> toCoordinateSequence(geom::Coordinate::ConstVect& cv);
-
-    void computeOctPts(const geom::Coordinate::ConstVect& src,
-                       geom::Coordinate::ConstVect& tgt);
-
-    bool computeOctRing(const geom::Coordinate::ConstVect& src,
-                        geom::Coordinate::ConstVect& tgt);
-
-    /**
-     * Uses a heuristic to reduce the number of points scanned
-     * to compute the hull.
-     * The heuristic is to find a polygon guaranteed to
-     * be in (or on) the hull, and eliminate all points inside it.
-     * A quadrilateral defined by the extremal points
-     * in the four orthogonal directions
-     * can be used, but even more inclusive is
-     * to use an octilateral defined by the points in the
-     * 8 cardinal directions.
-     *
-     * Note that even if the method used to determine the polygon
-     * vertices is not 100% robust, this does not affect the
-     * robustness of the convex hull.
-     *
-     * To satisfy the requirements of the Graham Scan algorithm,
-     * the resulting array has at least 3 entries.
-     *
-     * @param pts The vector of const Coordinate pointers
-     *            to be reduced (to at least 3 elements)
-     *
-     * WARNING: the parameter will be modified
-     *
-     */
-    void reduce(geom::Coordinate::ConstVect& pts);
-
-    /// parameter will be modified
-    void padArray3(geom::Coordinate::ConstVect& pts);
-
-    /// parameter will be modified
-    void preSort(geom::Coordinate::ConstVect& pts);
-
     /**
-     * Given two points p and q compare them with respect to their radial
-     * ordering about point o.  First checks radial ordering.
-     * If points are collinear, the comparison is based
-     * on their distance to the origin.
-     *
-     * p < q iff
+     * Computes the vertices of the hull, in counterclockwise order
+     * without collinear vertices and without closing the ring.
      *
-     * - ang(o-p) < ang(o-q) (e.g. o-p-q is CCW)
-     * - or ang(o-p) == ang(o-q) && dist(o,p) < dist(o,q)
-     *
-     * @param o the origin
-     * @param p a point
-     * @param q another point
-     * @return -1, 0 or 1 depending on whether p is less than,
-     * equal to or greater than q
+     * WARNING: reorders and reduces inputPts
      */
-    int polarCompare(const geom::Coordinate& o,
-                     const geom::Coordinate& p, const geom::Coordinate& q);
-
-    void grahamScan(const geom::Coordinate::ConstVect& c,
-                    geom::Coordinate::ConstVect& ps);
+    void computeHull(std::vector<geom::Coordinate>& hull);
 
     /**
-     * @param  vertices  the vertices of a linear ring,
-     *                   which may or may not be
-     *                   flattened (i.e. vertices collinear)
+     * @param  hull  the vertices of the hull, as computed by computeHull
      *
-     * @return           a 2-vertex LineString if the vertices are
-     *                   collinear; otherwise, a Polygon with unnecessary
-     *                   (collinear) vertices removed
+     * @return  a 2-vertex LineString if the vertices are collinear;
+     *          otherwise, a Polygon with a clockwise shell starting
+     *          at the lowest vertex
      */
-    std::unique_ptr<geom::Geometry> lineOrPolygon(const geom::Coordinate::ConstVect& vertices);
-
-    /**
-     * Write in 'cleaned' a version of 'input' with collinear
-     * vertexes removed.
-     */
-    void cleanRing(const geom::Coordinate::ConstVect& input,
-                   geom::Coordinate::ConstVect& cleaned);
-
-    /**
-     * @return  whether the three coordinates are collinear
-     *          and c2 lies between c1 and c3 inclusive
-     */
-    bool isBetween(const geom::Coordinate& c1, const geom::Coordinate& c2, const geom::Coordinate& c3);
+    std::unique_ptr<geom::Geometry> lineOrPolygon(std::vector<geom::Coordinate>& hull);
 
 public:
 
@@ -161,6 +97,14 @@ public:
      */
     ConvexHull(const geom::Geometry* newGeometry);
 
+    /**
+     * Create a new convex hull construction for the input Geometry,
+     * computing the hulls of parts of large inputs in parallel.
+     *
+     * @param newGeometry the geometry
+     * @param executor the threads used, or nullptr
+     */
+    ConvexHull(const geom::Geometry* newGeometry, util::Executor* executor);
 
     ~ConvexHull();
 
@@ -21,7 +21,6 @@
 
 #include <cassert>
 #include <geos/algorithm/ConvexHull.h>
-#include <geos/util/UniqueCoordinateArrayFilter.h>
 #include <geos/geom/Geometry.h>
 
 namespace geos {
@@ -30,21 +29,24 @@ namespace algorithm { // geos::algorithm
 INLINE
 ConvexHull::ConvexHull(const geom::Geometry* newGeometry)
     :
-    geomFactory(newGeometry->getFactory())
+    geomFactory(newGeometry->getFactory()),
+    executor(nullptr)
 {
     extractCoordinates(newGeometry);
 }
 
 INLINE
-ConvexHull::~ConvexHull()
+ConvexHull::ConvexHull(const geom::Geometry* newGeometry, util::Executor* p_executor)
+    :
+    geomFactory(newGeometry->getFactory()),
+    executor(p_executor)
 {
+    extractCoordinates(newGeometry);
 }
 
-INLINE void
-ConvexHull::extractCoordinates(const geom::Geometry* geom)
+INLINE
+ConvexHull::~ConvexHull()
 {
-    util::UniqueCoordinateArrayFilter filter(inputPts);
-    geom->apply_ro(&filter);
 }
 
 } // namespace geos::algorithm
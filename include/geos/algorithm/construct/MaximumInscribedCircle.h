@@ -27,7 +27,7 @@
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
 #include <memory>
-#include <queue>
+#include <vector>
 
 
 
@@ -185,7 +185,14 @@ private:
         }
     };
 
-    void createInitialGrid(const geom::Envelope* env, std::priority_queue<Cell>& cellQueue);
+    /// Priority queue of cells, kept as a max-heap ordered by maximum distance.
+    /// The storage is reused as the cells are refined.
+    std::vector<Cell> cellQueue;
+
+    void createInitialGrid(const geom::Envelope* env);
+    void pushCell(double x, double y, double hSize);
+    Cell popCell();
+    void splitCell(const Cell& cell);
     Cell createCentroidCell(const geom::Geometry* geom);
 
 };
@@ -145,10 +145,21 @@ public:
     }
 
 private:
-    geom::Coordinate getSegementAt(const geom::CoordinateSequence& seq, std::size_t index);
+    /// The distance between a pair of discrete points, and their indexes
+    struct Coupling {
+        double distance;
+        std::size_t i;
+        std::size_t j;
+    };
 
-    PointPairDistance& getFrecheDistance(std::vector< std::vector<PointPairDistance> >& ca, std::size_t i, std::size_t j,
-                                         const geom::CoordinateSequence& p, const geom::CoordinateSequence& q);
+    std::vector<geom::Coordinate> getDiscretePoints(const geom::CoordinateSequence& seq) const;
+
+    /**
+     * Computes the coupling distance of a cell of the free-space table
+     * from the cells preceding it, which are null on the table edges.
+     */
+    static Coupling getCoupling(const Coupling* d1, const Coupling* d2, const Coupling* d3,
+                                const Coupling& pairDist);
 
     void compute(const geom::Geometry& discreteGeom, const geom::Geometry& geom);
 
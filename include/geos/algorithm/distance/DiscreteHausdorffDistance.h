@@ -21,12 +21,7 @@
 
 #include <geos/export.h>
 #include <geos/algorithm/distance/PointPairDistance.h> // for composition
-#include <geos/algorithm/distance/DistanceToPoint.h> // for composition
-#include <geos/util/IllegalArgumentException.h> // for inlines
 #include <geos/geom/Geometry.h> // for inlines
-#include <geos/util/math.h> // for inlines
-#include <geos/geom/CoordinateFilter.h> // for inheritance
-#include <geos/geom/CoordinateSequenceFilter.h> // for inheritance
 
 #include <cstddef>
 #include <vector>
@@ -50,6 +45,9 @@ namespace intervalrtree {
 //class SortedPackedIntervalRTree;
 }
 }
+namespace util {
+class Executor;
+}
 }
 
 namespace geos {
@@ -68,6 +66,12 @@ namespace distance { // geos::algorithm::distance
  * Also determines two points of the Geometries which are separated by the
  * computed distance.
  *
+ * The facets of each geometry are indexed, and the search for the
+ * nearest facet to a point stops as soon as the point is known not
+ * to increase the distance, so large inputs are handled efficiently.
+ * If an executor is set, the points of large inputs are searched
+ * in several threads, with the same result.
+ *
  * This algorithm is an approximation to the standard Hausdorff distance.
  * Specifically,
  * <pre>
@@ -112,7 +116,8 @@ public:
         g0(p_g0),
         g1(p_g1),
         ptDist(),
-        densifyFrac(0.0)
+        densifyFrac(0.0),
+        executor(nullptr)
     {}
 
     /**
@@ -125,6 +130,17 @@ public:
      */
     void setDensifyFraction(double dFrac);
 
+    /**
+     * Sets the threads used to search the points of large inputs.
+     *
+     * @param p_executor the threads used, or nullptr
+     */
+    void
+    setExecutor(util::Executor* p_executor)
+    {
+        executor = p_executor;
+    }
+
     double
     distance()
     {
@@ -145,84 +161,6 @@ public:
         return ptDist.getCoordinates();
     }
 
-    class MaxPointDistanceFilter : public geom::CoordinateFilter {
-    public:
-        MaxPointDistanceFilter(const geom::Geometry& p_geom)
-            :
-            geom(p_geom)
-        {}
-
-        void
-        filter_ro(const geom::Coordinate* pt) override
-        {
-            minPtDist.initialize();
-            DistanceToPoint::computeDistance(geom, *pt,
-                                             minPtDist);
-            maxPtDist.setMaximum(minPtDist);
-        }
-
-        const PointPairDistance&
-        getMaxPointDistance() const
-        {
-            return maxPtDist;
-        }
-
-    private:
-        PointPairDistance maxPtDist;
-        PointPairDistance minPtDist;
-        DistanceToPoint euclideanDist;
-        const geom::Geometry& geom;
-
-        // Declare type as noncopyable
-        MaxPointDistanceFilter(const MaxPointDistanceFilter& other);
-        MaxPointDistanceFilter& operator=(const MaxPointDistanceFilter& rhs);
-    };
-
-    class MaxDensifiedByFractionDistanceFilter
-        : public geom::CoordinateSequenceFilter {
-    public:
-
-        MaxDensifiedByFractionDistanceFilter(
-            const geom::Geometry& p_geom, double fraction)
-            :
-            geom(p_geom),
-            // Validity of the cast to size_t has been verified in setDensifyFraction()
-            numSubSegs(std::size_t(util::round(1.0 / fraction)))
-        {
-        }
-
-        void filter_ro(const geom::CoordinateSequence& seq,
-                       std::size_t index) override;
-
-        bool
-        isGeometryChanged() const override
-        {
-            return false;
-        }
-
-        bool
-        isDone() const override
-        {
-            return false;
-        }
-
-        const PointPairDistance&
-        getMaxPointDistance() const
-        {
-            return maxPtDist;
-        }
-
-    private:
-        PointPairDistance maxPtDist;
-        PointPairDistance minPtDist;
-        const geom::Geometry& geom;
-        std::size_t numSubSegs; // = 0;
-
-        // Declare type as noncopyable
-        MaxDensifiedByFractionDistanceFilter(const MaxDensifiedByFractionDistanceFilter& other);
-        MaxDensifiedByFractionDistanceFilter& operator=(const MaxDensifiedByFractionDistanceFilter& rhs);
-    };
-
 private:
 
     void
@@ -246,6 +184,8 @@ private:
     /// Value of 0.0 indicates that no densification should take place
     double densifyFrac; // = 0.0;
 
+    util::Executor* executor; // = nullptr;
+
     // Declare type as noncopyable
     DiscreteHausdorffDistance(const DiscreteHausdorffDistance& other) = delete;
     DiscreteHausdorffDistance& operator=(const DiscreteHausdorffDistance& rhs) = delete;
@@ -0,0 +1,149 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_ALGORITHM_LOCATE_AREACELLGRID_H
+#define GEOS_ALGORITHM_LOCATE_AREACELLGRID_H
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Location.h>
+
+#include <cstddef>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Coordinate;
+class CoordinateSequence;
+class Geometry;
+}
+namespace algorithm {
+namespace locate {
+class PointOnGeometryLocator;
+}
+}
+}
+
+namespace geos {
+namespace algorithm { // geos::algorithm
+namespace locate { // geos::algorithm::locate
+
+/** \brief
+ * A hierarchical grid over the envelope of an areal geometry, whose cells
+ * are classified as interior, exterior or possibly crossed by the boundary.
+ *
+ * The grid locates points and envelopes with a few cell lookups. Each
+ * level has half the resolution of the level below it, and a cell of a
+ * coarser level is interior or exterior only if all the cells it covers
+ * are. An envelope is looked up at the finest level where it covers at
+ * most 2 x 2 cells, then at finer levels as long as it covers few cells.
+ *
+ * The answers are exact: a location other than
+ * [BOUNDARY](@ref geom::Location) is the location of all points of the
+ * envelope, and BOUNDARY means that the grid cannot tell.
+ *
+ * The grid is used by IndexedPointInAreaLocator to locate points and by
+ * [PreparedPolygon](@ref geom::prep::PreparedPolygon) to evaluate predicates.
+ */
+class GEOS_DLL AreaCellGrid {
+
+public:
+
+    /// The maximum number of cells along each side of the finest level
+    static const std::size_t MAX_RESOLUTION = 1 << 16;
+
+    /**
+     * \brief Builds the grid of an areal geometry.
+     *
+     * @param area the Polygonal geometry
+     * @param locator a locator of points in the geometry, used to classify cells
+     * @param resolution the number of cells along each side of the finest level,
+     *        clamped to MAX_RESOLUTION and rounded up to a power of two
+     * @param maxBytes the maximum memory used by the cells of all levels;
+     *        the resolution is reduced to fit
+     */
+    AreaCellGrid(const geom::Geometry& area, PointOnGeometryLocator& locator,
+                 std::size_t resolution, std::size_t maxBytes);
+
+    /**
+     * \brief Determines the location of all points of an envelope.
+     *
+     * @param env the envelope
+     * @return the location of all points of the envelope, or BOUNDARY if unknown
+     */
+    geom::Location locate(const geom::Envelope& env) const;
+
+    /**
+     * \brief Determines the location of a point.
+     *
+     * @param p the point
+     * @return the location of the point, or BOUNDARY if unknown
+     */
+    geom::Location locate(const geom::Coordinate& p) const;
+
+    /// Returns the number of cells along each side of the finest level
+    std::size_t
+    getResolution() const
+    {
+        return resolution;
+    }
+
+    /// Returns the memory used by the cells of all levels, in bytes
+    std::size_t getMemorySize() const;
+
+private:
+
+    geom::Envelope env;
+    std::size_t resolution;
+    double scaleX;
+    double scaleY;
+    double cellWidth;
+    double cellHeight;
+    bool clipSegments;
+
+    /// The cells of each level, from the finest; a cell is a geom::Location
+    std::vector<std::vector<geom::Location>> levels;
+
+    std::size_t cellX(double x) const;
+    std::size_t cellY(double y) const;
+
+    void markBoundary(const geom::CoordinateSequence& pts);
+    void markSegment(const geom::Coordinate& p0, const geom::Coordinate& p1);
+    void markCells(std::size_t row, std::size_t minCol, std::size_t maxCol);
+    void classifyCells(PointOnGeometryLocator& locator);
+    void buildLevels();
+
+    geom::Location locateCells(std::size_t level,
+                               std::size_t minCol, std::size_t maxCol,
+                               std::size_t minRow, std::size_t maxRow) const;
+
+    // Declare type as noncopyable
+    AreaCellGrid(const AreaCellGrid& other) = delete;
+    AreaCellGrid& operator=(const AreaCellGrid& rhs) = delete;
+
+}; // class AreaCellGrid
+
+} // geos::algorithm::locate
+} // geos::algorithm
+} // geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_ALGORITHM_LOCATE_AREACELLGRID_H
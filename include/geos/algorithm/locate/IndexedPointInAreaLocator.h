@@ -17,11 +17,14 @@
 #ifndef GEOS_ALGORITHM_LOCATE_INDEXEDPOINTINAREALOCATOR_H
 #define GEOS_ALGORITHM_LOCATE_INDEXEDPOINTINAREALOCATOR_H
 
+#include <geos/geom/Envelope.h>
 #include <geos/geom/LineSegment.h>
+#include <geos/geom/Location.h>
+#include <geos/algorithm/locate/AreaCellGrid.h> // composition
 #include <geos/algorithm/locate/PointOnGeometryLocator.h> // inherited
 #include <geos/index/ItemVisitor.h> // inherited
-#include <geos/index/strtree/TemplateSTRtree.h>
 
+#include <cstdint>
 #include <memory>
 #include <vector> // composition
 
@@ -49,49 +52,65 @@ namespace locate { // geos::algorithm::locate
  *
  * Polygonal and [LinearRing](@ref geom::LinearRing) geometries are supported.
  *
+ * The segments of the geometry are copied into arrays sorted by Y,
+ * and indexed by the horizontal strips of the envelope which they cross,
+ * so that a point is located by counting the ray crossings of the
+ * segments of one strip.
+ *
+ * Optionally, the locator also builds an AreaCellGrid, whose cells are
+ * classified as interior, exterior or crossed by the boundary, as
+ * PostGIS does for cached point-in-polygon tests. Points in cells not
+ * crossed by the boundary are then located without counting crossings.
+ *
  * The index is lazy-loaded, which allows creating instances even if they are not used.
  *
  */
 class IndexedPointInAreaLocator : public PointOnGeometryLocator {
 private:
-    struct SegmentView {
-        SegmentView(const geom::Coordinate* p_p0, const geom::Coordinate* p_p1) : m_p0(p_p0) {
-            // All GEOS CoordinateSequences store their coordinates sequentially.
-            // Should that ever change, this assert will fail.
-            (void) p_p1;
-            assert(p_p0 + 1 == p_p1);
-        }
 
-        const geom::Coordinate& p0() const {
-            return *m_p0;
-        }
+    /*
+     * The segments of a geometry, stored as arrays of ordinates sorted by
+     * minimum Y, with the indexes of the segments crossing each strip.
+     */
+    class StripIndexedGeometry {
+    public:
+        explicit StripIndexedGeometry(const geom::Geometry& g);
 
-        const geom::Coordinate& p1() const {
-            return *(m_p0 + 1);
+        const geom::Envelope&
+        getEnvelope() const
+        {
+            return env;
         }
 
-        const geom::Coordinate* m_p0;
-    };
+        /// Counts the crossings of the segments of the strip of a point
+        void countSegments(RayCrossingCounter& rcc, const geom::Coordinate& p) const;
 
-    class IntervalIndexedGeometry {
     private:
+        geom::Envelope env;
+        std::size_t numStrips;
+        double stripScale;
 
-        index::strtree::TemplateSTRtree<SegmentView, index::strtree::IntervalTraits> index;
+        std::vector<double> x0;
+        std::vector<double> y0;
+        std::vector<double> x1;
+        std::vector<double> y1;
 
-        void init(const geom::Geometry& g);
-        void addLine(const geom::CoordinateSequence* pts);
+        /// Offsets of the first segment of each strip in stripSegments
+        std::vector<std::size_t> stripOffsets;
+        std::vector<uint32_t> stripSegments;
 
-    public:
-        IntervalIndexedGeometry(const geom::Geometry& g);
+        std::size_t stripIndex(double y) const;
 
-        template<typename Visitor>
-        void query(double min, double max, Visitor&& f) {
-            index.query(index::strtree::Interval(min, max), f);
-        }
+        void setNumStrips(std::size_t n);
+        std::size_t countStripSegments() const;
+        void buildStrips();
     };
 
     const geom::Geometry& areaGeom;
-    std::unique_ptr<IntervalIndexedGeometry> index;
+    std::size_t gridSize;
+    std::size_t gridMaxBytes;
+    std::unique_ptr<StripIndexedGeometry> index;
+    std::unique_ptr<AreaCellGrid> grid;
 
     void buildIndex(const geom::Geometry& g);
 
@@ -100,6 +119,9 @@ private:
     IndexedPointInAreaLocator& operator=(const IndexedPointInAreaLocator& rhs) = delete;
 
 public:
+    /// The default memory budget of the cell grid, in bytes
+    static const std::size_t DEFAULT_GRID_MAX_BYTES = 1 << 20;
+
     /** \brief
      * Creates a new locator for a given [Geometry](@ref geom::Geometry).
      *
@@ -109,6 +131,24 @@ public:
      */
     IndexedPointInAreaLocator(const geom::Geometry& g);
 
+    /** \brief
+     * Creates a new locator for a given [Geometry](@ref geom::Geometry),
+     * which also classifies the cells of a grid over its envelope.
+     *
+     * The finest level of the grid has gridSize * gridSize cells, of one
+     * byte each. It speeds up the location of many points when the
+     * boundary crosses a small fraction of the cells.
+     *
+     * @param g the Geometry to locate in
+     * @param gridSize the number of cells along each side of the grid,
+     *        rounded up to a power of two, or 0 for no grid
+     * @param gridMaxBytes the maximum memory used by the grid;
+     *        the grid size is reduced to fit
+     * @see AreaCellGrid
+     */
+    IndexedPointInAreaLocator(const geom::Geometry& g, std::size_t gridSize,
+                              std::size_t gridMaxBytes = DEFAULT_GRID_MAX_BYTES);
+
     const geom::Geometry&  getGeometry() const {
         return areaGeom;
     }
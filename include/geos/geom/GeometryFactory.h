@@ -30,6 +30,7 @@
 #include <geos/inline.h>
 #include <geos/util.h>
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <cassert>
@@ -510,7 +511,8 @@ private:
     int SRID;
     const CoordinateSequenceFactory* coordinateListFactory;
 
-    mutable int _refCount;
+    // Geometries may be created and destroyed in several threads at once
+    mutable std::atomic<int> _refCount;
     bool _autoDestroy;
 
     friend class Geometry;
@@ -120,6 +120,12 @@ public:
      */
     bool isAnyTargetComponentInTest(const geom::Geometry* testGeom) const;
 
+    /**
+     * Computes the envelopes of all components of the base geometry,
+     * which are otherwise computed lazily by the predicates.
+     */
+    void buildIndexes() const override;
+
     /**
      * Default implementation.
      */
@@ -216,6 +216,15 @@ public:
      *
      */
     virtual double distance(const geom::Geometry* geom) const = 0;
+
+    /** \brief
+     * Builds the indexes which the predicates otherwise build
+     * on first use.
+     *
+     * Afterwards the predicates do not change the prepared geometry,
+     * so it can be used by several threads at once.
+     */
+    virtual void buildIndexes() const {}
 };
 
 
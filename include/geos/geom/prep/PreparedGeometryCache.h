@@ -0,0 +1,149 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_PREP_PREPAREDGEOMETRYCACHE_H
+#define GEOS_GEOM_PREP_PREPAREDGEOMETRYCACHE_H
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+namespace prep {
+class PreparedGeometry;
+}
+}
+}
+
+namespace geos {
+namespace geom { // geos::geom
+namespace prep { // geos::geom::prep
+
+/**
+ * \brief
+ * A size-bounded cache of {@link PreparedGeometry}s, for applications
+ * which prepare the same geometries over and over.
+ *
+ * The indexes of a PreparedGeometry are built when it is first used,
+ * and the cache keeps them for later requests of an equal geometry.
+ * Entries are keyed by a hash of the coordinates of the geometry,
+ * and a cached geometry is only used if it is equal to the requested
+ * one according to Geometry::equalsExact(), and has the same SRID,
+ * coordinate dimension and Z values. So neither the result of the
+ * predicates nor the geometry returned by
+ * PreparedGeometry::getGeometry() depend on the cache. The least recently used
+ * entry is dropped when the cache is full.
+ *
+ * The cache can be shared by several threads. The prepared geometries
+ * it returns refer to a shared entry, whose indexes are built when it
+ * is added, so that it can be used by several threads at once
+ * (see PreparedGeometry::buildIndexes()).
+ * An entry remains valid after it is dropped from the cache, until the
+ * last prepared geometry referring to it is destroyed.
+ */
+class GEOS_DLL PreparedGeometryCache {
+
+public:
+
+    /**
+     * \brief Creates a cache.
+     *
+     * @param maxEntries the maximum number of geometries in the cache
+     * @param minNumPoints geometries with fewer points are prepared
+     *        by PreparedGeometryFactory::prepare() without being cached,
+     *        so that they do not push larger geometries out of the cache
+     */
+    explicit PreparedGeometryCache(std::size_t maxEntries, std::size_t minNumPoints = 0);
+
+    ~PreparedGeometryCache();
+
+    PreparedGeometryCache(const PreparedGeometryCache&) = delete;
+    PreparedGeometryCache& operator=(const PreparedGeometryCache&) = delete;
+
+    /**
+     * \brief Returns a prepared geometry equal to a geometry.
+     *
+     * Unless the geometry has fewer points than the minimum number
+     * of points of the cache, the result does not refer to the argument,
+     * which can be destroyed before it.
+     *
+     * @param geom the geometry to prepare
+     * @return a prepared geometry
+     */
+    std::unique_ptr<PreparedGeometry> prepare(const geom::Geometry& geom);
+
+    /// Sets the maximum number of entries, dropping entries if needed
+    void setMaxEntries(std::size_t maxEntries);
+
+    std::size_t getMaxEntries() const;
+
+    /// Returns the number of entries in the cache
+    std::size_t size() const;
+
+    /// Drops all entries
+    void clear();
+
+    /// Returns the number of calls of prepare() answered from the cache
+    std::size_t getNumHits() const;
+
+    /// Returns the number of calls of prepare() which added an entry
+    std::size_t getNumMisses() const;
+
+    /// Computes the hash of the coordinates, SRID and coordinate dimension
+    /// of a geometry used as a key
+    static std::size_t hash(const geom::Geometry& geom);
+
+private:
+
+    struct Entry;
+    class CachedPreparedGeometry;
+    typedef std::list<std::shared_ptr<Entry>> EntryList;
+
+    std::size_t maxEntries;
+    std::size_t minNumPoints;
+
+    mutable std::mutex mutex;
+    /// Entries, from the most to the least recently used
+    EntryList entries;
+    std::unordered_multimap<std::size_t, EntryList::iterator> index;
+    std::size_t numHits;
+    std::size_t numMisses;
+
+    /// Finds an entry for a geometry; the mutex must be held
+    std::shared_ptr<Entry> find(const geom::Geometry& geom, std::size_t key);
+
+    /// Drops the least recently used entries; the mutex must be held
+    void trim();
+
+}; // class PreparedGeometryCache
+
+} // namespace geos::geom::prep
+} // namespace geos::geom
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_GEOM_PREP_PREPAREDGEOMETRYCACHE_H
@@ -57,6 +57,8 @@ public:
 
     noding::FastSegmentSetIntersectionFinder* getIntersectionFinder();
 
+    void buildIndexes() const override;
+
     bool intersects(const geom::Geometry* g) const override;
     std::unique_ptr<geom::CoordinateSequence> nearestPoints(const geom::Geometry* g) const override;
     double distance(const geom::Geometry* g) const override;
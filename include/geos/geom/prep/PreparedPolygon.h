@@ -22,6 +22,7 @@
 #define GEOS_GEOM_PREP_PREPAREDPOLYGON_H
 
 #include <geos/geom/prep/BasicPreparedGeometry.h> // for inheritance
+#include <geos/geom/Location.h>
 #include <geos/noding/SegmentString.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
@@ -33,6 +34,7 @@ class FastSegmentSetIntersectionFinder;
 }
 namespace algorithm {
 namespace locate {
+class AreaCellGrid;
 class PointOnGeometryLocator;
 }
 }
@@ -56,9 +58,17 @@ private:
     mutable std::unique_ptr<algorithm::locate::PointOnGeometryLocator> ptOnGeomLoc;
     mutable noding::SegmentString::ConstVect segStrings;
     mutable std::unique_ptr<operation::distance::IndexedFacetDistance> indexedDistance;
+    std::size_t cellGridResolution;
+    std::size_t cellGridMaxBytes;
+    mutable std::unique_ptr<algorithm::locate::AreaCellGrid> cellGrid;
+
+    geom::Location locateInCellGrid(const geom::Geometry* g) const;
 
 protected:
 public:
+    /// The default memory budget of the cell grid, in bytes
+    static const std::size_t DEFAULT_CELL_GRID_MAX_BYTES = 1 << 20;
+
     PreparedPolygon(const geom::Geometry* geom);
     ~PreparedPolygon() override;
 
@@ -66,6 +76,29 @@ public:
     algorithm::locate::PointOnGeometryLocator* getPointLocator() const;
     operation::distance::IndexedFacetDistance* getIndexedFacetDistance() const;
 
+    /** \brief
+     * Makes the predicates look up the tested geometry in a grid of cells
+     * classified as interior, exterior or crossed by the boundary.
+     *
+     * When the envelope of the tested geometry falls in interior or
+     * exterior cells, contains(), containsProperly(), covers() and
+     * intersects() are answered without testing segments. This pays off
+     * for large polygons tested against many small geometries. The grid
+     * is built on first use.
+     *
+     * @param resolution the number of cells along each side of the finest
+     *        level of the grid, or 0 to disable the grid
+     * @param maxBytes the maximum memory used by the grid
+     *
+     * @see algorithm::locate::AreaCellGrid
+     */
+    void setCellGrid(std::size_t resolution, std::size_t maxBytes = DEFAULT_CELL_GRID_MAX_BYTES);
+
+    /// Returns the cell grid, building it if needed, or nullptr if disabled
+    const algorithm::locate::AreaCellGrid* getCellGrid() const;
+
+    void buildIndexes() const override;
+
     bool contains(const geom::Geometry* g) const override;
     bool containsProperly(const geom::Geometry* g) const override;
     bool covers(const geom::Geometry* g) const override;
@@ -0,0 +1,59 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Envelope;
+}
+}
+
+namespace geos {
+namespace index {   // geos::index
+namespace strtree { // geos::index::strtree
+
+/**
+ * \brief
+ * Groups items into clusters whose envelopes interact,
+ * directly or through other items of the cluster.
+ *
+ * Items in different clusters have disjoint envelopes, so operations
+ * which only combine interacting items can process the clusters
+ * independently. The interacting pairs are found with a
+ * TemplateSTRtree and merged with a union-find.
+ */
+class GEOS_DLL EnvelopeClusterFinder {
+
+public:
+
+    /**
+     * Computes the clusters of a set of items.
+     *
+     * @param envelopes the envelopes of the items
+     * @return the indexes of the items of each cluster, in increasing
+     *         order, with the clusters ordered by their first item
+     */
+    static std::vector<std::vector<std::size_t>>
+    cluster(const std::vector<const geom::Envelope*>& envelopes);
+
+};
+
+} // namespace geos::index::strtree
+} // namespace geos::index
+} // namespace geos
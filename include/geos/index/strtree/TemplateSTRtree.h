@@ -19,12 +19,18 @@
 #include <geos/index/chain/MonotoneChain.h>
 #include <geos/index/ItemVisitor.h>
 #include <geos/util.h>
+#include <geos/util/Stats.h>
 
 #include <geos/index/strtree/TemplateSTRNode.h>
 #include <geos/index/strtree/TemplateSTRNodePair.h>
 #include <geos/index/strtree/TemplateSTRtreeDistance.h>
 #include <geos/index/strtree/Interval.h>
+#include <geos/shape/fractal/HilbertCode.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <vector>
 #include <queue>
 #include <mutex>
@@ -250,6 +256,56 @@ public:
         return nearestNeighbour(env, item, id);
     }
 
+    /**
+     * Determine the `k` items nearest to `item` using distance metric `itemDist`,
+     * in order of increasing distance.
+     * Items further than `maxDistance` are not returned.
+     */
+    template<typename ItemDistance>
+    std::vector<std::pair<ItemType, double>> nearestNeighbours(const BoundsType& env, const ItemType& item,
+            ItemDistance& itemDist, std::size_t k,
+            double maxDistance = std::numeric_limits<double>::infinity()) {
+        std::vector<std::pair<ItemType, double>> result;
+        if (getRoot() == nullptr) {
+            return result;
+        }
+
+        TemplateSTRNode<ItemType, BoundsTraits> bnd(item, env);
+        TemplateSTRtreeDistance<ItemType, BoundsTraits, ItemDistance> td(itemDist);
+        td.nearestNeighbours(*getRoot(), bnd, k, maxDistance, result);
+        return result;
+    }
+
+    /**
+     * Determine the `k` items nearest to each of a list of query items,
+     * using distance metric `itemDist`.
+     * For each query the visitor is called with the index of the query
+     * and a vector of the nearest items and their distances,
+     * in order of increasing distance.
+     *
+     * The queries are processed in Hilbert order of their bounds,
+     * so that consecutive searches visit the same parts of the tree,
+     * and the search queue is reused between them.
+     */
+    template<typename ItemDistance, typename Visitor>
+    void nearestNeighbours(const std::vector<std::pair<BoundsType, ItemType>>& queries,
+                           ItemDistance& itemDist, std::size_t k, double maxDistance, Visitor&& visitor) {
+        std::vector<std::pair<ItemType, double>> result;
+        if (getRoot() == nullptr) {
+            for (std::size_t i = 0; i < queries.size(); i++) {
+                visitor(i, result);
+            }
+            return;
+        }
+
+        TemplateSTRtreeDistance<ItemType, BoundsTraits, ItemDistance> td(itemDist);
+        for (std::size_t i : hilbertOrder(queries)) {
+            TemplateSTRNode<ItemType, BoundsTraits> bnd(queries[i].second, queries[i].first);
+            td.nearestNeighbours(*getRoot(), bnd, k, maxDistance, result);
+            visitor(i, result);
+        }
+    }
+
     /// @}
     /// \defgroup query Query
     /// @{
@@ -265,9 +321,12 @@ public:
             build();
         }
 
+        geos::util::Stats::Timer timer(geos::util::Stats::INDEX_QUERY);
         if (root && root->boundsIntersect(queryEnv)) {
             if (root->isLeaf()) {
-                visitLeaf(visitor, *root);
+                if (!root->isDeleted()) {
+                    visitLeaf(visitor, *root);
+                }
             } else {
                 query(queryEnv, *root, visitor);
             }
@@ -301,6 +360,60 @@ public:
         }
     }
 
+    /// @}
+    /// \defgroup join Join
+    /// @{
+
+    // Visit each pair of items from this tree and `other` whose bounds intersect,
+    // by traversing the two trees together. As with `query`, the visitor
+    // is called with `(const ItemType&, const ItemType&)` and may return
+    // false to stop the join.
+    template<typename Visitor>
+    void join(TemplateSTRtreeImpl& other, Visitor&& visitor) {
+        auto isNear = [](const BoundsType& a, const BoundsType& b) {
+            return BoundsTraits::intersects(a, b);
+        };
+        if (getRoot() && other.getRoot()) {
+            join(*root, *other.root, isNear, visitor);
+        }
+    }
+
+    // Visit each pair of items from this tree and `other` whose bounds
+    // are no further apart than `maxDistance`.
+    template<typename Visitor>
+    void join(TemplateSTRtreeImpl& other, double maxDistance, Visitor&& visitor) {
+        auto isNear = [maxDistance](const BoundsType& a, const BoundsType& b) {
+            return BoundsTraits::distance(a, b) <= maxDistance;
+        };
+        if (getRoot() && other.getRoot()) {
+            join(*root, *other.root, isNear, visitor);
+        }
+    }
+
+    // Visit each pair of distinct items in this tree whose bounds intersect.
+    // Each pair is visited once.
+    template<typename Visitor>
+    void selfJoin(Visitor&& visitor) {
+        auto isNear = [](const BoundsType& a, const BoundsType& b) {
+            return BoundsTraits::intersects(a, b);
+        };
+        if (getRoot()) {
+            selfJoin(*root, isNear, visitor);
+        }
+    }
+
+    // Visit each pair of distinct items in this tree whose bounds
+    // are no further apart than `maxDistance`. Each pair is visited once.
+    template<typename Visitor>
+    void selfJoin(double maxDistance, Visitor&& visitor) {
+        auto isNear = [maxDistance](const BoundsType& a, const BoundsType& b) {
+            return BoundsTraits::distance(a, b) <= maxDistance;
+        };
+        if (getRoot()) {
+            selfJoin(*root, isNear, visitor);
+        }
+    }
+
     /// @}
     /// \defgroup remove Item removal
     /// @{
@@ -350,6 +463,7 @@ public:
             return;
         }
 
+        geos::util::Stats::Timer timer(geos::util::Stats::INDEX_BUILD);
         numItems = nodes.size();
 
         // compute final size of tree and set it aside in a single
@@ -535,8 +649,75 @@ protected:
     }
 #endif
 
+    // Helper functions to visit a pair of items, as for visitLeaf
+    template<typename Visitor,
+             typename std::enable_if<std::is_void<decltype(std::declval<Visitor>()(std::declval<ItemType>(), std::declval<ItemType>()))>::value, std::nullptr_t>::type = nullptr >
+    bool visitPair(Visitor&& visitor, const Node& node1, const Node& node2)
+    {
+        visitor(node1.getItem(), node2.getItem());
+        return true;
+    }
+
+    template<typename Visitor,
+             typename std::enable_if<!std::is_void<decltype(std::declval<Visitor>()(std::declval<ItemType>(), std::declval<ItemType>()))>::value, std::nullptr_t>::type = nullptr>
+    bool visitPair(Visitor&& visitor, const Node& node1, const Node& node2)
+    {
+        return visitor(node1.getItem(), node2.getItem());
+    }
+
+    // Joins the items under two nodes.
+    // Returns false if the join was stopped by the visitor
+    template<typename IsNear, typename Visitor>
+    bool join(const Node& node1, const Node& node2, IsNear& isNear, Visitor&& visitor) {
+        if (node1.isDeleted() || node2.isDeleted() || !isNear(node1.getBounds(), node2.getBounds())) {
+            return true;
+        }
+        if (node1.isLeaf() && node2.isLeaf()) {
+            return visitPair(visitor, node1, node2);
+        }
+
+        // expand the larger node
+        bool isExpand1 = !node1.isLeaf() &&
+                         (node2.isLeaf() || node1.getSize() >= node2.getSize());
+        if (isExpand1) {
+            for (auto *child = node1.beginChildren(); child < node1.endChildren(); ++child) {
+                if (!join(*child, node2, isNear, visitor)) {
+                    return false;
+                }
+            }
+        } else {
+            for (auto *child = node2.beginChildren(); child < node2.endChildren(); ++child) {
+                if (!join(node1, *child, isNear, visitor)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Joins the items under a node with each other.
+    // Returns false if the join was stopped by the visitor
+    template<typename IsNear, typename Visitor>
+    bool selfJoin(const Node& node, IsNear& isNear, Visitor&& visitor) {
+        if (node.isLeaf()) {
+            return true;
+        }
+        for (auto *child = node.beginChildren(); child < node.endChildren(); ++child) {
+            if (!selfJoin(*child, isNear, visitor)) {
+                return false;
+            }
+            for (auto *other = child + 1; other < node.endChildren(); ++other) {
+                if (!join(*child, *other, isNear, visitor)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Returns false if the query was stopped by the visitor
     template<typename Visitor>
-    void query(const BoundsType& queryEnv,
+    bool query(const BoundsType& queryEnv,
                const Node& node,
                Visitor&& visitor) {
 
@@ -544,15 +725,16 @@ protected:
 
         for (auto *child = node.beginChildren(); child < node.endChildren(); ++child) {
             if (child->boundsIntersect(queryEnv)) {
-                if (child->isLeaf() && !child->isDeleted()) {
-                    if (!visitLeaf(visitor, *child)) {
-                        return;
+                if (child->isLeaf()) {
+                    if (!child->isDeleted() && !visitLeaf(visitor, *child)) {
+                        return false;
                     }
-                } else {
-                    query(queryEnv, *child, visitor);
+                } else if (!query(queryEnv, *child, visitor)) {
+                    return false;
                 }
             }
         }
+        return true;
     }
 
     bool remove(const BoundsType& queryEnv,
@@ -589,6 +771,44 @@ protected:
         return static_cast<size_t>(std::ceil(std::sqrt(minLeafCount)));
     }
 
+    /// Returns the indexes of a list of query items, sorted in Hilbert order of their bounds
+    static std::vector<std::size_t> hilbertOrder(const std::vector<std::pair<BoundsType, ItemType>>& queries) {
+        using shape::fractal::HilbertCode;
+
+        double minX = std::numeric_limits<double>::infinity();
+        double minY = minX;
+        double maxX = -minX;
+        double maxY = -minX;
+        for (const auto& q : queries) {
+            minX = std::min(minX, BoundsTraits::getX(q.first));
+            minY = std::min(minY, BoundsTraits::getY(q.first));
+            maxX = std::max(maxX, BoundsTraits::getX(q.first));
+            maxY = std::max(maxY, BoundsTraits::getY(q.first));
+        }
+        double maxOrd = static_cast<double>(HilbertCode::maxOrdinate(HilbertCode::MAX_LEVEL));
+        double scaleX = maxX > minX ? maxOrd / (maxX - minX) : 0;
+        double scaleY = maxY > minY ? maxOrd / (maxY - minY) : 0;
+
+        std::vector<std::pair<uint32_t, std::size_t>> codes;
+        codes.reserve(queries.size());
+        for (std::size_t i = 0; i < queries.size(); i++) {
+            // non-finite bounds are placed at the start
+            double x = (BoundsTraits::getX(queries[i].first) - minX) * scaleX;
+            double y = (BoundsTraits::getY(queries[i].first) - minY) * scaleY;
+            auto ix = std::isfinite(x) ? static_cast<uint32_t>(x) : 0;
+            auto iy = std::isfinite(y) ? static_cast<uint32_t>(y) : 0;
+            codes.emplace_back(HilbertCode::encode(HilbertCode::MAX_LEVEL, ix, iy), i);
+        }
+        std::sort(codes.begin(), codes.end());
+
+        std::vector<std::size_t> order;
+        order.reserve(codes.size());
+        for (const auto& c : codes) {
+            order.push_back(c.second);
+        }
+        return order;
+    }
+
     static size_t sliceCapacity(size_t numNodes, size_t numSlices) {
         return static_cast<size_t>(std::ceil(static_cast<double>(numNodes) / static_cast<double>(numSlices)));
     }
@@ -17,7 +17,9 @@
 #include <geos/index/strtree/TemplateSTRNode.h>
 #include <geos/index/strtree/TemplateSTRNodePair.h>
 
+#include <algorithm>
 #include <queue>
+#include <utility>
 #include <vector>
 
 namespace geos {
@@ -50,6 +52,81 @@ public:
         return nearestNeighbour(initPair, std::numeric_limits<double>::infinity());
     }
 
+    /**
+     * Finds the k items of a tree nearest to a query item,
+     * in order of increasing distance.
+     * Items further than maxDistance are not returned.
+     *
+     * The search queue is kept between calls, so an instance
+     * can be reused efficiently for many queries.
+     *
+     * @param root the root of the tree to search
+     * @param query a leaf node holding the query item
+     * @param k the maximum number of items to find
+     * @param maxDistance the maximum distance of an item
+     * @param result the items found and their distances
+     */
+    void nearestNeighbours(const Node& root, const Node& query, std::size_t k, double maxDistance,
+                           std::vector<std::pair<ItemType, double>>& result) {
+        result.clear();
+        if (k == 0 || root.isDeleted()) {
+            return;
+        }
+
+        // result is a max-heap on distance until the search is finished
+        auto isCloser = [](const std::pair<ItemType, double>& a, const std::pair<ItemType, double>& b) {
+            return a.second < b.second;
+        };
+        auto isCandidate = [&](double dist) {
+            return dist <= maxDistance && (result.size() < k || dist < result.front().second);
+        };
+
+        m_queue.clear();
+        if (!isCandidate(BoundsType::distance(root.getBounds(), query.getBounds()))) {
+            return;
+        }
+        m_queue.emplace_back(root, query, m_id);
+
+        while (!m_queue.empty()) {
+            std::pop_heap(m_queue.begin(), m_queue.end(), PairQueueCompare());
+            NodePair pair = m_queue.back();
+            m_queue.pop_back();
+
+            // all remaining pairs are at least as far away
+            if (!isCandidate(pair.getDistance())) {
+                break;
+            }
+
+            if (pair.isLeaves()) {
+                result.emplace_back(pair.getFirst().getItem(), pair.getDistance());
+                std::push_heap(result.begin(), result.end(), isCloser);
+                if (result.size() > k) {
+                    std::pop_heap(result.begin(), result.end(), isCloser);
+                    result.pop_back();
+                }
+                continue;
+            }
+
+            const Node& node = pair.getFirst();
+            for (const auto* child = node.beginChildren(); child < node.endChildren(); ++child) {
+                if (child->isDeleted()) {
+                    continue;
+                }
+                // check the bounds before computing a (possibly expensive) item distance
+                if (!isCandidate(BoundsType::distance(child->getBounds(), query.getBounds()))) {
+                    continue;
+                }
+                NodePair childPair(*child, query, m_id);
+                if (isCandidate(childPair.getDistance())) {
+                    m_queue.push_back(childPair);
+                    std::push_heap(m_queue.begin(), m_queue.end(), PairQueueCompare());
+                }
+            }
+        }
+
+        std::sort_heap(result.begin(), result.end(), isCloser);
+    }
+
 private:
 
     ItemPair nearestNeighbour(NodePair& initPair, double maxDistance) {
@@ -152,6 +229,7 @@ private:
     }
 
     ItemDistance& m_id;
+    std::vector<NodePair> m_queue;
 };
 }
 }
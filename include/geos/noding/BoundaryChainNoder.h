@@ -0,0 +1,132 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/noding/Noder.h>
+#include <geos/geom/Coordinate.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace noding {
+class SegmentString;
+}
+}
+
+namespace geos {
+namespace noding { // geos.noding
+
+/**
+ * A noder which extracts chains of boundary segments
+ * as {@link SegmentString}s from a polygonal coverage.
+ *
+ * Boundary segments are those which are not duplicated in the input.
+ * The segment strings are split at vertices where more
+ * than two boundary segments meet,
+ * so that the output is fully noded if the input is a valid coverage.
+ *
+ * This is used to compute the union of a polygonal coverage
+ * in time linear in the number of segments,
+ * since segments shared between adjacent polygons
+ * are removed before the overlay graph is built.
+ *
+ * The noder does not check that the input is a valid coverage.
+ * If it is not (e.g. it contains overlapping polygons,
+ * or adjacent edges which are not matched exactly),
+ * the output may not be correctly noded.
+ * Wrap it in a {@link ValidatingNoder} to detect this.
+ *
+ * Zero-length segments are ignored.
+ *
+ * @see ValidatingNoder
+ */
+class GEOS_DLL BoundaryChainNoder : public Noder {
+
+private:
+
+    class Segment {
+    public:
+        Segment(const geom::Coordinate& p_p0, const geom::Coordinate& p_p1,
+                std::size_t p_ssIndex, std::size_t p_index)
+            : ssIndex(p_ssIndex)
+            , index(p_index)
+        {
+            // normalize, so that shared segments compare equal
+            if (p_p1.compareTo(p_p0) < 0) {
+                p0 = p_p1;
+                p1 = p_p0;
+            }
+            else {
+                p0 = p_p0;
+                p1 = p_p1;
+            }
+        }
+
+        bool operator==(const Segment& other) const
+        {
+            return p0.equals2D(other.p0) && p1.equals2D(other.p1);
+        }
+
+        struct HashCode {
+            std::size_t operator()(const Segment& s) const
+            {
+                geom::Coordinate::HashCode coordHash;
+                std::size_t h = coordHash(s.p0);
+                h ^= coordHash(s.p1) + 0x9e3779b9 + (h << 6) + (h >> 2);
+                return h;
+            }
+        };
+
+        geom::Coordinate p0;
+        geom::Coordinate p1;
+        std::size_t ssIndex;
+        std::size_t index;
+    };
+
+    typedef std::unordered_set<Segment, Segment::HashCode> SegmentSet;
+    typedef std::unordered_map<geom::Coordinate, std::size_t, geom::Coordinate::HashCode> VertexDegreeMap;
+
+    mutable std::vector<SegmentString*>* chainList;
+
+    static void addSegments(std::vector<SegmentString*>* segStrings,
+        SegmentSet& segSet);
+
+    void extractChains(const SegmentString* ss,
+        const std::vector<bool>& isBoundary,
+        const VertexDegreeMap& degree);
+
+public:
+
+    BoundaryChainNoder()
+        : chainList(nullptr)
+    {}
+
+    ~BoundaryChainNoder() override;
+
+    void computeNodes(std::vector<SegmentString*>* segStrings) override;
+
+    /**
+    * Returns the boundary chains computed by computeNodes().
+    * Ownership of the vector and its elements passes to the caller.
+    */
+    std::vector<SegmentString*>* getNodedSubstrings() const override;
+
+};
+
+} // namespace geos.noding
+} // namespace geos
+
@@ -46,12 +46,14 @@ namespace noding { // geos::noding
  * against a target set of lines.
  * Short-circuited to return as soon an intersection is found.
  *
+ * The index is built by the constructor, and the tests do not change
+ * it, so they can be run by several threads at once.
+ *
  * @version 1.7
  */
 class FastSegmentSetIntersectionFinder {
 private:
     std::unique_ptr<MCIndexSegmentSetMutualIntersector> segSetMutInt;
-    std::unique_ptr<geos::algorithm::LineIntersector> lineIntersector;
 
 protected:
 public:
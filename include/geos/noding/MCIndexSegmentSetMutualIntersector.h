@@ -78,6 +78,19 @@ public:
     // NOTE: re-populates the MonotoneChain vector with newly created chains
     void process(SegmentString::ConstVect* segStrings) override;
 
+    /**
+     * Computes the intersections of a set of segment strings with the
+     * base segments, reporting them to a given SegmentIntersector.
+     *
+     * Unlike process(SegmentString::ConstVect*), this does not change
+     * the state of the intersector once the index is built, so it can
+     * be called by several threads at once after buildIndex().
+     */
+    void process(SegmentString::ConstVect* segStrings, SegmentIntersector* si);
+
+    /// Builds the index of the base segments, if it is not built yet
+    void buildIndex();
+
     class SegmentOverlapAction : public index::chain::MonotoneChainOverlapAction {
     private:
         SegmentIntersector& si;
@@ -126,9 +139,10 @@ private:
 
     void addToIndex(SegmentString* segStr);
 
-    void intersectChains();
+    /// Returns the number of overlapping chains
+    int intersectChains(MonoChains& queryChains, SegmentIntersector& si);
 
-    void addToMonoChains(SegmentString* segStr);
+    static void addToMonoChains(SegmentString* segStr, MonoChains& chains);
 
 };
 
@@ -39,6 +39,8 @@ namespace geos {
 namespace geom {
 class PrecisionModel;
 class Geometry;
+class MultiPoint;
+class CoordinateSequence;
 }
 }
 
@@ -134,6 +136,35 @@ private:
 
     void bufferFixedPrecision(const geom::PrecisionModel& fixedPM);
 
+    /**
+     * Computes the buffer directly from the raw offset curves
+     * for inputs whose curves are known to be simple and
+     * mutually disjoint, bypassing noding and graph construction.
+     *
+     * The handled cases are a positive buffer of:
+     * - a Point
+     * - a MultiPoint whose buffers do not interact
+     * - a two-point LineString
+     * - a Polygon with a convex shell and no holes
+     *
+     * @return the buffer, or null if the input is not one of
+     *         the simple cases
+     */
+    std::unique_ptr<geom::Geometry> bufferSimple();
+
+    /**
+     * Tests whether the buffers of the given points,
+     * computed at the current distance, are pairwise disjoint.
+     */
+    bool isBufferDisjoint(const geom::MultiPoint* mp) const;
+
+    /**
+     * Tests whether a closed ring (without repeated points) is
+     * strictly convex, i.e. turns consistently in one direction
+     * and winds around its interior only once.
+     */
+    static bool isConvex(const geom::CoordinateSequence* ring);
+
     /**
     * Combines the elements of two polygonal geometries together.
     * The input geometries must be non-adjacent, to avoid
@@ -71,6 +71,9 @@ public:
 
     double distance(const FacetSequence& facetSeq) const;
 
+    /// Computes the distance from a point to the facets of this sequence
+    double distance(const geom::Coordinate& pt) const;
+
     FacetSequence(const geom::CoordinateSequence* pts, std::size_t start, std::size_t end);
 
     FacetSequence(const geom::Geometry* geom, const geom::CoordinateSequence* pts, std::size_t start, std::size_t end);
@@ -86,6 +86,17 @@ public:
     /// \return the computed distance
     double distance(const geom::Geometry* g) const;
 
+    /// \brief Computes the distance from the base geometry to a point.
+    ///
+    /// This is equivalent to computing the distance to a Point geometry,
+    /// but does not allocate memory, so it is suitable for evaluating
+    /// many points.
+    ///
+    /// \param pt the point to compute the distance to
+    ///
+    /// \return the computed distance
+    double distance(const geom::Coordinate& pt) const;
+
     /// \brief Computes the nearest locations on the base geometry and the given geometry.
     ///
     /// \param g the geometry to compute the nearest location to
@@ -0,0 +1,158 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OP_RECTANGLE_GRID_INTERSECTION_H
+#define GEOS_OP_RECTANGLE_GRID_INTERSECTION_H
+
+#include <geos/export.h>
+
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+namespace operation {
+namespace intersection {
+class Rectangle;
+}
+}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace intersection { // geos::operation::intersection
+
+/**
+ * \brief
+ * Clips a [Geometry](@ref geom::Geometry) to every tile of a regular grid.
+ *
+ * The grid is defined by an origin and a cell size. The tile in column `col`
+ * and row `row` covers the rectangle from
+ * `(originX + col * cellWidth, originY + row * cellHeight)` to
+ * `(originX + (col + 1) * cellWidth, originY + (row + 1) * cellHeight)`,
+ * expanded on all sides by an optional buffer distance.
+ * Rows increase with Y.
+ *
+ * The result for each tile is the same as clipping the geometry with
+ * RectangleIntersection::clip, but the geometry is not traversed
+ * once per tile. Instead the range of tiles covering the geometry is
+ * split in half recursively, and the geometry is clipped to each half.
+ * Each level of the recursion only processes the part of the geometry
+ * inside its range, so a vertex is visited a number of times proportional
+ * to the logarithm of the number of tiles. Tiles in the interior of a
+ * polygon are produced from a clipped geometry which is just the
+ * enclosing rectangle, so they are cheap.
+ *
+ * The input geometry must be valid, as for RectangleIntersection.
+ */
+class GEOS_DLL RectangleGridIntersection {
+
+public:
+
+    /// The clipped part of the geometry in a tile
+    struct Tile {
+        int col;
+        int row;
+        std::unique_ptr<geom::Geometry> geom;
+    };
+
+    /**
+     * \brief Creates a clipper for a grid.
+     *
+     * @param originX the x-coordinate of the left edge of column 0
+     * @param originY the y-coordinate of the bottom edge of row 0
+     * @param cellWidth the width of a tile
+     * @param cellHeight the height of a tile
+     * @param buffer the distance by which each tile is expanded
+     * @throws IllegalArgumentException if the cell size is not positive
+     *         or the buffer is negative
+     */
+    RectangleGridIntersection(double originX, double originY,
+                              double cellWidth, double cellHeight,
+                              double buffer = 0.0);
+
+    /**
+     * \brief Clips a geometry to every tile it intersects.
+     *
+     * Tiles for which the clipped geometry is empty are not returned.
+     * The tiles are returned in no particular order.
+     *
+     * @param geom a [Geometry](@ref geom::Geometry)
+     * @return the non-empty clipped parts of the geometry
+     * @throws IllegalArgumentException if the tile indexes of the geometry
+     *         do not fit in an int
+     */
+    std::vector<Tile> clip(const geom::Geometry& geom) const;
+
+    /**
+     * \brief Clips a geometry to every tile of a grid it intersects.
+     *
+     * @see clip(const geom::Geometry&) const
+     */
+    static std::vector<Tile> clip(const geom::Geometry& geom,
+                                  double originX, double originY,
+                                  double cellWidth, double cellHeight,
+                                  double buffer = 0.0);
+
+private:
+
+    /// A half-open range of tile columns and rows
+    struct TileRange {
+        int col0;
+        int col1;
+        int row0;
+        int row1;
+
+        bool isSingle() const
+        {
+            return col1 - col0 == 1 && row1 - row0 == 1;
+        }
+    };
+
+    double originX;
+    double originY;
+    double cellWidth;
+    double cellHeight;
+    double buffer;
+
+    /// The rectangle covering a range of tiles, including the buffer
+    Rectangle getRectangle(const TileRange& range) const;
+
+    /// Converts a coordinate offset to a tile index, checking for overflow
+    static int toIndex(double offset);
+
+    /// Clips a geometry which lies in a range of tiles to both halves of the range
+    void clipHalves(const geom::Geometry& geom, const TileRange& range,
+                    std::vector<Tile>& tiles) const;
+
+    void clipRange(const geom::Geometry& geom, const TileRange& range,
+                   std::vector<Tile>& tiles) const;
+
+}; // class RectangleGridIntersection
+
+} // namespace geos::operation::intersection
+} // namespace geos::operation
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_OP_RECTANGLE_GRID_INTERSECTION_H
@@ -0,0 +1,197 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OP_INTERSECTION_TILEENCODER_H
+#define GEOS_OP_INTERSECTION_TILEENCODER_H
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/PrecisionModel.h>
+
+#include <cstdint>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class LineString;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace intersection { // geos::operation::intersection
+
+/**
+ * \brief
+ * Prepares a [Geometry](@ref geom::Geometry) for a vector tile,
+ * producing integer tile coordinates.
+ *
+ * The geometry is clipped to the tile (expanded by a buffer) with
+ * RectangleIntersection. The coordinates of the clipped geometry are
+ * transformed to the integer grid of the tile, with the origin at the
+ * top left corner and Y increasing downwards, and rounded with a
+ * PrecisionModel. Repeated points are removed, and lines and rings are
+ * optionally simplified with the Douglas-Peucker algorithm in tile units.
+ * Points, lines and rings which collapse are dropped, along with the holes
+ * of dropped shells.
+ *
+ * Rings are oriented following the Mapbox Vector Tile specification:
+ * shells have a positive area computed with the surveyor's formula in
+ * tile coordinates (clockwise as displayed), and holes a negative area.
+ * Rounding can make a polygon invalid; if validity fixing is enabled
+ * (the default) such polygons are repaired with GeometryFixer and rounded again.
+ *
+ * The result is written to coordinate and part arrays which can be passed
+ * directly to an encoder. Apart from the clipped geometry, no Geometry
+ * objects are created unless a polygon needs to be checked for validity.
+ */
+class GEOS_DLL TileEncoder {
+
+public:
+
+    /// The geometry types of the Mapbox Vector Tile specification
+    enum GeomType {
+        UNKNOWN = 0,
+        POINT = 1,
+        LINESTRING = 2,
+        POLYGON = 3
+    };
+
+    /// A geometry in tile coordinates
+    struct Result {
+        /// The type of the geometry
+        GeomType type = UNKNOWN;
+        /// The X and Y of each point, interleaved
+        std::vector<int32_t> coords;
+        /// The number of points in each part.
+        /// Points have a single part, lines one part per line,
+        /// polygons one part per ring (shells followed by their holes).
+        /// Rings are not closed; the last point is not repeated.
+        std::vector<uint32_t> parts;
+
+        bool isEmpty() const
+        {
+            return parts.empty();
+        }
+
+        void clear()
+        {
+            type = UNKNOWN;
+            coords.clear();
+            parts.clear();
+        }
+    };
+
+    /**
+     * \brief Creates an encoder for a tile.
+     *
+     * @param tileEnv the extent of the tile in the coordinates of the input
+     * @param extent the size of the tile grid
+     * @param buffer the size of the tile buffer, in grid units
+     * @throws IllegalArgumentException if the tile envelope is empty,
+     *         the extent is zero, or the grid coordinates of the buffered
+     *         tile do not fit in an int32_t
+     */
+    TileEncoder(const geom::Envelope& tileEnv, uint32_t extent = 4096, uint32_t buffer = 64);
+
+    /**
+     * \brief Sets the Douglas-Peucker simplification tolerance, in grid units.
+     *
+     * The default of zero disables simplification.
+     *
+     * @param tolerance the simplification tolerance
+     * @throws IllegalArgumentException if the tolerance is negative
+     */
+    void setSimplifyTolerance(double tolerance);
+
+    /**
+     * \brief Sets whether polygons made invalid by rounding are repaired.
+     *
+     * @param isFixValidity whether invalid polygons are repaired
+     */
+    void
+    setFixValidity(bool isFixValidity)
+    {
+        fixValidity = isFixValidity;
+    }
+
+    /**
+     * \brief Encodes a geometry.
+     *
+     * The result type is that of the highest dimension in the geometry;
+     * components of lower dimension are dropped.
+     *
+     * @param geom the geometry to encode
+     * @param result the result, which is cleared first
+     *        (so that its storage can be reused)
+     */
+    void encode(const geom::Geometry& geom, Result& result) const;
+
+private:
+
+    typedef std::vector<geom::Coordinate> CoordsVect;
+
+    geom::Envelope tileEnv;
+    double extent;
+    double buffer;
+    double scaleX;
+    double scaleY;
+    geom::PrecisionModel pm;
+    double simplifyTolerance;
+    bool fixValidity;
+
+    /// Transforms and rounds the coordinates of a line or ring
+    void toTile(const geom::LineString& line, CoordsVect& pts) const;
+
+    /// Removes repeated points, and simplifies if required
+    void reduce(CoordsVect& pts, bool isRing) const;
+
+    void encodePoints(const geom::Geometry& geom, Result& result) const;
+
+    void encodeLines(const geom::Geometry& geom, Result& result) const;
+
+    void encodePolygons(const geom::Geometry& geom, Result& result) const;
+
+    /// Encodes a polygon already in tile coordinates
+    void encodePolygon(std::vector<CoordsVect>& rings, Result& result) const;
+
+    /// Repairs an invalid polygon in tile coordinates
+    void fixPolygon(const geom::Polygon& poly, Result& result) const;
+
+    /// Converts a rounded grid ordinate, clamped to the buffered tile
+    int32_t toGrid(double v) const;
+
+    void addPart(const CoordsVect& pts, std::size_t n, Result& result) const;
+
+    /// Twice the signed area of a ring, with Y increasing downwards
+    static double signedArea(const CoordsVect& ring);
+
+}; // class TileEncoder
+
+} // namespace geos::operation::intersection
+} // namespace geos::operation
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_OP_INTERSECTION_TILEENCODER_H
@@ -0,0 +1,105 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class Polygon;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+/**
+ * Unions a polygonal coverage in an efficient way,
+ * using {@link OverlayNG}.
+ *
+ * A polygonal coverage is a set of polygons which
+ * do not overlap, and where adjacent polygons
+ * share exactly the same edges (i.e. are fully noded).
+ * Segments which occur in two polygons are interior to the
+ * union, and are removed in linear time by a
+ * {@link noding::BoundaryChainNoder} before the
+ * overlay graph is built.
+ * This is much faster than a full unary union for
+ * tiled inputs such as cadastral parcels or census blocks.
+ *
+ * The coverage assumption is checked cheaply,
+ * by validating the noding of the remaining boundary chains
+ * and comparing the area of the result with that of the input.
+ * The input is processed in clusters of polygons with
+ * interacting envelopes, and a cluster which is not a valid coverage
+ * is unioned using {@link OverlayNGRobust} instead,
+ * so that partially clean inputs are still handled correctly.
+ *
+ * Non-polygonal inputs are unioned using {@link OverlayNGRobust}.
+ */
+class GEOS_DLL CoverageUnion {
+
+private:
+
+    /**
+    * The maximum relative difference between the input and
+    * result areas allowed for a valid coverage.
+    */
+    static constexpr double AREA_PCT_DIFF_TOL = 1e-6;
+
+    /**
+    * Groups the polygonal components of a geometry into
+    * clusters whose envelopes interact.
+    */
+    static std::vector<std::vector<const geom::Polygon*>>
+    cluster(const geom::Geometry* geom);
+
+    /**
+    * Unions a geometry assuming it is a valid coverage.
+    *
+    * @return the union, or null if the geometry is not a valid coverage
+    */
+    static std::unique_ptr<geom::Geometry>
+    unionCoverage(const geom::Geometry* geom);
+
+    /**
+    * Unions a cluster of a coverage, falling back to a
+    * full robust union if it is not a valid coverage.
+    */
+    static std::unique_ptr<geom::Geometry>
+    unionCluster(const geom::Geometry* geom);
+
+public:
+
+    /**
+    * Unions a polygonal coverage.
+    *
+    * @param coverage the coverage to union
+    * @return the union of the coverage
+    */
+    static std::unique_ptr<geom::Geometry>
+    geomunion(const geom::Geometry* coverage);
+
+};
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
+
@@ -51,6 +51,7 @@
 #include <array>
 #include <memory>
 #include <deque>
+#include <string>
 
 using namespace geos::geom;
 using namespace geos::noding;
@@ -93,6 +94,8 @@ private:
     const Envelope* clipEnv;
     std::unique_ptr<RingClipper> clipper;
     std::unique_ptr<LineLimiter> limiter;
+    bool isThrowOnInvalidNoding;
+    std::string nodingError;
 
     // For use in createFloatingPrecisionNoder()
     LineIntersector lineInt;
@@ -201,6 +204,7 @@ public:
         , customNoder(p_customNoder)
         , hasEdges{{false,false}}
         , clipEnv(nullptr)
+        , isThrowOnInvalidNoding(true)
         , intAdder(lineInt)
         {};
 
@@ -213,6 +217,37 @@ public:
 
     void setClipEnvelope(const Envelope* clipEnv);
 
+    /**
+    * Sets whether an invalid floating-precision noding
+    * throws a TopologyException (the default).
+    * If not, the failure is recorded and reported by
+    * isNodingValid(), and no edges are built.
+    * This lets callers which have a fallback strategy
+    * avoid the cost of exception unwinding.
+    */
+    void setThrowOnInvalidNoding(bool p_isThrow)
+    {
+        isThrowOnInvalidNoding = p_isThrow;
+    }
+
+    /**
+    * Reports whether the computed noding was valid.
+    * Only meaningful when throwing on invalid noding is disabled.
+    */
+    bool isNodingValid() const
+    {
+        return nodingError.empty();
+    }
+
+    /**
+    * Gets a description of the noding failure,
+    * or an empty string if the noding is valid.
+    */
+    const std::string& getNodingError() const
+    {
+        return nodingError;
+    }
+
     // returns newly allocated vector and segmentstrings
     // std::vector<SegmentString*>* node();
 
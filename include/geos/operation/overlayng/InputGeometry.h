@@ -49,6 +49,8 @@ private:
     std::array<const Geometry*, 2> geom;
     std::unique_ptr<PointOnGeometryLocator> ptLocatorA;
     std::unique_ptr<PointOnGeometryLocator> ptLocatorB;
+    // Externally supplied (e.g. prepared) locators, not owned
+    std::array<PointOnGeometryLocator*, 2> ptLocatorExt;
     std::array<bool, 2> isCollapsed;
 
 
@@ -91,6 +93,16 @@ public:
     Location locatePointInArea(uint8_t geomIndex, const Coordinate& pt);
 
     PointOnGeometryLocator* getLocator(uint8_t geomIndex);
+
+    /**
+    * Sets a locator to use for an area input instead of building one.
+    * This allows an index built once for a fixed geometry to be
+    * reused across many overlays.
+    *
+    * @param geomIndex the index of the geometry
+    * @param locator the locator for the geometry (not owned)
+    */
+    void setLocator(uint8_t geomIndex, PointOnGeometryLocator* locator);
     void setCollapsed(uint8_t geomIndex, bool isGeomCollapsed);
 
 
@@ -27,10 +27,14 @@
 #include <geos/operation/overlayng/InputGeometry.h>
 #include <geos/export.h>
 
+#include <string>
+
 // Forward declarations
 namespace geos {
 namespace geom {
 class GeometryFactory;
+class LinearRing;
+class Polygon;
 class PrecisionModel;
 }
 namespace noding {
@@ -128,11 +132,39 @@ private:
     bool isOutputEdges;
     bool isOutputResultEdges;
     bool isOutputNodedEdges;
+    bool isThrowOnInvalidNoding;
+    std::string nodingError;
 
     // Methods
     std::unique_ptr<geom::Geometry> computeEdgeOverlay();
     void labelGraph(OverlayGraph* graph);
 
+    /**
+    * Computes a union, difference or symmetric difference of polygonal
+    * inputs by overlaying only the components whose envelopes
+    * interact with the other input.
+    * Components which are disjoint from the other input cannot be
+    * changed by the overlay, so they are copied directly to the result
+    * (or dropped, for the B operand of a difference).
+    *
+    * This is only valid for floating precision without a custom noder,
+    * since rounding or snapping can join envelope-disjoint components.
+    *
+    * @return the overlay result, or null if no component is disjoint
+    */
+    std::unique_ptr<geom::Geometry> computeDisjointOverlay();
+
+    /**
+    * Copies a component which is disjoint from the other input
+    * in the form the overlay would produce it: repeated points
+    * are removed, shells are oriented CW and holes CCW.
+    *
+    * @return the copied polygon, or null if a ring collapses
+    */
+    std::unique_ptr<geom::Polygon> copyDisjointPolygon(const geom::Polygon* poly) const;
+
+    std::unique_ptr<geom::LinearRing> copyDisjointRing(const geom::LinearRing* ring, bool isCCW) const;
+
     /**
     * Extracts the result geometry components from the fully labelled topology graph.
     *
@@ -186,6 +218,7 @@ public:
         , isOutputEdges(false)
         , isOutputResultEdges(false)
         , isOutputNodedEdges(false)
+        , isThrowOnInvalidNoding(true)
     {}
 
     /**
@@ -205,6 +238,7 @@ public:
         , isOutputEdges(false)
         , isOutputResultEdges(false)
         , isOutputNodedEdges(false)
+        , isThrowOnInvalidNoding(true)
     {}
 
     /**
@@ -243,6 +277,32 @@ public:
     void setOutputResultEdges(bool p_isOutputResultEdges) { isOutputResultEdges = p_isOutputResultEdges; }
     void setNoder(noding::Noder* p_noder) { noder = p_noder; }
 
+    /**
+    * Sets a point locator to use for an area input,
+    * instead of building one for each overlay.
+    * The locator must be valid for the input geometry.
+    */
+    void setPointLocator(uint8_t geomIndex, algorithm::locate::PointOnGeometryLocator* locator)
+    {
+        inputGeom.setLocator(geomIndex, locator);
+    }
+
+    /**
+    * Sets whether a floating-precision noding failure throws a
+    * TopologyException (the default).
+    * If not, getResult() returns null on a noding failure,
+    * and the failure is described by getNodingError().
+    * This is cheaper than exception handling for callers
+    * which retry with a more robust strategy.
+    */
+    void setThrowOnInvalidNoding(bool p_isThrow) { isThrowOnInvalidNoding = p_isThrow; }
+
+    /**
+    * Gets a description of the noding failure which caused
+    * getResult() to return null, or an empty string.
+    */
+    const std::string& getNodingError() const { return nodingError; }
+
     void setOutputNodedEdges(bool p_isOutputNodedEdges)
     {
         isOutputEdges = true;
@@ -252,7 +312,8 @@ public:
     /**
      * Gets the result of the overlay operation.
      *
-     * @return the result of the overlay operation.
+     * @return the result of the overlay operation,
+     *         or null if noding failed and throwing on invalid noding is disabled
      *
      * @throws IllegalArgumentException if the input is not supported (e.g. a mixed-dimension geometry)
      * @throws TopologyException if a robustness error occurs
@@ -74,6 +74,8 @@ private:
     */
     static constexpr double SNAP_TOL_FACTOR = 1e12;
 
+    static void countStrategy(int strategy);
+
     static std::unique_ptr<Geometry> overlaySnapping(
         const Geometry* geom0, const Geometry* geom1, int opCode, double snapTol);
 
@@ -121,6 +123,21 @@ private:
 
 public:
 
+    /**
+    * The strategies tried by Overlay(), in order.
+    * Used to report which strategy computed the result.
+    */
+    enum Strategy {
+        STRATEGY_FIXED_PRECISION = 0,
+        STRATEGY_FLOATING,
+        STRATEGY_SNAPPING,
+        STRATEGY_SNAP_BOTH,
+        STRATEGY_SNAP_ROUNDING,
+        /// All strategies failed and an exception was thrown
+        STRATEGY_FAILED,
+        NUM_STRATEGIES
+    };
+
     class SRUnionStrategy : public operation::geounion::UnionStrategy {
 
         std::unique_ptr<geom::Geometry> Union(const geom::Geometry* g0, const geom::Geometry* g1) override
@@ -162,6 +179,21 @@ public:
     */
     static double snapTolerance(const Geometry* geom0, const Geometry* geom1);
 
+    /**
+    * Gets the number of overlays computed by the given strategy
+    * since the process started (or the counts were last reset).
+    * Inputs which systematically need the slower fallback
+    * strategies can be identified this way.
+    *
+    * The counts are global and thread-safe.
+    */
+    static std::size_t getStrategyCount(Strategy strategy);
+
+    /**
+    * Resets the counts of all strategies to zero.
+    */
+    static void resetStrategyCounts();
+
 
 
 
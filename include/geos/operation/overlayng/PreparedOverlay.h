@@ -0,0 +1,112 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/geom/Location.h>
+#include <geos/export.h>
+
+#include <memory>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+namespace prep {
+class PreparedGeometry;
+class PreparedPolygon;
+}
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+/**
+ * Computes overlays of many geometries against a single fixed
+ * geometry, reusing the indexes cached by its
+ * [PreparedGeometry](@ref geom::prep::PreparedGeometry).
+ *
+ * For a polygonal prepared geometry each overlay first uses the
+ * prepared segment intersection index (monotone chains of the
+ * fixed geometry's segments) and point-in-area locator to
+ * classify the other geometry. Geometries which do not interact
+ * with the boundary of the fixed geometry lie entirely inside or
+ * outside of it, and their overlay result is produced without
+ * noding. Only geometries crossing the boundary are overlaid,
+ * reusing the prepared locator to place disconnected edges.
+ *
+ * Overlays against other kinds of prepared geometry are computed
+ * with the regular overlay operations.
+ *
+ * As with the prepared predicates, the lazily-built indexes mean
+ * that a PreparedOverlay is not safe to use from several threads
+ * at once.
+ */
+class GEOS_DLL PreparedOverlay {
+
+private:
+
+    const geom::prep::PreparedGeometry& prepGeom;
+    const geom::prep::PreparedPolygon* prepPoly;
+
+    /**
+    * Determines how a geometry lies relative to the prepared polygon.
+    *
+    * @return INTERIOR if the geometry is entirely in the interior,
+    *         EXTERIOR if the two are disjoint,
+    *         BOUNDARY if they interact in any other way
+    */
+    geom::Location locate(const geom::Geometry* g) const;
+
+    std::unique_ptr<geom::Geometry> overlay(const geom::Geometry* g0,
+        const geom::Geometry* g1, int opCode, uint8_t prepIndex) const;
+
+    std::unique_ptr<geom::Geometry> createEmptyResult(int opCode,
+        const geom::Geometry* g0, const geom::Geometry* g1) const;
+
+public:
+
+    /**
+    * Creates an overlay operation for a prepared geometry.
+    *
+    * @param p_prepGeom the prepared geometry (must outlive this object)
+    */
+    PreparedOverlay(const geom::prep::PreparedGeometry& p_prepGeom);
+
+    /**
+    * Computes the intersection of the prepared geometry
+    * with another geometry.
+    *
+    * @param g the geometry to intersect with
+    * @return the intersection
+    */
+    std::unique_ptr<geom::Geometry> intersection(const geom::Geometry* g) const;
+
+    /**
+    * Computes the part of a geometry which is not contained
+    * in the prepared geometry, i.e. `g - prepared`.
+    * This is the operation used to erase a fixed area
+    * from many geometries.
+    *
+    * @param g the geometry to remove the prepared geometry from
+    * @return the difference
+    */
+    std::unique_ptr<geom::Geometry> difference(const geom::Geometry* g) const;
+
+};
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
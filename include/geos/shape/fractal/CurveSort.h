@@ -0,0 +1,171 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Envelope;
+}
+namespace util {
+class Executor;
+}
+}
+
+namespace geos {
+namespace shape {   // geos.shape
+namespace fractal { // geos.shape.fractal
+
+/**
+ * The space-filling curves along which items can be sorted.
+ *
+ * @see HilbertCode
+ * @see MortonCode
+ */
+enum class Curve {
+    HILBERT,
+    MORTON
+};
+
+/**
+ * Computes the order of a list of codes, with a stable radix sort.
+ *
+ * @param codes the codes to sort
+ * @param executor threads sorting large lists in parallel, or nullptr
+ * @param maxThreads the maximum number of threads used, or 0 for all
+ * @return the indexes of the codes, in increasing order of code
+ */
+GEOS_DLL std::vector<std::size_t> sortOrder(const std::vector<uint32_t>& codes,
+                                            util::Executor* executor = nullptr,
+                                            std::size_t maxThreads = 0);
+
+/**
+ * Computes the codes of points on a curve at its maximum level
+ * (2^16 cells along each side) over an extent. Points outside the extent
+ * are given the code of the nearest cell, and points with non-finite
+ * ordinates the code 0.
+ *
+ * @param x the X ordinates of the points
+ * @param y the Y ordinates of the points
+ * @param n the number of points
+ * @param curve the curve
+ * @param extent the extent mapped onto the curve
+ * @param executor threads encoding large lists in parallel, or nullptr
+ * @param maxThreads the maximum number of threads used, or 0 for all
+ * @return the codes of the points
+ */
+GEOS_DLL std::vector<uint32_t> encode(const double* x, const double* y, std::size_t n,
+                                      Curve curve, const geom::Envelope& extent,
+                                      util::Executor* executor = nullptr,
+                                      std::size_t maxThreads = 0);
+
+/**
+ * Computes the order of points along a curve.
+ *
+ * @param x the X ordinates of the points
+ * @param y the Y ordinates of the points
+ * @param n the number of points
+ * @param curve the curve
+ * @param extent the extent mapped onto the curve, or nullptr
+ *        for the extent of the points
+ * @param executor threads sorting large lists in parallel, or nullptr
+ * @param maxThreads the maximum number of threads used, or 0 for all
+ * @return the indexes of the points, in curve order
+ */
+GEOS_DLL std::vector<std::size_t> order(const double* x, const double* y, std::size_t n,
+                                        Curve curve = Curve::HILBERT,
+                                        const geom::Envelope* extent = nullptr,
+                                        util::Executor* executor = nullptr,
+                                        std::size_t maxThreads = 0);
+
+/**
+ * Computes the order of envelopes along a curve, by their centres.
+ * Null envelopes are placed first.
+ *
+ * @param envs the envelopes
+ * @param curve the curve
+ * @param extent the extent mapped onto the curve, or nullptr
+ *        for the extent of the centres of the envelopes
+ * @param executor threads sorting large lists in parallel, or nullptr
+ * @param maxThreads the maximum number of threads used, or 0 for all
+ * @return the indexes of the envelopes, in curve order
+ */
+GEOS_DLL std::vector<std::size_t> order(const std::vector<const geom::Envelope*>& envs,
+                                        Curve curve = Curve::HILBERT,
+                                        const geom::Envelope* extent = nullptr,
+                                        util::Executor* executor = nullptr,
+                                        std::size_t maxThreads = 0);
+
+/**
+ * Sorts geometries along a curve, by the centres of their envelopes.
+ * Empty geometries are placed first, in their original order.
+ *
+ * @param geoms the geometries, as raw or smart pointers, none of which is null
+ * @param curve the curve
+ * @param extent the extent mapped onto the curve, or nullptr
+ *        for the extent of the centres of the envelopes
+ * @param executor threads sorting large lists in parallel, or nullptr
+ * @param maxThreads the maximum number of threads used, or 0 for all
+ */
+template<typename GeometryPtr>
+void
+sort(std::vector<GeometryPtr>& geoms,
+     Curve curve = Curve::HILBERT,
+     const geom::Envelope* extent = nullptr,
+     util::Executor* executor = nullptr,
+     std::size_t maxThreads = 0)
+{
+    std::vector<const geom::Envelope*> envs;
+    envs.reserve(geoms.size());
+    for(const auto& g : geoms) {
+        envs.push_back(g->getEnvelopeInternal());
+    }
+    std::vector<std::size_t> ord = order(envs, curve, extent, executor, maxThreads);
+
+    std::vector<GeometryPtr> sorted;
+    sorted.reserve(geoms.size());
+    for(std::size_t i : ord) {
+        sorted.push_back(std::move(geoms[i]));
+    }
+    geoms.swap(sorted);
+}
+
+/**
+ * Sorts the coordinates of a sequence along a curve.
+ *
+ * @param seq the coordinates
+ * @param curve the curve
+ * @param extent the extent mapped onto the curve, or nullptr
+ *        for the extent of the coordinates
+ * @param executor threads sorting large sequences in parallel, or nullptr
+ * @param maxThreads the maximum number of threads used, or 0 for all
+ */
+GEOS_DLL void sort(geom::CoordinateSequence& seq,
+                   Curve curve = Curve::HILBERT,
+                   const geom::Envelope* extent = nullptr,
+                   util::Executor* executor = nullptr,
+                   std::size_t maxThreads = 0);
+
+
+} // namespace geos.shape.fractal
+} // namespace geos.shape
+} // namespace geos
@@ -33,6 +33,9 @@ namespace geos {
 namespace geom {
 class Coordinate;
 }
+namespace util {
+class Executor;
+}
 }
 
 namespace geos {
@@ -61,6 +64,43 @@ public:
         const CoordsVect& nPts,
         double distanceTolerance);
 
+    /** \brief
+     * Simplifies several lines with the same tolerance.
+     *
+     * The lines are simplified independently of each other,
+     * using the threads of the executor if one is given.
+     *
+     * @param lines the lines to simplify
+     * @param distanceTolerance the approximation tolerance to use
+     * @param executor the threads used, or nullptr
+     * @return the simplified lines, in the same order
+     */
+    static std::vector<CoordsVectAutoPtr> simplify(
+        const std::vector<const CoordsVect*>& lines,
+        double distanceTolerance,
+        util::Executor* executor = nullptr);
+
+    /** \brief
+     * Finds the point of a section of a line
+     * which is furthest from the segment joining its endpoints.
+     *
+     * The distances are computed in blocks, in a loop without branches
+     * which the compiler can vectorize, and are equal to those
+     * computed by algorithm::Distance::pointToSegment.
+     *
+     * @param pts the line points
+     * @param i the index of the start of the section
+     * @param j the index of the end of the section
+     * @param maxDistance set to the distance of the furthest point,
+     *                    or -1 if the section has no interior points
+     * @return the index of the furthest point (the first, if several),
+     *         or i if the section has no interior points
+     */
+    static std::size_t findFurthestPoint(
+        const geom::Coordinate* pts,
+        std::size_t i, std::size_t j,
+        double& maxDistance);
+
     DouglasPeuckerLineSimplifier(const CoordsVect& nPts);
 
     /** \brief
@@ -85,7 +125,8 @@ private:
     BoolVectAutoPtr usePt;
     double distanceTolerance;
 
-    void simplifySection(std::size_t i, std::size_t j);
+    /// The number of distances computed in each block of findFurthestPoint
+    static constexpr std::size_t SCAN_BLOCK_SIZE = 64;
 
     // Declare type as noncopyable
     DouglasPeuckerLineSimplifier(const DouglasPeuckerLineSimplifier& other) = delete;
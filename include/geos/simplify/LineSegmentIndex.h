@@ -16,7 +16,7 @@
  *
  **********************************************************************
  *
- * NOTES
+ * NOTES: the JTS Quadtree has been replaced by STR-packed trees.
  *
  **********************************************************************/
 
@@ -25,7 +25,8 @@
 
 #include <geos/export.h>
 #include <geos/geom/Envelope.h>
-#include <geos/index/quadtree/Quadtree.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
 #include <vector>
 #include <memory> // for unique_ptr
 
@@ -36,9 +37,6 @@
 
 // Forward declarations
 namespace geos {
-namespace geom {
-class LineSegment;
-}
 namespace simplify {
 class TaggedLineString;
 }
@@ -47,13 +45,23 @@ class TaggedLineString;
 namespace geos {
 namespace simplify { // geos::simplify
 
+/** \brief
+ * An index of LineSegments, supporting removal and
+ * insertion interleaved with queries.
+ *
+ * Segments added before the first query are packed into a static STR tree.
+ * Segments added after that go to a small buffer, which is scanned linearly;
+ * when the buffer fills it is packed into a tree, merging trees of equal size
+ * (so that there are at most log(n) trees to query).
+ * Segments are not copied and must outlive the index.
+ */
 class GEOS_DLL LineSegmentIndex {
 
 public:
 
-    LineSegmentIndex() = default;
+    LineSegmentIndex();
 
-    ~LineSegmentIndex() = default;
+    ~LineSegmentIndex();
 
     void add(const TaggedLineString& line);
 
@@ -64,12 +72,72 @@ public:
     std::unique_ptr< std::vector<geom::LineSegment*> >
     query(const geom::LineSegment* seg);
 
+    /** \brief
+     * Visits the segments whose envelopes intersect the envelope of a query segment.
+     *
+     * No memory is allocated.
+     *
+     * @param querySeg the query segment
+     * @param visitor a callable taking a `const LineSegment*` and returning
+     *                `false` to stop the query
+     * @return `false` if the query was stopped by the visitor
+     */
+    template<typename Visitor>
+    bool
+    query(const geom::LineSegment& querySeg, Visitor&& visitor)
+    {
+        geom::Envelope queryEnv(querySeg.p0, querySeg.p1);
+        bool isDone = false;
+        auto treeVisitor = [&visitor, &isDone](const geom::LineSegment* seg) {
+            isDone = !visitor(seg);
+            return !isDone;
+        };
+
+        isStaticBuilt = true;
+        if(numStatic > 0) {
+            staticIndex.query(queryEnv, treeVisitor);
+        }
+        for(const auto& level : levels) {
+            if(isDone) {
+                return false;
+            }
+            if(level) {
+                level->query(queryEnv, treeVisitor);
+            }
+        }
+        if(isDone) {
+            return false;
+        }
+        for(const geom::LineSegment* seg : buffer) {
+            if(geom::Envelope::intersects(seg->p0, seg->p1, querySeg.p0, querySeg.p1)
+                    && !visitor(seg)) {
+                return false;
+            }
+        }
+        return true;
+    }
 
 private:
 
-    index::quadtree::Quadtree index;
+    using SegmentTree = index::strtree::TemplateSTRtree<const geom::LineSegment*>;
+
+    /// The number of segments added after the first query which are not put in a tree
+    static constexpr std::size_t BUFFER_SIZE = 32;
+
+    SegmentTree staticIndex;
+
+    std::size_t numStatic;
+
+    bool isStaticBuilt;
+
+    /// Level k holds either no tree or a tree of BUFFER_SIZE * 2^k segments (some possibly removed)
+    std::vector<std::unique_ptr<SegmentTree>> levels;
+
+    std::vector<const geom::LineSegment*> buffer;
+
+    void addDynamic(const geom::LineSegment* seg);
 
-    std::vector<std::unique_ptr<geom::Envelope>> newEnvelopes;
+    static std::unique_ptr<SegmentTree> buildTree(const std::vector<const geom::LineSegment*>& segs);
 
     /**
      * Disable copy construction and assignment. Apparently needed to make this
@@ -25,6 +25,7 @@
 #define GEOS_SIMPLIFY_TAGGEDLINESTRINGSIMPLIFIER_H
 
 #include <geos/export.h>
+#include <geos/geom/Coordinate.h>
 #include <cstddef>
 #include <vector>
 #include <memory>
@@ -57,7 +58,7 @@ namespace simplify { // geos::simplify
 /** \brief
  * Simplifies a TaggedLineString, preserving topology
  * (in the sense that no new intersections are introduced).
- * Uses the recursive Douglas-Peucker algorithm.
+ * Uses the Douglas-Peucker algorithm, with an explicit stack of sections.
  *
  */
 class GEOS_DLL TaggedLineStringSimplifier {
@@ -101,16 +102,24 @@ private:
 
     const geom::CoordinateSequence* linePts;
 
+    /// contiguous copy of linePts, for fast distance scans
+    std::vector<geom::Coordinate> linePtsVect;
+
     double distanceTolerance;
 
+    struct Section {
+        std::size_t i;
+        std::size_t j;
+        std::size_t depth;
+    };
+
+    /// sections still to be simplified, the next one last
+    std::vector<Section> sections;
+
+    /// Simplifies a section, or pushes its two halves onto the stack
     void simplifySection(std::size_t i, std::size_t j,
                          std::size_t depth);
 
-    static std::size_t findFurthestPoint(
-        const geom::CoordinateSequence* pts,
-        std::size_t i, std::size_t j,
-        double& maxDistance);
-
     bool hasBadIntersection(const TaggedLineString* parentLine,
                             const std::pair<std::size_t, std::size_t>& sectionIndex,
                             const geom::LineSegment& candidateSeg);
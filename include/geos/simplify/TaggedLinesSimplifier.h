@@ -16,10 +16,10 @@
  *
  **********************************************************************
  *
- * NOTES: changed from JTS design adding a private
- *        TaggedLineStringSimplifier member and making
+ * NOTES: changed from JTS design making
  *        simplify(collection) method become a templated
- *        function.
+ *        function, and simplifying clusters of lines
+ *        with interacting envelopes separately.
  *
  **********************************************************************/
 
@@ -31,9 +31,6 @@
 #include <memory>
 #include <cassert>
 
-#include <geos/simplify/LineSegmentIndex.h> // for templated function body
-#include <geos/simplify/TaggedLineStringSimplifier.h>
-
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
@@ -44,6 +41,9 @@ namespace geos {
 namespace simplify {
 class TaggedLineString;
 }
+namespace util {
+class Executor;
+}
 }
 
 namespace geos {
@@ -69,6 +69,14 @@ public:
      */
     void setDistanceTolerance(double tolerance);
 
+    /** \brief
+     * Sets the threads used to simplify independent clusters of lines.
+     *
+     * @param executor the threads used, or nullptr to simplify
+     *        the clusters in the calling thread
+     */
+    void setExecutor(util::Executor* executor);
+
     /** \brief
      * Simplify a set of {@link TaggedLineString}s
      *
@@ -84,29 +92,40 @@ public:
         iterator_type begin,
         iterator_type end)
     {
-        // add lines to the index
+        std::vector<TaggedLineString*> lines;
         for(iterator_type it = begin; it != end; ++it) {
             assert(*it);
-            inputIndex->add(*(*it));
-        }
-
-        // Simplify lines
-        for(iterator_type it = begin; it != end; ++it) {
-            assert(*it);
-            simplify(*(*it));
+            lines.push_back(*it);
         }
+        simplify(lines);
     }
 
+    /** \brief
+     * Simplify a set of {@link TaggedLineString}s.
+     *
+     * Lines are grouped into clusters whose envelopes interact,
+     * and each cluster is simplified with its own segment indexes.
+     * Lines in different clusters cannot intersect,
+     * so the clusters are independent of each other
+     * and are simplified in parallel if an executor is set.
+     *
+     * @param lines the lines to simplify
+     */
+    void simplify(const std::vector<TaggedLineString*>& lines);
 
 private:
 
-    void simplify(TaggedLineString& line);
+    double distanceTolerance;
 
-    std::unique_ptr<LineSegmentIndex> inputIndex;
+    util::Executor* executor;
 
-    std::unique_ptr<LineSegmentIndex> outputIndex;
+    /**
+     * Groups lines into clusters of lines whose envelopes interact
+     * (transitively). The lines in each cluster keep their input order.
+     */
+    static std::vector<std::vector<TaggedLineString*>> cluster(const std::vector<TaggedLineString*>& lines);
 
-    std::unique_ptr<TaggedLineStringSimplifier> taggedlineSimplifier;
+    void simplifyCluster(const std::vector<TaggedLineString*>& lines) const;
 };
 
 } // namespace geos::simplify
@@ -76,6 +76,14 @@ public:
      */
     void setDistanceTolerance(double tolerance);
 
+    /** \brief
+     * Sets the threads used to simplify groups of lines
+     * whose envelopes do not interact.
+     *
+     * @param executor the threads used, or nullptr
+     */
+    void setExecutor(util::Executor* executor);
+
     std::unique_ptr<geom::Geometry> getResultGeometry();
 
 private:
@@ -0,0 +1,166 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: simplify/VWLineSimplifier.java (JTS-1.18)
+ *
+ **********************************************************************
+ *
+ * NOTES: changed from JTS design, keeping the vertices in an
+ *        indexed min-heap instead of rescanning the line after
+ *        every removal.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_SIMPLIFY_VWLINESIMPLIFIER_H
+#define GEOS_SIMPLIFY_VWLINESIMPLIFIER_H
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/LineSegment.h>
+#include <deque>
+#include <limits>
+#include <vector>
+#include <memory> // for unique_ptr
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace algorithm {
+class LineIntersector;
+}
+namespace simplify {
+class LineSegmentIndex;
+}
+}
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+/** \brief
+ * Simplifies a linestring (sequence of points) using
+ * the Visvalingam-Whyatt algorithm.
+ *
+ * The vertex forming the triangle of smallest area with its neighbours
+ * is removed repeatedly, until all triangles have an area of at least
+ * the square of the distance tolerance.
+ * The endpoints are never removed.
+ *
+ * The vertices are kept in a min-heap keyed on triangle area,
+ * so simplification runs in O(n log n) time.
+ * Vertices with equal areas are removed in sequence order.
+ *
+ * If a segment index is provided, a vertex is only removed if the new
+ * segment joining its neighbours does not intersect the interior of
+ * any other segment in the index. Simplifying several lines against a
+ * common index preserves their topology (in the sense that no new
+ * intersections are introduced).
+ */
+class GEOS_DLL VWLineSimplifier {
+
+public:
+
+    typedef std::vector<geom::Coordinate> CoordsVect;
+    typedef std::unique_ptr<CoordsVect> CoordsVectAutoPtr;
+
+    /** \brief
+     * Returns a newly allocated Coordinate vector, wrapped
+     * into an unique_ptr
+     */
+    static CoordsVectAutoPtr simplify(
+        const CoordsVect& nPts,
+        double distanceTolerance);
+
+    VWLineSimplifier(const CoordsVect& nPts, double distanceTolerance);
+
+    ~VWLineSimplifier();
+
+    /** \brief
+     * Sets the minimum number of vertices to keep (default 2).
+     *
+     * @param minSize the minimum output size
+     */
+    void setMinimumSize(std::size_t minSize);
+
+    /** \brief
+     * Adds the segments of the line to an index, and checks
+     * vertex removals against it.
+     *
+     * The index must not be used after this simplifier is destroyed.
+     *
+     * @param index the index of the segments of all lines being simplified
+     */
+    void setSegmentIndex(LineSegmentIndex* index);
+
+    /** \brief
+     * Returns a newly allocated Coordinate vector, wrapped
+     * into an unique_ptr
+     */
+    CoordsVectAutoPtr simplify();
+
+private:
+
+    static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+    const CoordsVect& pts;
+    double areaTolerance;
+    std::size_t minimumSize;
+    LineSegmentIndex* segIndex;
+    std::unique_ptr<algorithm::LineIntersector> li;
+
+    std::vector<std::size_t> prev;
+    std::vector<std::size_t> next;
+    std::vector<double> area;
+    /// A min-heap of vertex indexes, ordered by area
+    std::vector<std::size_t> heap;
+    /// The position of each vertex in the heap, or NONE
+    std::vector<std::size_t> heapPos;
+    /// The current segment starting at each vertex, if indexed
+    std::vector<geom::LineSegment*> nextSeg;
+    std::deque<geom::LineSegment> segments;
+
+    double triangleArea(std::size_t i) const;
+
+    void updateArea(std::size_t i);
+
+    bool isRemovable(std::size_t i);
+
+    void removeVertex(std::size_t i);
+
+    bool isHeapLess(std::size_t a, std::size_t b) const;
+
+    void heapSwap(std::size_t a, std::size_t b);
+
+    void heapUp(std::size_t pos);
+
+    void heapDown(std::size_t pos);
+
+    void heapInsert(std::size_t i);
+
+    void heapRemove(std::size_t i);
+
+    // Declare type as noncopyable
+    VWLineSimplifier(const VWLineSimplifier& other) = delete;
+    VWLineSimplifier& operator=(const VWLineSimplifier& rhs) = delete;
+};
+
+} // namespace geos::simplify
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_SIMPLIFY_VWLINESIMPLIFIER_H
@@ -0,0 +1,113 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: simplify/VWSimplifier.java (JTS-1.18)
+ *
+ **********************************************************************
+ *
+ * NOTES: setPreserveTopology is not in JTS.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_SIMPLIFY_VWSIMPLIFIER_H
+#define GEOS_SIMPLIFY_VWSIMPLIFIER_H
+
+#include <geos/export.h>
+#include <memory> // for unique_ptr
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+
+/** \brief
+ * Simplifies a Geometry using the Visvalingam-Whyatt area-based algorithm.
+ *
+ * The tolerance is a distance: vertices forming triangles with an area
+ * smaller than its square are removed (see {@link VWLineSimplifier}).
+ *
+ * By default, polygonal results are made valid, as for
+ * {@link DouglasPeuckerSimplifier}, and the topology of the result is not
+ * preserved: polygons can be split, collapse to lines or disappear,
+ * holes can be created or disappear, and lines can cross.
+ *
+ * If topology preservation is set, all linear components are simplified
+ * against a common segment index, so that no new intersections are
+ * introduced and rings keep at least 4 points
+ * (as for {@link TopologyPreservingSimplifier}).
+ */
+class GEOS_DLL VWSimplifier {
+
+public:
+
+    static std::unique_ptr<geom::Geometry> simplify(
+        const geom::Geometry* geom,
+        double tolerance);
+
+    VWSimplifier(const geom::Geometry* geom);
+
+    /** \brief
+     * Sets the distance tolerance for the simplification.
+     *
+     * All vertices forming triangles with an area less than the
+     * square of the tolerance are removed.
+     * The tolerance value must be non-negative.  A tolerance value
+     * of zero is effectively a no-op.
+     *
+     * @param tolerance the approximation tolerance to use
+     */
+    void setDistanceTolerance(double tolerance);
+
+    /** \brief
+     * Controls whether simplified polygons will be "fixed"
+     * to have valid topology (default true).
+     *
+     * Not needed if topology is preserved.
+     *
+     * @param isEnsureValidTopology whether the result is made valid
+     */
+    void setEnsureValid(bool isEnsureValidTopology);
+
+    /** \brief
+     * Controls whether the simplification avoids introducing
+     * intersections between (and within) the linear components
+     * (default false).
+     *
+     * @param isPreserveTopology whether topology is preserved
+     */
+    void setPreserveTopology(bool isPreserveTopology);
+
+    std::unique_ptr<geom::Geometry> getResultGeometry();
+
+
+private:
+
+    const geom::Geometry* inputGeom;
+
+    double distanceTolerance;
+
+    bool isEnsureValidTopology;
+
+    bool isPreserveTopology;
+};
+
+
+} // namespace geos::simplify
+} // namespace geos
+
+#endif // GEOS_SIMPLIFY_VWSIMPLIFIER_H
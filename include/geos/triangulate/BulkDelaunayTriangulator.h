@@ -0,0 +1,248 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_BULKDELAUNAYTRIANGULATOR_H
+#define GEOS_TRIANGULATE_BULKDELAUNAYTRIANGULATOR_H
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Envelope.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Geometry;
+class GeometryCollection;
+class GeometryFactory;
+class MultiLineString;
+}
+}
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+/** \brief
+ * Computes a Delaunay Triangulation of a large set of sites,
+ * using a compact half-edge array representation.
+ *
+ * This is an alternative to {@link IncrementalDelaunayTriangulator}
+ * and {@link quadedge::QuadEdgeSubdivision} for bulk point sets
+ * (e.g. millions of LiDAR points).
+ * It uses the same frame triangle and the same robust
+ * {@link quadedge::TrianglePredicate} tests, so it produces the same
+ * triangulation (up to the choice of diagonals between cocircular sites),
+ * but:
+ *
+ * - sites are inserted in a Biased Randomized Insertion Order (BRIO),
+ *   with each round sorted along a Hilbert curve,
+ *   so that each site is located by a short walk from the previous one;
+ * - triangles are stored in flat arrays of vertex indexes and
+ *   adjacent half-edges, rather than as linked QuadEdge objects.
+ *
+ * Triangle `t` has the half-edges `3t`, `3t+1` and `3t+2`,
+ * in counter-clockwise order.
+ * Half-edge `e` starts at vertex `getTriangleVertexIndexes()[e]`,
+ * and `getHalfEdges()[e]` is the opposite half-edge
+ * in the adjacent triangle, or NONE on the frame boundary.
+ *
+ * Sites are expected to be free of duplicates.
+ * If a tolerance is set, sites which are within the tolerance
+ * of an existing vertex are not inserted.
+ */
+class GEOS_DLL BulkDelaunayTriangulator {
+
+public:
+
+    static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+    /**
+    * The number of sites from which {@link DelaunayTriangulationBuilder}
+    * and {@link VoronoiDiagramBuilder} use this triangulator,
+    * unless told otherwise with their setBulk() method.
+    */
+    static constexpr std::size_t DEFAULT_MIN_SITES = 10000;
+
+    /**
+    * Creates a triangulator for the given sites.
+    *
+    * @param sites the sites to triangulate
+    * @param tolerance the snapping tolerance (0.0 for none)
+    */
+    BulkDelaunayTriangulator(const geom::CoordinateSequence& sites, double tolerance = 0.0);
+
+    /**
+    * Sets the envelope from which the frame triangle is created,
+    * if it should be larger than the envelope of the sites
+    * (as for a Voronoi diagram clipped to a larger extent).
+    *
+    * @param env the frame envelope
+    */
+    void setFrameEnvelope(const geom::Envelope& env)
+    {
+        frameEnv = env;
+    }
+
+    /**
+    * Computes the triangulation, if not already computed.
+    *
+    * @throws LocateFailureException if a site cannot be located
+    */
+    void triangulate();
+
+    /**
+    * Gets the triangulation vertices.
+    * The first three are the vertices of the frame triangle.
+    */
+    const std::vector<geom::Coordinate>& getVertices() const
+    {
+        return vertices;
+    }
+
+    /// Gets the start vertex of each half-edge
+    const std::vector<std::size_t>& getTriangleVertexIndexes() const
+    {
+        return triangles;
+    }
+
+    /// Gets the opposite of each half-edge, or NONE
+    const std::vector<std::size_t>& getHalfEdges() const
+    {
+        return halfedges;
+    }
+
+    /// Gets the number of triangles, including those on the frame
+    std::size_t getNumTriangles() const
+    {
+        return triangles.size() / 3;
+    }
+
+    /**
+    * Gets the edges of the triangulation
+    * (excluding those incident on the frame) as a MultiLineString.
+    */
+    std::unique_ptr<geom::MultiLineString> getEdges(const geom::GeometryFactory& geomFact);
+
+    /**
+    * Gets the triangles of the triangulation
+    * (excluding those incident on the frame)
+    * as a GeometryCollection of Polygons.
+    */
+    std::unique_ptr<geom::GeometryCollection> getTriangles(const geom::GeometryFactory& geomFact);
+
+    /**
+    * Gets the Voronoi cells of the sites as Polygons.
+    * Cells of sites on the convex hull extend to the
+    * circumcentres of the triangles incident on the frame,
+    * so they should be clipped by the caller.
+    * The user data of each cell is a pointer to the Coordinate
+    * of its site, which is owned by this triangulator.
+    */
+    std::vector<std::unique_ptr<geom::Geometry>> getVoronoiCellPolygons(const geom::GeometryFactory& geomFact);
+
+    /**
+    * Gets the boundaries of the Voronoi cells of the sites
+    * as a MultiLineString of closed LineStrings.
+    * The user data of each boundary is a pointer to the Coordinate
+    * of its site, which is owned by this triangulator.
+    */
+    std::unique_ptr<geom::MultiLineString> getVoronoiDiagramEdges(const geom::GeometryFactory& geomFact);
+
+private:
+
+    static constexpr std::size_t NUM_FRAME_VERTICES = 3;
+    static constexpr uint32_t HILBERT_LEVEL = 12;
+
+    std::vector<geom::Coordinate> vertices;
+    std::vector<std::size_t> triangles;
+    std::vector<std::size_t> halfedges;
+    /// A half-edge ending at each vertex, for traversing vertex stars
+    std::vector<std::size_t> vertexEdge;
+    std::vector<geom::Coordinate> circumcentres;
+    std::vector<std::size_t> legalizeStack;
+    double tolerance;
+    geom::Envelope frameEnv;
+    std::size_t lastTriangle;
+    bool isTriangulated;
+
+    static std::size_t
+    nextHalfEdge(std::size_t e)
+    {
+        return (e % 3 == 2) ? e - 2 : e + 1;
+    }
+
+    static std::size_t
+    prevHalfEdge(std::size_t e)
+    {
+        return (e % 3 == 0) ? e + 2 : e - 1;
+    }
+
+    bool
+    isFrameVertex(std::size_t v) const
+    {
+        return v < NUM_FRAME_VERTICES;
+    }
+
+    bool isFrameTriangle(std::size_t t) const;
+
+    void createFrame(const geom::Envelope& env);
+
+    /**
+    * Computes the site insertion order:
+    * BRIO rounds, each sorted in Hilbert order.
+    */
+    std::vector<std::size_t> insertionOrder(const geom::Envelope& env) const;
+
+    void insertSite(std::size_t v);
+
+    /**
+    * Locates the triangle containing a point,
+    * by walking from the last triangle located.
+    *
+    * @param p the point to locate
+    * @param onEdge set to the half-edge containing p, or NONE
+    * @param atVertex set to a vertex equal to p (within tolerance), or NONE
+    * @return the triangle containing p
+    */
+    std::size_t locate(const geom::Coordinate& p, std::size_t& onEdge, std::size_t& atVertex);
+
+    std::size_t addTriangle();
+
+    void setTriangle(std::size_t t, std::size_t v0, std::size_t v1, std::size_t v2);
+
+    void link(std::size_t e0, std::size_t e1);
+
+    void splitTriangle(std::size_t t, std::size_t v);
+
+    void splitEdge(std::size_t e, std::size_t v);
+
+    /**
+    * Restores the Delaunay condition by flipping the edges on the stack
+    * (which are opposite the inserted vertex) as required.
+    */
+    void legalize();
+
+    void computeCircumcentres();
+
+    std::vector<geom::Coordinate> voronoiCellPoints(std::size_t v) const;
+
+};
+
+} //namespace geos.triangulate
+} //namespace geos
+
+#endif //GEOS_TRIANGULATE_BULKDELAUNAYTRIANGULATOR_H
@@ -0,0 +1,144 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_CONSTRAINEDDELAUNAYTRIANGULATIONBUILDER_H
+#define GEOS_TRIANGULATE_CONSTRAINEDDELAUNAYTRIANGULATIONBUILDER_H
+
+#include <geos/export.h>
+#include <geos/geom/CoordinateSequence.h>
+
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace geom {
+class Geometry;
+class GeometryCollection;
+class GeometryFactory;
+class MultiLineString;
+}
+namespace triangulate {
+namespace quadedge {
+class QuadEdge;
+class QuadEdgeSubdivision;
+}
+}
+}
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+/** \brief
+ * A utility class which creates Constrained Delaunay Triangulations
+ * from collections of points and linework,
+ * and extracts the resulting triangles as geometries.
+ *
+ * The linework of the constraint geometry (lines and polygon rings)
+ * appears as edges of the triangulation,
+ * e.g. to honour breaklines in a terrain model.
+ * Crossing constraints are noded,
+ * and their intersection points become vertices of the triangulation
+ * (noding is only done if a crossing is found, since it is relatively expensive).
+ * If the constraints contain polygons, only the triangles
+ * inside them are returned, giving a triangulation
+ * of the polygons (including holes) which uses only their vertices
+ * (and those of any interior constraints and sites).
+ *
+ * Vertices are inserted in Hilbert order, and constraints by edge swapping,
+ * so very large inputs can be triangulated.
+ */
+class GEOS_DLL ConstrainedDelaunayTriangulationBuilder {
+
+public:
+
+    ConstrainedDelaunayTriangulationBuilder();
+
+    ~ConstrainedDelaunayTriangulationBuilder();
+
+    /**
+     * Sets the sites (vertices) which will be triangulated,
+     * without constraints.
+     * All vertices of the given geometry will be used as sites.
+     *
+     * @param geom the geometry from which the sites will be extracted.
+     */
+    void setSites(const geom::Geometry& geom);
+
+    /**
+     * Sets the constraints of the triangulation.
+     * Points are used as sites, and lines and polygon rings as
+     * constraint segments.
+     *
+     * @param geom the constraint geometry
+     */
+    void setConstraints(const geom::Geometry& geom);
+
+    /**
+     * Gets the {@link quadedge::QuadEdgeSubdivision} which models the computed triangulation.
+     *
+     * @return the subdivision containing the triangulation
+     */
+    quadedge::QuadEdgeSubdivision& getSubdivision();
+
+    /**
+     * Gets the edges of the computed triangulation as a {@link geom::MultiLineString}.
+     *
+     * @param geomFact the geometry factory to use to create the output
+     * @return the edges of the triangulation
+     */
+    std::unique_ptr<geom::MultiLineString> getEdges(const geom::GeometryFactory& geomFact);
+
+    /**
+     * Gets the faces of the computed triangulation as a {@link geom::GeometryCollection}
+     * of {@link geom::Polygon}.
+     * If the constraints contain polygons, only the triangles inside them
+     * are returned.
+     *
+     * @param geomFact the geometry factory to use to create the output
+     * @return the faces of the triangulation
+     */
+    std::unique_ptr<geom::GeometryCollection> getTriangles(const geom::GeometryFactory& geomFact);
+
+private:
+
+    std::vector<geom::Coordinate> sites;
+    std::vector<std::unique_ptr<geom::CoordinateSequence>> constraintLines;
+    /// whether each constraint line is a polygon ring
+    std::vector<bool> isRingLine;
+    bool isPolygonal;
+    std::unique_ptr<quadedge::QuadEdgeSubdivision> subdiv;
+    /// the constrained edges which are polygon ring segments (an edge may appear more than once)
+    std::vector<quadedge::QuadEdge*> ringEdges;
+
+    void addConstraints(const geom::Geometry& geom);
+
+    void create();
+
+    /// Nodes the constraint lines
+    void node(std::vector<std::unique_ptr<geom::CoordinateSequence>>& nodedLines,
+              std::vector<bool>& isNodedRingLine) const;
+
+    /**
+    * Triangulates the sites and constraint lines.
+    *
+    * @throws util::TopologyException if the constraint lines cross
+    */
+    void triangulate(const std::vector<std::unique_ptr<geom::CoordinateSequence>>& lines,
+                     const std::vector<bool>& isRing);
+
+    std::unique_ptr<geom::GeometryCollection> getPolygonTriangles(const geom::GeometryFactory& geomFact);
+};
+
+} //namespace geos.triangulate
+} //namespace geos
+
+#endif //GEOS_TRIANGULATE_CONSTRAINEDDELAUNAYTRIANGULATIONBUILDER_H
@@ -0,0 +1,148 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_CONSTRAINEDDELAUNAYTRIANGULATOR_H
+#define GEOS_TRIANGULATE_CONSTRAINEDDELAUNAYTRIANGULATOR_H
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace geos {
+namespace triangulate {
+namespace quadedge {
+class QuadEdge;
+class QuadEdgeSubdivision;
+class Vertex;
+}
+}
+}
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+/** \brief
+ * Inserts constraint segments into a Delaunay triangulation held in a
+ * {@link quadedge::QuadEdgeSubdivision}, producing a
+ * Constrained Delaunay Triangulation (CDT).
+ *
+ * The endpoints of constraints must already be vertices of the
+ * subdivision (e.g. inserted by an {@link IncrementalDelaunayTriangulator}),
+ * and all vertices must be inserted before any constraint,
+ * since inserting a vertex may flip constrained edges.
+ *
+ * Since a constrained triangulation is not Delaunay, vertices are not located
+ * by walking (which may not terminate); instead an edge incident on each vertex
+ * is recorded when the first constraint is inserted, and kept up to date.
+ *
+ * Each constraint is inserted by swapping away the edges it crosses,
+ * and then restoring the Delaunay condition on the new edges
+ * (Sloan, 1993). Constrained edges are never swapped.
+ * A constraint which passes exactly through a vertex is split there.
+ * Constraints must not cross each other (they should be noded first);
+ * a crossing is reported by throwing a util::TopologyException.
+ */
+class GEOS_DLL ConstrainedDelaunayTriangulator {
+
+public:
+
+    /**
+     * Creates a triangulator for the given subdivision.
+     *
+     * @param subdiv a subdivision containing a Delaunay triangulation
+     */
+    ConstrainedDelaunayTriangulator(quadedge::QuadEdgeSubdivision* subdiv);
+
+    /**
+     * Inserts a constraint segment between two vertices of the subdivision.
+     *
+     * @param a the start vertex of the constraint
+     * @param b the end vertex of the constraint
+     *
+     * @throws util::TopologyException if the constraint crosses another constraint
+     * @throws LocateFailureException if a vertex is not in the subdivision
+     */
+    void insertConstraint(const quadedge::Vertex& a, const quadedge::Vertex& b);
+
+    /**
+     * Inserts a constraint segment between two vertices of the subdivision,
+     * returning the edges which form it.
+     *
+     * @param a the start vertex of the constraint
+     * @param b the end vertex of the constraint
+     * @param constraintEdges the list to add the edges of the constraint to,
+     *        in order from a to b
+     */
+    void insertConstraint(const quadedge::Vertex& a, const quadedge::Vertex& b,
+                          std::vector<quadedge::QuadEdge*>& constraintEdges);
+
+    /**
+     * Tests whether an edge is (part of) a constraint.
+     *
+     * @param e an edge of the subdivision
+     * @return true if the edge is constrained
+     */
+    bool isConstrained(const quadedge::QuadEdge& e) const;
+
+private:
+
+    quadedge::QuadEdgeSubdivision* subdiv;
+    /// the constrained edges, keyed by edgeKey()
+    std::unordered_set<const quadedge::QuadEdge*> constrainedEdges;
+    /// an edge originating at each vertex
+    std::unordered_map<geom::Coordinate, quadedge::QuadEdge*, geom::Coordinate::HashCode> vertexEdges;
+    std::vector<quadedge::QuadEdge*> crossingEdges;
+    std::vector<quadedge::QuadEdge*> newEdges;
+
+    /// Gets the same key for an edge and its sym
+    static const quadedge::QuadEdge* edgeKey(const quadedge::QuadEdge& e);
+
+    void setConstrained(quadedge::QuadEdge& e, std::vector<quadedge::QuadEdge*>& constraintEdges);
+
+    /// Records an edge originating at each vertex of the subdivision
+    void initVertexEdges();
+
+    /// Finds an edge with a given origin vertex
+    quadedge::QuadEdge& findEdgeFrom(const quadedge::Vertex& v);
+
+    /// Swaps an edge, keeping the vertex edges up to date
+    void swap(quadedge::QuadEdge& e);
+
+    /**
+    * Tests whether the two triangles adjacent to an edge form
+    * a strictly convex quadrilateral, so that the edge can be swapped.
+    */
+    static bool isSwappable(const quadedge::QuadEdge& e);
+
+    /// Tests whether an edge properly crosses the segment p0-p1
+    static bool isCrossing(const quadedge::QuadEdge& e,
+                           const quadedge::Vertex& p0, const quadedge::Vertex& p1);
+
+    /**
+    * Swaps away the edges crossing the segment start-end,
+    * recording the new edges.
+    *
+    * @return the edge from start to end
+    */
+    quadedge::QuadEdge& removeCrossingEdges(const quadedge::Vertex& start, const quadedge::Vertex& end);
+
+    /// Restores the Delaunay condition on the new edges
+    void restoreDelaunay();
+};
+
+} //namespace geos.triangulate
+} //namespace geos
+
+#endif //GEOS_TRIANGULATE_CONSTRAINEDDELAUNAYTRIANGULATOR_H
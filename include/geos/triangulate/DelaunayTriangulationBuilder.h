@@ -20,6 +20,7 @@
 #define GEOS_TRIANGULATE_DELAUNAYTRIANGULATIONBUILDER_H
 
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/triangulate/BulkDelaunayTriangulator.h>
 #include <geos/geom/CoordinateSequence.h>
 
 #include <memory>
@@ -79,10 +80,42 @@ public:
      */
     static std::unique_ptr<geom::CoordinateSequence> unique(const geom::CoordinateSequence* seq);
 
+    /**
+     * Sorts vertices into the order in which they are inserted
+     * into a triangulation: lexicographically,
+     * or along a Hilbert curve over their extent.
+     *
+     * @param vertices the vertices to sort
+     * @param isHilbertOrder true to sort in Hilbert order
+     */
+    static void sortVertices(IncrementalDelaunayTriangulator::VertexList& vertices, bool isHilbertOrder);
+
+    /**
+     * Inserts vertices sorted by sortVertices() into a subdivision.
+     *
+     * Lexicographically sorted vertices always fall near the frame,
+     * so the default locator (which walks from the frame) finds them quickly.
+     * Vertices in Hilbert order are located with a
+     * {@link quadedge::JumpAndWalkQuadEdgeLocator} instead.
+     *
+     * @param subdiv the subdivision to insert into
+     * @param vertices the vertices to insert
+     * @param siteEnv the extent of the vertices
+     * @param isHilbertOrder true if the vertices are in Hilbert order
+     */
+    static void insertVertices(quadedge::QuadEdgeSubdivision& subdiv,
+                               const IncrementalDelaunayTriangulator::VertexList& vertices,
+                               const geom::Envelope& siteEnv,
+                               bool isHilbertOrder);
+
 private:
     std::unique_ptr<geom::CoordinateSequence> siteCoords;
     double tolerance;
+    bool isBulk;
+    bool isBulkSet;
+    bool isHilbertOrder;
     std::unique_ptr<quadedge::QuadEdgeSubdivision> subdiv;
+    std::unique_ptr<BulkDelaunayTriangulator> bulkTriangulator;
 
 public:
     /**
@@ -122,8 +155,43 @@ public:
         this->tolerance = p_tolerance;
     }
 
+    /**
+     * Sets whether the edges and triangles are computed using
+     * the {@link BulkDelaunayTriangulator}, which is faster
+     * and uses less memory for large numbers of sites.
+     * If this is not set, the bulk triangulator is used for at least
+     * BulkDelaunayTriangulator::DEFAULT_MIN_SITES sites.
+     * The subdivision returned by getSubdivision() is always
+     * computed using the {@link IncrementalDelaunayTriangulator}.
+     *
+     * @param p_isBulk true to use the bulk triangulator
+     */
+    inline void
+    setBulk(bool p_isBulk)
+    {
+        this->isBulk = p_isBulk;
+        this->isBulkSet = true;
+    }
+
+    /**
+     * Sets whether sites are inserted in the order of a Hilbert curve
+     * over their extent, rather than lexicographically.
+     * Spatially coherent insertion keeps triangle location walks short.
+     * The choice of diagonals between cocircular sites
+     * may depend on the insertion order.
+     *
+     * @param p_isHilbertOrder true to insert sites in Hilbert order
+     */
+    inline void
+    setHilbertOrder(bool p_isHilbertOrder)
+    {
+        this->isHilbertOrder = p_isHilbertOrder;
+    }
+
 private:
     void create();
+    void createBulk();
+    bool useBulk() const;
 
 public:
     /**
@@ -20,6 +20,7 @@
 #define GEOS_TRIANGULATE_VORONOIDIAGRAMBUILDER_H
 
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/BulkDelaunayTriangulator.h>
 #include <geos/geom/Envelope.h> // for composition
 #include <memory>
 #include <iostream>
@@ -91,6 +92,29 @@ public:
      */
     void setTolerance(double tolerance);
 
+    /** \brief
+     * Sets whether the diagram is computed using the
+     * {@link BulkDelaunayTriangulator}, which is faster
+     * and uses less memory for large numbers of sites.
+     *
+     * If this is not set, the bulk triangulator is used for at least
+     * BulkDelaunayTriangulator::DEFAULT_MIN_SITES sites.
+     * The subdivision returned by getSubdivision() is always
+     * computed using the {@link IncrementalDelaunayTriangulator}.
+     *
+     * @param isBulk true to use the bulk triangulator
+     */
+    void setBulk(bool isBulk);
+
+    /** \brief
+     * Sets whether sites are inserted into the triangulation
+     * in the order of a Hilbert curve over their extent,
+     * rather than lexicographically.
+     *
+     * @param isHilbertOrder true to insert sites in Hilbert order
+     */
+    void setHilbertOrder(bool isHilbertOrder);
+
     /** \brief
      * Gets the quadedge::QuadEdgeSubdivision which models the computed diagram.
      *
@@ -120,11 +144,16 @@ private:
 
     std::unique_ptr<geom::CoordinateSequence> siteCoords;
     double tolerance;
+    bool isBulk;
+    bool isBulkSet;
+    bool isHilbertOrder;
     std::unique_ptr<quadedge::QuadEdgeSubdivision> subdiv;
+    std::unique_ptr<BulkDelaunayTriangulator> bulkTriangulator;
     const geom::Envelope* clipEnv; // externally owned
     geom::Envelope diagramEnv;
 
-    void create();
+    void create(bool bulk);
+    bool useBulk() const;
 
     static std::unique_ptr<geom::GeometryCollection>
     clipGeometryCollection(std::vector<std::unique_ptr<geom::Geometry>> & geoms, const geom::Envelope& clipEnv);
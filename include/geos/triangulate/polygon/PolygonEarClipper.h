@@ -0,0 +1,203 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_POLYGON_POLYGONEARCLIPPER_H
+#define GEOS_TRIANGULATE_POLYGON_POLYGONEARCLIPPER_H
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Triangle.h>
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <vector>
+
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace polygon { //geos.triangulate.polygon
+
+/** \brief
+ * Triangulates a polygon (which may contain holes) by ear clipping.
+ *
+ * The polygon rings are held in a circular doubly-linked list of vertices.
+ * Holes are joined to the shell by bridge edges,
+ * found by casting a ray to the left of the leftmost vertex of each hole.
+ * Ears are then clipped from the resulting ring.
+ * For large polygons the reflex vertices are indexed in Morton (z-order)
+ * curve order, so that the test for vertices inside a candidate ear
+ * only visits the vertices near it.
+ * (Since ear clipping only reduces the interior angles of the remaining vertices,
+ * convex vertices never need to be indexed.)
+ * This allows polygons with millions of vertices to be triangulated quickly.
+ *
+ * All orientation tests are robust.
+ * Degenerate or slightly invalid inputs are handled by fallback passes
+ * which remove collinear vertices, cut off local self-intersections
+ * and finally split the ring along a valid diagonal.
+ *
+ * The triangles use only the polygon vertices,
+ * but are not Delaunay; use {@link ConstrainedDelaunayTriangulationBuilder}
+ * if a better quality triangulation is required.
+ */
+class GEOS_DLL PolygonEarClipper {
+
+public:
+
+    /**
+     * Creates an ear clipper for a polygon.
+     *
+     * @param poly the polygon to triangulate
+     */
+    PolygonEarClipper(const geom::Polygon& poly);
+
+    /**
+     * Computes the triangles of the polygon.
+     * Each triangle has counter-clockwise orientation.
+     *
+     * @param triList the list to add the triangles to
+     */
+    void compute(std::vector<geom::Triangle>& triList);
+
+private:
+
+    /// The minimum number of vertices for which z-order hashing is used
+    static constexpr std::size_t HASH_MIN_SIZE = 80;
+
+    struct Node {
+        geom::Coordinate p;
+        Node* prev;
+        Node* next;
+        /// the position of the vertex in the index, or NONE
+        std::size_t zIndex;
+        /// the list of convex vertices which are candidate ears
+        Node* prevCand;
+        Node* nextCand;
+        bool isCand;
+    };
+
+    static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+    const geom::Polygon& inputPoly;
+    std::deque<Node> nodes;
+    std::vector<geom::Triangle>* triangles;
+    bool isHashed;
+    double minX;
+    double minY;
+    double invSize;
+    /// The reflex vertices of the ring being clipped, sorted in z-order
+    std::vector<Node*> zNodes;
+    std::vector<uint32_t> zKeys;
+    /// The next entry at or after each index entry which has not been deleted
+    std::vector<std::size_t> zNextEntry;
+
+    Node* createNode(const geom::Coordinate& p, Node* last);
+
+    /**
+     * Links the vertices of a ring into a circular list,
+     * with the given orientation.
+     *
+     * @return a node of the list, or null if the ring is empty
+     */
+    Node* linkRing(const geom::CoordinateSequence& ring, bool isCCW);
+
+    void removeNode(Node* n);
+
+    /// Removes duplicate (and optionally collinear) vertices from a list
+    Node* filterPoints(Node* start, Node* end, bool isCollinearRemoved);
+
+    Node* eliminateHoles(Node* outerNode);
+
+    Node* eliminateHole(Node* hole, Node* outerNode);
+
+    Node* findHoleBridge(const Node* hole, Node* outerNode) const;
+
+    /**
+     * Splits a list into two by a diagonal between two vertices,
+     * by duplicating them.
+     *
+     * @return the copy of b, in the new list
+     */
+    Node* splitPolygon(Node* a, Node* b);
+
+    void clipEars(Node* start, int pass);
+
+    /**
+     * Links the convex vertices of a list, which are the candidate ears.
+     *
+     * @return a candidate, or null if there are none
+     */
+    Node* linkCandidates(Node* start);
+
+    /**
+     * Clips an ear and updates the candidates.
+     *
+     * @return the next candidate to test, or null if there are none
+     */
+    Node* clipEar(Node* ear);
+
+    bool isEar(const Node* ear) const;
+
+    bool isEarHashed(const Node* ear);
+
+    Node* cureLocalIntersections(Node* start);
+
+    void splitClipEars(Node* start);
+
+    void indexCurve(Node* start);
+
+    /// Deletes a vertex from the index, if present
+    void unindex(Node* n);
+
+    /// Finds the first index entry at or after a position which has not been deleted
+    std::size_t findIndexEntry(std::size_t i);
+
+    uint32_t zOrder(double x, double y) const;
+
+    void addTriangle(const Node* a, const Node* b, const Node* c);
+
+    static Node* getLeftmost(Node* start);
+
+    static int orientation(const Node* a, const Node* b, const Node* c);
+
+    static bool isConvex(const Node* n);
+
+    /// Tests if p lies in the triangle abc (of either orientation), including its boundary
+    static bool isInTriangle(const geom::Coordinate& a, const geom::Coordinate& b,
+                             const geom::Coordinate& c, const geom::Coordinate& p);
+
+    static bool intersects(const Node* p1, const Node* q1, const Node* p2, const Node* q2);
+
+    static bool intersectsPolygon(const Node* a, const Node* b);
+
+    static bool isLocallyInside(const Node* a, const Node* b);
+
+    static bool isMiddleInside(const Node* a, const Node* b);
+
+    static bool isValidDiagonal(const Node* a, const Node* b);
+
+    static bool sectorContainsSector(const Node* m, const Node* p);
+
+};
+
+} //namespace geos.triangulate.polygon
+} //namespace geos.triangulate
+} //namespace geos
+
+#endif //GEOS_TRIANGULATE_POLYGON_POLYGONEARCLIPPER_H
@@ -0,0 +1,80 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_POLYGON_POLYGONTRIANGULATOR_H
+#define GEOS_TRIANGULATE_POLYGON_POLYGONTRIANGULATOR_H
+
+#include <geos/export.h>
+
+#include <memory>
+
+namespace geos {
+namespace geom {
+class Geometry;
+class GeometryFactory;
+}
+}
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace polygon { //geos.triangulate.polygon
+
+/** \brief
+ * Computes a triangulation of each polygon in a geometry,
+ * using the polygon vertices only.
+ *
+ * Polygons with holes are supported.
+ * The triangulation is computed by {@link PolygonEarClipper},
+ * which is fast but produces triangles of arbitrary shape.
+ * Vertex Z values are preserved.
+ *
+ * The result is a GeometryCollection of triangular Polygons.
+ * Non-polygonal components of the input are ignored.
+ */
+class GEOS_DLL PolygonTriangulator {
+
+public:
+
+    /**
+     * Computes a triangulation of each polygon in a geometry.
+     *
+     * @param geom a geometry containing polygons
+     * @return a GeometryCollection containing the triangles
+     */
+    static std::unique_ptr<geom::Geometry> triangulate(const geom::Geometry* geom);
+
+    /**
+     * Constructs a new triangulator.
+     *
+     * @param inputGeom the input geometry
+     */
+    PolygonTriangulator(const geom::Geometry* inputGeom);
+
+    /**
+     * Gets the triangulation of the input polygons.
+     *
+     * @return a GeometryCollection containing the triangles
+     */
+    std::unique_ptr<geom::Geometry> getResult();
+
+private:
+
+    const geom::Geometry* inputGeom;
+    const geom::GeometryFactory* geomFact;
+
+};
+
+} //namespace geos.triangulate.polygon
+} //namespace geos.triangulate
+} //namespace geos
+
+#endif //GEOS_TRIANGULATE_POLYGON_POLYGONTRIANGULATOR_H
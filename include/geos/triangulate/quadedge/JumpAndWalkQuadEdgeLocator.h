@@ -0,0 +1,134 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_QUADEDGE_JUMPANDWALKQUADEDGELOCATOR_H
+#define GEOS_TRIANGULATE_QUADEDGE_JUMPANDWALKQUADEDGELOCATOR_H
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+#include <geos/triangulate/quadedge/QuadEdgeLocator.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace quadedge { //geos.triangulate.quadedge
+
+//fwd declarations
+class QuadEdgeSubdivision;
+
+/** \brief
+ * Locates {@link QuadEdge}s in a {@link QuadEdgeSubdivision} using
+ * a "jump-and-walk" strategy.
+ *
+ * A grid over a given extent records the last edge located in each cell.
+ * A search "jumps" to the edge recorded in the cell of the query vertex
+ * (or to the last edge found, if the cell is empty),
+ * and "walks" from there towards the vertex.
+ * This keeps walks short for vertices which are located in
+ * a spatially coherent order (such as Hilbert order),
+ * for which walks from the frame of the subdivision
+ * (as done by {@link LastFoundQuadEdgeLocator}) are long.
+ *
+ * Walks are limited to a fixed number of steps.
+ * A walk which exceeds this limit (which can only happen
+ * if it cycles) is restarted from the frame of the subdivision
+ * using {@link QuadEdgeSubdivision::locateFromEdge}.
+ *
+ * The number of locates, walk steps and restarts are counted,
+ * to allow the walk length to be measured.
+ */
+class GEOS_DLL JumpAndWalkQuadEdgeLocator : public QuadEdgeLocator {
+
+public:
+
+    /**
+     * Creates a locator with a grid over the given extent.
+     * Vertices outside the extent use the nearest grid cell.
+     *
+     * @param subdiv the subdivision to locate in
+     * @param env the extent of the vertices to be located
+     * @param numVertices the expected number of vertices to be located
+     */
+    JumpAndWalkQuadEdgeLocator(QuadEdgeSubdivision* subdiv,
+                               const geom::Envelope& env,
+                               std::size_t numVertices);
+
+    /**
+     * Locates an edge e, such that either v is on e, or e is an edge of a triangle containing v.
+     * @return The caller _does not_ take ownership of the returned object.
+     */
+    QuadEdge* locate(const Vertex& v) override;
+
+    /// Gets the number of vertices located
+    std::size_t
+    getLocateCount() const
+    {
+        return locateCount;
+    }
+
+    /// Gets the total number of edges traversed by walks
+    std::size_t
+    getStepCount() const
+    {
+        return stepCount;
+    }
+
+    /// Gets the number of walks which were restarted from the frame
+    std::size_t
+    getRestartCount() const
+    {
+        return restartCount;
+    }
+
+    /// Resets the locate, step and restart counts to zero
+    void resetCounts();
+
+private:
+
+    static constexpr std::size_t MAX_WALK_STEPS = 1000;
+    static constexpr std::size_t VERTICES_PER_CELL = 8;
+
+    QuadEdgeSubdivision* subdiv;
+    QuadEdge* lastEdge;
+    geom::Envelope gridEnv;
+    std::size_t numCols;
+    std::size_t numRows;
+    double cellWidth;
+    double cellHeight;
+    std::vector<QuadEdge*> cellEdge;
+
+    std::size_t locateCount;
+    std::size_t stepCount;
+    std::size_t restartCount;
+
+    std::size_t cellIndex(const Vertex& v) const;
+
+    QuadEdge* startEdge(std::size_t cell);
+
+    /// Returns an edge of the frame of the subdivision
+    QuadEdge* frameEdge() const;
+
+    /**
+    * Walks from an edge towards a vertex.
+    *
+    * @return the located edge, or nullptr if the step limit was exceeded
+    */
+    QuadEdge* walk(const Vertex& v, QuadEdge* e);
+};
+
+} //namespace geos.triangulate.quadedge
+} //namespace geos.triangulate
+} //namespace goes
+
+#endif //  GEOS_TRIANGULATE_QUADEDGE_JUMPANDWALKQUADEDGELOCATOR_H
@@ -0,0 +1,119 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_UTIL_EXECUTOR_H
+#define GEOS_UTIL_EXECUTOR_H
+
+#include <geos/export.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace util { // geos::util
+
+/**
+ * \brief A pool of worker threads which runs loops in parallel.
+ *
+ * An Executor is meant to be created once by the host application
+ * and shared by the operations (and threads) which need it, so that
+ * the number of threads used by GEOS is bounded.
+ *
+ * The thread calling parallelFor() takes part in the loop, so an
+ * Executor with N threads creates N - 1 worker threads, and an Executor
+ * with one thread runs every loop in the calling thread.
+ * While it waits for the other threads to finish, the calling thread
+ * runs queued work, so loops can be nested without deadlocking.
+ */
+class GEOS_DLL Executor {
+
+public:
+
+    /// A function processing the items of the range [begin, end)
+    typedef std::function<void(std::size_t begin, std::size_t end)> RangeFunction;
+
+    /**
+     * \brief Creates an executor.
+     *
+     * @param numThreads the number of threads, including the calling thread.
+     *        Zero uses the number of hardware threads.
+     */
+    explicit Executor(std::size_t numThreads);
+
+    ~Executor();
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    /// Returns the number of threads, including the calling thread
+    std::size_t
+    getNumThreads() const
+    {
+        return workers.size() + 1;
+    }
+
+    /**
+     * \brief Processes the items [0, n) in ranges of at least
+     * grainSize items, using up to maxThreads threads.
+     *
+     * Loops with fewer than twice grainSize items run in the calling thread.
+     * If a call of f throws, the remaining ranges are skipped and the
+     * first exception is rethrown in the calling thread, after all
+     * threads have stopped working on the loop.
+     *
+     * @param n the number of items
+     * @param grainSize the minimum number of items in a range
+     * @param f the function processing a range of items
+     * @param maxThreads the maximum number of threads to use,
+     *        or zero to use all threads
+     */
+    void parallelFor(std::size_t n, std::size_t grainSize, const RangeFunction& f,
+                     std::size_t maxThreads = 0);
+
+    /// Returns the number of hardware threads, or 1 if it is unknown
+    static std::size_t getHardwareConcurrency();
+
+private:
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    bool stopping;
+
+    void workerLoop();
+
+    void submit(std::function<void()> task);
+
+    /// Runs a queued task, if any, returning whether one was run
+    bool runPendingTask();
+
+}; // class Executor
+
+} // namespace geos::util
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_UTIL_EXECUTOR_H
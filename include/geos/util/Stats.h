@@ -0,0 +1,145 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_UTIL_STATS_H
+#define GEOS_UTIL_STATS_H
+
+#include <geos/export.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace geos {
+namespace util { // geos::util
+
+/**
+ * \brief Counters and timers of the main stages of geometry operations.
+ *
+ * Each stage has the number of times it ran and its total run time.
+ * Collection is off by default, and then recording a stage costs a
+ * relaxed atomic load and a branch, so the calls can stay in hot paths.
+ * When on, each thread updates its own counters without synchronization,
+ * and getSnapshot() sums the counters of all threads, including
+ * threads which have finished.
+ *
+ * Stages can be nested (index queries run during noding, for example),
+ * so their times are not additive.
+ *
+ * Unlike Profiler, the stages are fixed, there are no string lookups,
+ * and collection is safe when operations run in several threads.
+ */
+class GEOS_DLL Stats {
+
+public:
+
+    enum Stage {
+        /// Noding of the edges of an overlay or buffer
+        NODING = 0,
+        /// Overlays which fell back to snap-rounding
+        SNAP_ROUNDING,
+        /// Building of topology graphs
+        GRAPH_BUILD,
+        /// Labelling of overlay graphs
+        LABELLING,
+        /// Building of result polygons from graphs
+        RING_BUILDING,
+        /// Building of spatial indexes
+        INDEX_BUILD,
+        /// Spatial index queries
+        INDEX_QUERY,
+        /// Overlays and buffers retried with snapping or reduced precision
+        ROBUSTNESS_RETRY,
+        NUM_STAGES
+    };
+
+    /// The counters of all stages at some point in time
+    struct Snapshot {
+        /// The number of times each stage ran
+        uint64_t counts[NUM_STAGES];
+        /// The total run time of each stage, in nanoseconds
+        uint64_t nanoseconds[NUM_STAGES];
+    };
+
+    /**
+     * \brief Records the run time of a stage, from construction to destruction.
+     *
+     * Whether collection is on is checked once, at construction.
+     */
+    class GEOS_DLL Timer {
+    public:
+        explicit Timer(Stage p_stage)
+            : stage(p_stage)
+            , active(isEnabled())
+        {
+            if(active) {
+                start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~Timer()
+        {
+            if(active) {
+                auto elapsed = std::chrono::steady_clock::now() - start;
+                record(stage, static_cast<uint64_t>(
+                           std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            }
+        }
+
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+
+    private:
+        Stage stage;
+        bool active;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    /// Turns collection on or off for all threads, returning the previous state
+    static bool setEnabled(bool isEnabled);
+
+    static bool
+    isEnabled()
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Counts one run of a stage, if collection is on
+    static void
+    count(Stage stage)
+    {
+        if(isEnabled()) {
+            record(stage, 0);
+        }
+    }
+
+    /// Returns the counters summed over all threads, since the last reset()
+    static Snapshot getSnapshot();
+
+    /// Sets all counters to zero
+    static void reset();
+
+    /// Returns the name of a stage, such as "noding"
+    static const char* getStageName(Stage stage);
+
+private:
+
+    static std::atomic<bool> enabled;
+
+    static void record(Stage stage, uint64_t nanoseconds);
+
+}; // class Stats
+
+} // namespace geos::util
+} // namespace geos
+
+#endif // GEOS_UTIL_STATS_H
@@ -16,22 +16,28 @@
  *
  * Last port: algorithm/ConvexHull.java r407 (JTS-1.12+)
  *
+ **********************************************************************
+ *
+ * NOTES: changed from JTS design, computing the hull with Andrew's
+ *        monotone chain instead of a Graham scan.
+ *
  **********************************************************************/
 
 #include <geos/algorithm/ConvexHull.h>
-#include <geos/algorithm/PointLocation.h>
 #include <geos/algorithm/Orientation.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateFilter.h>
 #include <geos/geom/Point.h>
 #include <geos/geom/Polygon.h>
 #include <geos/geom/LineString.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/util/Executor.h>
 #include <geos/util/Interrupt.h>
 
-#include <typeinfo>
 #include <algorithm>
+#include <cmath>
 
 #ifndef GEOS_INLINE
 # include "geos/algorithm/ConvexHull.inl"
@@ -44,351 +50,303 @@ namespace algorithm { // geos.algorithm
 
 namespace {
 
-/**
- * This is the class used to sort in radial order.
- * It's defined here as it's a static one.
- */
-class RadiallyLessThen {
-
-private:
+typedef std::vector<Coordinate>::iterator CoordIt;
 
-    const Coordinate* origin;
+// Inputs smaller than this are not reduced by the octagon
+const std::size_t OCTAGON_MIN_POINTS = 50;
 
-    static int
-    polarCompare(const Coordinate* o, const Coordinate* p,
-                 const Coordinate* q)
-    {
-        double dxp = p->x - o->x;
-        double dyp = p->y - o->y;
-        double dxq = q->x - o->x;
-        double dyq = q->y - o->y;
+// The minimum number of points of the part of a thread
+const std::size_t MIN_POINTS_PER_THREAD = 1 << 16;
 
-        int orient = Orientation::index(*o, *p, *q);
-
-        if(orient == Orientation::COUNTERCLOCKWISE) {
-            return 1;
-        }
-        if(orient == Orientation::CLOCKWISE) {
-            return -1;
-        }
-
-        // points are collinear - check distance
-        double op = dxp * dxp + dyp * dyp;
-        double oq = dxq * dxq + dyq * dyq;
-        if(op < oq) {
-            return -1;
-        }
-        if(op > oq) {
-            return 1;
-        }
-        return 0;
-    }
+// The relative error bound of the orientation filter of CGAlgorithmsDD
+const double DP_SAFE_EPSILON = 1e-15;
 
+/*
+ * Collects the coordinates of a geometry, skipping those with NaN
+ * ordinates which cannot be ordered.
+ */
+class CoordinateCollector : public CoordinateFilter {
 public:
+    explicit CoordinateCollector(std::vector<Coordinate>& p_pts)
+        : pts(p_pts)
+    {}
 
-    RadiallyLessThen(const Coordinate* c): origin(c) {}
-
-    bool
-    operator()(const Coordinate* p1, const Coordinate* p2)
+    void
+    filter_ro(const Coordinate* c) override
     {
-        return (polarCompare(origin, p1, p2) == -1);
+        if(!std::isnan(c->x) && !std::isnan(c->y)) {
+            pts.push_back(*c);
+        }
     }
 
+private:
+    std::vector<Coordinate>& pts;
 };
 
-} // unnamed namespace
-
-/* private */
-std::unique_ptr<CoordinateSequence>
-ConvexHull::toCoordinateSequence(Coordinate::ConstVect& cv)
+bool
+lessXY(const Coordinate& p, const Coordinate& q)
 {
-    const CoordinateSequenceFactory* csf =
-        geomFactory->getCoordinateSequenceFactory();
-
-    std::vector<Coordinate> vect(cv.size());
-
-    for(std::size_t i = 0; i < cv.size(); ++i) {
-        vect[i] = *(cv[i]); // Coordinate copy
-    }
-
-    return csf->create(std::move(vect)); // takes ownership of the vector
+    return p.x < q.x || (p.x == q.x && p.y < q.y);
 }
 
-/* private */
-void
-ConvexHull::computeOctPts(const Coordinate::ConstVect& p_inputPts,
-                          Coordinate::ConstVect& pts)
+bool
+equalXY(const Coordinate& p, const Coordinate& q)
 {
-    // Initialize all slots with first input coordinate
-    pts = Coordinate::ConstVect(8, p_inputPts[0]);
+    return p.equals2D(q);
+}
 
-    for(std::size_t i = 1, n = p_inputPts.size(); i < n; ++i) {
-        if(p_inputPts[i]->x < pts[0]->x) {
-            pts[0] = p_inputPts[i];
+/*
+ * Removes the points [begin, end) strictly inside the octagon of the
+ * extreme points in the 8 directions at multiples of 45 degrees, which
+ * cannot be vertices of the hull, and returns the new end of the range.
+ *
+ * Points near the edges of the octagon are kept, so the rounding
+ * errors of the test do not affect the hull. The test has no branches
+ * and no calls, so the compiler can vectorize it.
+ */
+CoordIt
+octagonFilter(CoordIt begin, CoordIt end)
+{
+    // the extreme points, clockwise from the leftmost one
+    const Coordinate* oct[8];
+    std::fill(oct, oct + 8, &*begin);
+    for(CoordIt it = begin + 1; it != end; ++it) {
+        const Coordinate& p = *it;
+        if(p.x < oct[0]->x) {
+            oct[0] = &p;
         }
-        if(p_inputPts[i]->x - p_inputPts[i]->y < pts[1]->x - pts[1]->y) {
-            pts[1] = p_inputPts[i];
+        if(p.x - p.y < oct[1]->x - oct[1]->y) {
+            oct[1] = &p;
         }
-        if(p_inputPts[i]->y > pts[2]->y) {
-            pts[2] = p_inputPts[i];
+        if(p.y > oct[2]->y) {
+            oct[2] = &p;
         }
-        if(p_inputPts[i]->x + p_inputPts[i]->y > pts[3]->x + pts[3]->y) {
-            pts[3] = p_inputPts[i];
+        if(p.x + p.y > oct[3]->x + oct[3]->y) {
+            oct[3] = &p;
         }
-        if(p_inputPts[i]->x > pts[4]->x) {
-            pts[4] = p_inputPts[i];
+        if(p.x > oct[4]->x) {
+            oct[4] = &p;
         }
-        if(p_inputPts[i]->x - p_inputPts[i]->y > pts[5]->x - pts[5]->y) {
-            pts[5] = p_inputPts[i];
+        if(p.x - p.y > oct[5]->x - oct[5]->y) {
+            oct[5] = &p;
         }
-        if(p_inputPts[i]->y < pts[6]->y) {
-            pts[6] = p_inputPts[i];
+        if(p.y < oct[6]->y) {
+            oct[6] = &p;
         }
-        if(p_inputPts[i]->x + p_inputPts[i]->y < pts[7]->x + pts[7]->y) {
-            pts[7] = p_inputPts[i];
+        if(p.x + p.y < oct[7]->x + oct[7]->y) {
+            oct[7] = &p;
         }
     }
 
-}
-
-
-/* private */
-bool
-ConvexHull::computeOctRing(const Coordinate::ConstVect& p_inputPts,
-                           Coordinate::ConstVect& dest)
-{
-    computeOctPts(p_inputPts, dest);
-
-    // Remove consecutive equal Coordinates
-    // unique() returns an iterator to the end of the resulting
-    // sequence, we erase from there to the end.
-    dest.erase(std::unique(dest.begin(), dest.end()), dest.end());
-
-    // points must all lie in a line
-    if(dest.size() < 3) {
-        return false;
+    // remove repeated vertices; the points may all lie in a line
+    Coordinate ring[8];
+    std::size_t numVertices = 0;
+    for(const Coordinate* v : oct) {
+        if(numVertices == 0 || !v->equals2D(ring[numVertices - 1])) {
+            ring[numVertices++] = *v;
+        }
+    }
+    while(numVertices > 1 && ring[numVertices - 1].equals2D(ring[0])) {
+        numVertices--;
+    }
+    if(numVertices < 3) {
+        return end;
     }
 
-    // close ring
-    dest.push_back(dest[0]);
+    double ax[8], ay[8], dx[8], dy[8];
+    for(std::size_t i = 0; i < numVertices; i++) {
+        const Coordinate& b = ring[(i + 1) % numVertices];
+        ax[i] = ring[i].x;
+        ay[i] = ring[i].y;
+        dx[i] = b.x - ring[i].x;
+        dy[i] = b.y - ring[i].y;
+    }
 
-    return true;
+    // Keep the points which are not certainly on the right of every edge.
+    // Copies are made in place, since the output never passes the input.
+    CoordIt out = begin;
+    for(CoordIt it = begin; it != end; ++it) {
+        double px = it->x;
+        double py = it->y;
+        bool inside = true;
+        for(std::size_t i = 0; i < numVertices; i++) {
+            double detLeft = dx[i] * (py - ay[i]);
+            double detRight = dy[i] * (px - ax[i]);
+            inside &= detLeft - detRight < -DP_SAFE_EPSILON * (std::fabs(detLeft) + std::fabs(detRight));
+        }
+        if(!inside) {
+            *out++ = *it;
+        }
+    }
+    return out;
 }
 
-/* private */
+/*
+ * Computes the hull of the points [begin, end) with Andrew's monotone
+ * chain algorithm. The points are sorted by X and Y, and the vertices
+ * of the hull are written counterclockwise from the first point, without
+ * collinear vertices and without closing the ring.
+ */
 void
-ConvexHull::reduce(Coordinate::ConstVect& pts)
+monotoneChain(CoordIt begin, CoordIt end, std::vector<Coordinate>& hull)
 {
-    Coordinate::ConstVect polyPts;
+    std::sort(begin, end, lessXY);
+    end = std::unique(begin, end, equalXY);
 
-    if(! computeOctRing(pts, polyPts)) {
-        // unable to compute interior polygon for some reason
+    hull.clear();
+    if(end - begin < 3) {
+        hull.assign(begin, end);
         return;
     }
 
-    // add points defining polygon
-    Coordinate::ConstSet reducedSet;
-    reducedSet.insert(polyPts.begin(), polyPts.end());
-
-    /*
-     * Add all unique points not in the interior poly.
-     * CGAlgorithms.isPointInRing is not defined for points
-     * actually on the ring, but this doesn't matter since
-     * the points of the interior polygon are forced to be
-     * in the reduced set.
-     *
-     * @@TIP: there should be a std::algo for this
-     */
-    for(std::size_t i = 0, n = pts.size(); i < n; ++i) {
-        if(!PointLocation::isInRing(*(pts[i]), polyPts)) {
-            reducedSet.insert(pts[i]);
+    // lower chain, left to right
+    for(CoordIt it = begin; it != end; ++it) {
+        while(hull.size() >= 2 &&
+                Orientation::index(hull[hull.size() - 2], hull.back(), *it) != Orientation::COUNTERCLOCKWISE) {
+            hull.pop_back();
         }
+        hull.push_back(*it);
     }
 
-    inputPts.assign(reducedSet.begin(), reducedSet.end());
-
-    if(inputPts.size() < 3) {
-        padArray3(inputPts);
+    // upper chain, right to left
+    std::size_t lowerSize = hull.size();
+    for(CoordIt it = end - 1; it != begin;) {
+        --it;
+        while(hull.size() > lowerSize &&
+                Orientation::index(hull[hull.size() - 2], hull.back(), *it) != Orientation::COUNTERCLOCKWISE) {
+            hull.pop_back();
+        }
+        hull.push_back(*it);
     }
+
+    // the first point closes the upper chain
+    hull.pop_back();
 }
 
-/* private */
+/*
+ * Reduces and computes the hull of the points [begin, end).
+ */
 void
-ConvexHull::padArray3(geom::Coordinate::ConstVect& pts)
+computePartHull(CoordIt begin, CoordIt end, std::vector<Coordinate>& hull)
 {
-    for(std::size_t i = pts.size(); i < 3; ++i) {
-        pts.push_back(pts[0]);
+    if(static_cast<std::size_t>(end - begin) > OCTAGON_MIN_POINTS) {
+        end = octagonFilter(begin, end);
     }
+    monotoneChain(begin, end, hull);
 }
 
-std::unique_ptr<Geometry>
-ConvexHull::getConvexHull()
-{
-    std::size_t nInputPts = inputPts.size();
-
-    if(nInputPts == 0) { // Return an empty geometry
-        return geomFactory->createEmptyGeometry();
-    }
+} // unnamed namespace
 
-    if(nInputPts == 1) { // Return a Point
-        // Copy the Coordinate from the ConstVect
-        return std::unique_ptr<Geometry>(geomFactory->createPoint(*(inputPts[0])));
-    }
+/* private */
+void
+ConvexHull::extractCoordinates(const Geometry* geom)
+{
+    inputPts.reserve(geom->getNumPoints());
+    CoordinateCollector filter(inputPts);
+    geom->apply_ro(&filter);
+}
 
-    if(nInputPts == 2) { // Return a LineString
-        // Copy all Coordinates from the ConstVect
-        auto cs = toCoordinateSequence(inputPts);
-        return geomFactory->createLineString(std::move(cs));
+/* private */
+void
+ConvexHull::computeHull(std::vector<Coordinate>& hull)
+{
+    std::size_t n = inputPts.size();
+    std::size_t numParts = 1;
+    if(executor != nullptr) {
+        numParts = std::min(executor->getNumThreads(), n / MIN_POINTS_PER_THREAD);
     }
 
-    // use heuristic to reduce points, if large
-    if(nInputPts > 50) {
-        reduce(inputPts);
+    if(numParts <= 1) {
+        computePartHull(inputPts.begin(), inputPts.end(), hull);
+        return;
     }
 
-    GEOS_CHECK_FOR_INTERRUPTS();
-
-    // sort points for Graham scan.
-    preSort(inputPts);
-
-    GEOS_CHECK_FOR_INTERRUPTS();
-
-    // Use Graham scan to find convex hull.
-    Coordinate::ConstVect cHS;
-    grahamScan(inputPts, cHS);
+    // the hull of the hulls of the parts
+    std::vector<std::vector<Coordinate>> partHulls(numParts);
+    executor->parallelFor(numParts, 1, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; i++) {
+            computePartHull(inputPts.begin() + static_cast<std::ptrdiff_t>(n * i / numParts),
+                            inputPts.begin() + static_cast<std::ptrdiff_t>(n * (i + 1) / numParts),
+                            partHulls[i]);
+        }
+    }, numParts);
 
     GEOS_CHECK_FOR_INTERRUPTS();
 
-    return lineOrPolygon(cHS);
+    std::vector<Coordinate> pts;
+    for(const auto& partHull : partHulls) {
+        pts.insert(pts.end(), partHull.begin(), partHull.end());
+    }
+    monotoneChain(pts.begin(), pts.end(), hull);
 }
 
-/* private */
-void
-ConvexHull::preSort(Coordinate::ConstVect& pts)
+std::unique_ptr<Geometry>
+ConvexHull::getConvexHull()
 {
-    // find the lowest point in the set. If two or more points have
-    // the same minimum y coordinate choose the one with the minimum x.
-    // This focal point is put in array location pts[0].
-    for(std::size_t i = 1, n = pts.size(); i < n; ++i) {
-        const Coordinate* p0 = pts[0]; // this will change
-        const Coordinate* pi = pts[i];
-        if((pi->y < p0->y) || ((pi->y == p0->y) && (pi->x < p0->x))) {
-            const Coordinate* t = p0;
-            pts[0] = pi;
-            pts[i] = t;
-        }
+    if(inputPts.empty()) { // Return an empty geometry
+        return geomFactory->createEmptyGeometry();
     }
 
-    // sort the points radially around the focal point.
-    std::sort(pts.begin(), pts.end(), RadiallyLessThen(pts[0]));
-}
+    const Coordinate first = inputPts[0];
 
-/*private*/
-void
-ConvexHull::grahamScan(const Coordinate::ConstVect& c,
-                       Coordinate::ConstVect& ps)
-{
-    ps.push_back(c[0]);
-    ps.push_back(c[1]);
-    ps.push_back(c[2]);
-
-    for(std::size_t i = 3, n = c.size(); i < n; ++i) {
-        const Coordinate* p = ps.back();
-        ps.pop_back();
-        while(!ps.empty() &&
-                Orientation::index(
-                    *(ps.back()), *p, *(c[i])) > 0) {
-            p = ps.back();
-            ps.pop_back();
-        }
-        ps.push_back(p);
-        ps.push_back(c[i]);
-    }
-    ps.push_back(c[0]);
-}
+    std::vector<Coordinate> hull;
+    computeHull(hull);
 
+    GEOS_CHECK_FOR_INTERRUPTS();
 
-/*private*/
-bool
-ConvexHull::isBetween(const Coordinate& c1, const Coordinate& c2, const Coordinate& c3)
-{
-    if(Orientation::index(c1, c2, c3) != 0) {
-        return false;
-    }
-    if(c1.x != c3.x) {
-        if(c1.x <= c2.x && c2.x <= c3.x) {
-            return true;
-        }
-        if(c3.x <= c2.x && c2.x <= c1.x) {
-            return true;
-        }
+    if(hull.size() == 1) { // Return a Point
+        return std::unique_ptr<Geometry>(geomFactory->createPoint(hull[0]));
     }
-    if(c1.y != c3.y) {
-        if(c1.y <= c2.y && c2.y <= c3.y) {
-            return true;
-        }
-        if(c3.y <= c2.y && c2.y <= c1.y) {
-            return true;
+
+    if(hull.size() == 2) {
+        // The points lie in a line. Two distinct input points are kept in
+        // input order, otherwise the lowest end comes first.
+        bool twoPoints = std::all_of(inputPts.begin(), inputPts.end(), [&hull](const Coordinate& p) {
+            return p.equals2D(hull[0]) || p.equals2D(hull[1]);
+        });
+        const Coordinate& p0 = hull[0];
+        const Coordinate& p1 = hull[1];
+        if(twoPoints ? p1.equals2D(first) : (p1.y < p0.y || (p1.y == p0.y && p1.x < p0.x))) {
+            std::swap(hull[0], hull[1]);
         }
     }
-    return false;
-}
 
+    return lineOrPolygon(hull);
+}
 
 /* private */
 std::unique_ptr<Geometry>
-ConvexHull::lineOrPolygon(const Coordinate::ConstVect& input)
+ConvexHull::lineOrPolygon(std::vector<Coordinate>& hull)
 {
-    Coordinate::ConstVect cleaned;
-
-    cleanRing(input, cleaned);
+    const CoordinateSequenceFactory* csf =
+        geomFactory->getCoordinateSequenceFactory();
 
-    if(cleaned.size() == 3) { // shouldn't this be 2 ??
-        cleaned.resize(2);
-        auto cl1 = toCoordinateSequence(cleaned);
-        return geomFactory->createLineString(std::move(cl1));
+    if(hull.size() == 2) {
+        return geomFactory->createLineString(csf->create(std::move(hull)));
     }
-    auto cl2 = toCoordinateSequence(cleaned);
-    std::unique_ptr<LinearRing> linearRing = geomFactory->createLinearRing(std::move(cl2));
-    return geomFactory->createPolygon(std::move(linearRing));
-}
-
-/*private*/
-void
-ConvexHull::cleanRing(const Coordinate::ConstVect& original,
-                      Coordinate::ConstVect& cleaned)
-{
-    std::size_t npts = original.size();
-
-    const Coordinate* last = original[npts - 1];
-
-    //util::Assert::equals(*(original[0]), *last);
-    assert(last);
-    assert(original[0]->equals2D(*last));
 
-    const Coordinate* prev = nullptr;
-    for(std::size_t i = 0; i < npts - 1; ++i) {
-        const Coordinate* curr = original[i];
-        const Coordinate* next = original[i + 1];
-
-        // skip consecutive equal coordinates
-        if(curr->equals2D(*next)) {
-            continue;
-        }
-
-        if(prev != nullptr &&  isBetween(*prev, *curr, *next)) {
-            continue;
+    // The shell is clockwise, from the lowest vertex, and the lowest
+    // of those the leftmost one.
+    std::size_t start = 0;
+    for(std::size_t i = 1; i < hull.size(); i++) {
+        const Coordinate& p = hull[i];
+        const Coordinate& s = hull[start];
+        if(p.y < s.y || (p.y == s.y && p.x < s.x)) {
+            start = i;
         }
-
-        cleaned.push_back(curr);
-        prev = curr;
     }
 
-    cleaned.push_back(last);
+    std::vector<Coordinate> shell;
+    shell.reserve(hull.size() + 1);
+    for(std::size_t i = 0; i < hull.size(); i++) {
+        shell.push_back(hull[(start + hull.size() - i) % hull.size()]);
+    }
+    shell.push_back(hull[start]);
 
+    std::unique_ptr<LinearRing> linearRing = geomFactory->createLinearRing(csf->create(std::move(shell)));
+    return geomFactory->createPolygon(std::move(linearRing));
 }
 
 
 } // namespace geos.algorithm
 } // namespace geos
-
@@ -30,6 +30,8 @@
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
+#include <algorithm>
+#include <array>
 #include <typeinfo> // for dynamic_cast
 #include <cassert>
 
@@ -127,7 +129,7 @@ LargestEmptyCircle::getRadiusLine()
 
 /* private */
 void
-LargestEmptyCircle::createInitialGrid(const Envelope* env, std::priority_queue<Cell>& cellQueue)
+LargestEmptyCircle::createInitialGrid(const Envelope* env)
 {
     double minX = env->getMinX();
     double maxX = env->getMaxX();
@@ -141,7 +143,7 @@ LargestEmptyCircle::createInitialGrid(const Envelope* env, std::priority_queue<C
     // compute initial grid of cells to cover area
     for (double x = minX; x < maxX; x += cellSize) {
         for (double y = minY; y < maxY; y += cellSize) {
-            cellQueue.emplace(x+hSize, y+hSize, hSize, distanceToConstraints(x+hSize, y+hSize));
+            pushCell(x+hSize, y+hSize, hSize);
         }
     }
 }
@@ -183,13 +185,12 @@ double
 LargestEmptyCircle::distanceToConstraints(const Coordinate& c)
 {
     bool isOutside = ptLocator && (Location::EXTERIOR == ptLocator->locate(&c));
-    std::unique_ptr<Point> pt(factory->createPoint(c));
     if (isOutside) {
-        double boundaryDist = boundaryDistance->distance(pt.get());
+        double boundaryDist = boundaryDistance->distance(c);
         return -boundaryDist;
 
     }
-    double dist = obstacleDistance.distance(pt.get());
+    double dist = obstacleDistance.distance(c);
     return dist;
 }
 
@@ -201,6 +202,46 @@ LargestEmptyCircle::distanceToConstraints(double x, double y)
     return distanceToConstraints(coord);
 }
 
+/* private */
+void
+LargestEmptyCircle::pushCell(double x, double y, double hSize)
+{
+    cellQueue.emplace_back(x, y, hSize, distanceToConstraints(x, y));
+    std::push_heap(cellQueue.begin(), cellQueue.end());
+}
+
+/* private */
+LargestEmptyCircle::Cell
+LargestEmptyCircle::popCell()
+{
+    std::pop_heap(cellQueue.begin(), cellQueue.end());
+    Cell cell = cellQueue.back();
+    cellQueue.pop_back();
+    return cell;
+}
+
+/* private */
+void
+LargestEmptyCircle::splitCell(const Cell& cell)
+{
+    // split the cell into four sub-cells, evaluated together
+    double h2 = cell.getHSize() / 2;
+    const std::array<Coordinate, 4> centers {{
+        Coordinate(cell.getX()-h2, cell.getY()-h2),
+        Coordinate(cell.getX()+h2, cell.getY()-h2),
+        Coordinate(cell.getX()-h2, cell.getY()+h2),
+        Coordinate(cell.getX()+h2, cell.getY()+h2)
+    }};
+    std::array<double, 4> dist;
+    for (std::size_t i = 0; i < centers.size(); i++) {
+        dist[i] = distanceToConstraints(centers[i]);
+    }
+    for (std::size_t i = 0; i < centers.size(); i++) {
+        cellQueue.emplace_back(centers[i].x, centers[i].y, h2, dist[i]);
+        std::push_heap(cellQueue.begin(), cellQueue.end());
+    }
+}
+
 /* private */
 LargestEmptyCircle::Cell
 LargestEmptyCircle::createCentroidCell(const Geometry* geom)
@@ -229,9 +270,8 @@ LargestEmptyCircle::compute()
         return;
     }
 
-    // Priority queue of cells, ordered by decreasing distance from constraints
-    std::priority_queue<Cell> cellQueue;
-    createInitialGrid(obstacles->getEnvelopeInternal(), cellQueue);
+    cellQueue.clear();
+    createInitialGrid(obstacles->getEnvelopeInternal());
 
     Cell farthestCell = createCentroidCell(obstacles);
 
@@ -242,8 +282,7 @@ LargestEmptyCircle::compute()
     while (!cellQueue.empty()) {
 
         // pick the most promising cell from the queue
-        Cell cell = cellQueue.top();
-        cellQueue.pop();
+        Cell cell = popCell();
 
         // update the center cell if the candidate is further from the constraints
         if (cell.getDistance() > farthestCell.getDistance()) {
@@ -258,12 +297,7 @@ LargestEmptyCircle::compute()
         * since no point in it can be further than the current farthest distance.
         */
         if (mayContainCircleCenter(cell, farthestCell)) {
-            // split the cell into four sub-cells
-            double h2 = cell.getHSize() / 2;
-            cellQueue.emplace(cell.getX()-h2, cell.getY()-h2, h2, distanceToConstraints(cell.getX()-h2, cell.getY()-h2));
-            cellQueue.emplace(cell.getX()+h2, cell.getY()-h2, h2, distanceToConstraints(cell.getX()+h2, cell.getY()-h2));
-            cellQueue.emplace(cell.getX()-h2, cell.getY()+h2, h2, distanceToConstraints(cell.getX()-h2, cell.getY()+h2));
-            cellQueue.emplace(cell.getX()+h2, cell.getY()+h2, h2, distanceToConstraints(cell.getX()+h2, cell.getY()+h2));
+            splitCell(cell);
         }
     }
 
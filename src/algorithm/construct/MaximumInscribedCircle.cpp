@@ -30,6 +30,8 @@
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
+#include <algorithm>
+#include <array>
 #include <typeinfo> // for dynamic_cast
 #include <cassert>
 
@@ -110,7 +112,7 @@ MaximumInscribedCircle::getRadiusLine()
 
 /* private */
 void
-MaximumInscribedCircle::createInitialGrid(const Envelope* env, std::priority_queue<Cell>& cellQueue)
+MaximumInscribedCircle::createInitialGrid(const Envelope* env)
 {
     double minX = env->getMinX();
     double maxX = env->getMaxX();
@@ -124,7 +126,7 @@ MaximumInscribedCircle::createInitialGrid(const Envelope* env, std::priority_que
     // compute initial grid of cells to cover area
     for (double x = minX; x < maxX; x += cellSize) {
         for (double y = minY; y < maxY; y += cellSize) {
-            cellQueue.emplace(x+hSize, y+hSize, hSize, distanceToBoundary(x+hSize, y+hSize));
+            pushCell(x+hSize, y+hSize, hSize);
         }
     }
 }
@@ -133,9 +135,7 @@ MaximumInscribedCircle::createInitialGrid(const Envelope* env, std::priority_que
 double
 MaximumInscribedCircle::distanceToBoundary(const Coordinate& c)
 {
-    std::unique_ptr<Point> pt(factory->createPoint(c));
-    double dist = indexedDistance.distance(pt.get());
-    // double dist = inputGeomBoundary->distance(pt.get());
+    double dist = indexedDistance.distance(c);
     bool isOutside = (Location::EXTERIOR == ptLocator.locate(&c));
     if (isOutside) return -dist;
     return dist;
@@ -149,6 +149,46 @@ MaximumInscribedCircle::distanceToBoundary(double x, double y)
     return distanceToBoundary(coord);
 }
 
+/* private */
+void
+MaximumInscribedCircle::pushCell(double x, double y, double hSize)
+{
+    cellQueue.emplace_back(x, y, hSize, distanceToBoundary(x, y));
+    std::push_heap(cellQueue.begin(), cellQueue.end());
+}
+
+/* private */
+MaximumInscribedCircle::Cell
+MaximumInscribedCircle::popCell()
+{
+    std::pop_heap(cellQueue.begin(), cellQueue.end());
+    Cell cell = cellQueue.back();
+    cellQueue.pop_back();
+    return cell;
+}
+
+/* private */
+void
+MaximumInscribedCircle::splitCell(const Cell& cell)
+{
+    // split the cell into four sub-cells, evaluated together
+    double h2 = cell.getHSize() / 2;
+    const std::array<Coordinate, 4> centers {{
+        Coordinate(cell.getX()-h2, cell.getY()-h2),
+        Coordinate(cell.getX()+h2, cell.getY()-h2),
+        Coordinate(cell.getX()-h2, cell.getY()+h2),
+        Coordinate(cell.getX()+h2, cell.getY()+h2)
+    }};
+    std::array<double, 4> dist;
+    for (std::size_t i = 0; i < centers.size(); i++) {
+        dist[i] = distanceToBoundary(centers[i]);
+    }
+    for (std::size_t i = 0; i < centers.size(); i++) {
+        cellQueue.emplace_back(centers[i].x, centers[i].y, h2, dist[i]);
+        std::push_heap(cellQueue.begin(), cellQueue.end());
+    }
+}
+
 /* private */
 MaximumInscribedCircle::Cell
 MaximumInscribedCircle::createCentroidCell(const Geometry* geom)
@@ -167,10 +207,8 @@ MaximumInscribedCircle::compute()
     // check if already computed
     if (done) return;
 
-    // Priority queue of cells, ordered by maximum distance from boundary
-    std::priority_queue<Cell> cellQueue;
-
-    createInitialGrid(inputGeom->getEnvelopeInternal(), cellQueue);
+    cellQueue.clear();
+    createInitialGrid(inputGeom->getEnvelopeInternal());
 
     // use the area centroid as the initial candidate center point
     Cell farthestCell = createCentroidCell(inputGeom);
@@ -181,8 +219,7 @@ MaximumInscribedCircle::compute()
      */
     while (!cellQueue.empty()) {
         // pick the most promising cell from the queue
-        Cell cell = cellQueue.top();
-        cellQueue.pop();
+        Cell cell = popCell();
 
         // std::cout << i << ": (" << cell.getX() << ", " << cell.getY() << ") " << cell.getHSize() << " dist = " << cell.getDistance() << std::endl;
 
@@ -199,12 +236,7 @@ MaximumInscribedCircle::compute()
         */
         double potentialIncrease = cell.getMaxDistance() - farthestCell.getDistance();
         if (potentialIncrease > tolerance) {
-            // split the cell into four sub-cells
-            double h2 = cell.getHSize() / 2;
-            cellQueue.emplace(cell.getX()-h2, cell.getY()-h2, h2, distanceToBoundary(cell.getX()-h2, cell.getY()-h2));
-            cellQueue.emplace(cell.getX()+h2, cell.getY()-h2, h2, distanceToBoundary(cell.getX()+h2, cell.getY()-h2));
-            cellQueue.emplace(cell.getX()-h2, cell.getY()+h2, h2, distanceToBoundary(cell.getX()-h2, cell.getY()+h2));
-            cellQueue.emplace(cell.getX()+h2, cell.getY()+h2, h2, distanceToBoundary(cell.getX()+h2, cell.getY()+h2));
+            splitCell(cell);
         }
     }
     // std::cout << "number of iterations: " << i << std::endl;
@@ -27,7 +27,6 @@
 #include <vector>
 #include <algorithm>
 #include <limits>
-#include <iostream>
 using namespace geos::geom;
 
 namespace geos {
@@ -71,92 +70,111 @@ void DiscreteFrechetDistance::setDensifyFraction(double dFrac)
 }
 
 /* private */
-
-geom::Coordinate
-DiscreteFrechetDistance::getSegementAt(const CoordinateSequence& seq, std::size_t index)
+std::vector<geom::Coordinate>
+DiscreteFrechetDistance::getDiscretePoints(const CoordinateSequence& seq) const
 {
+    std::vector<Coordinate> pts;
     if(densifyFrac > 0.0) {
         // Validity of the cast to size_t has been verified in setDensifyFraction()
         std::size_t numSubSegs =  std::size_t(util::round(1.0 / densifyFrac));
-        std::size_t i = index / numSubSegs;
-        std::size_t j = index % numSubSegs;
-        if(i >= seq.size() - 1) {
-            return seq.getAt(seq.size() - 1);
+        pts.reserve(numSubSegs * (seq.size() - 1) + 1);
+        for(std::size_t i = 0; i < seq.size() - 1; i++) {
+            const geom::Coordinate& p0 = seq.getAt(i);
+            const geom::Coordinate& p1 = seq.getAt(i + 1);
+
+            double delx = (p1.x - p0.x) / static_cast<double>(numSubSegs);
+            double dely = (p1.y - p0.y) / static_cast<double>(numSubSegs);
+
+            for(std::size_t j = 0; j < numSubSegs; j++) {
+                double x = p0.x + static_cast<double>(j) * delx;
+                double y = p0.y + static_cast<double>(j) * dely;
+                pts.emplace_back(x, y);
+            }
         }
-        const geom::Coordinate& p0 = seq.getAt(i);
-        const geom::Coordinate& p1 = seq.getAt(i + 1);
-
-        double delx = (p1.x - p0.x) / static_cast<double>(numSubSegs);
-        double dely = (p1.y - p0.y) / static_cast<double>(numSubSegs);
-
-        double x = p0.x + static_cast<double>(j) * delx;
-        double y = p0.y + static_cast<double>(j) * dely;
-        Coordinate pt(x, y);
-        return pt;
+        pts.push_back(seq.getAt(seq.size() - 1));
     }
     else {
-        return seq.getAt(index);
+        seq.toVector(pts);
     }
+    return pts;
 }
 
-PointPairDistance&
-DiscreteFrechetDistance::getFrecheDistance(std::vector< std::vector<PointPairDistance> >& ca, std::size_t i, std::size_t j,
-        const CoordinateSequence& p, const CoordinateSequence& q)
+/* private static */
+DiscreteFrechetDistance::Coupling
+DiscreteFrechetDistance::getCoupling(const Coupling* d1, const Coupling* d2, const Coupling* d3,
+                                     const Coupling& pairDist)
 {
-    PointPairDistance p_ptDist;
-    if(! ca[i][j].getIsNull()) {
-        return ca[i][j];
-    }
-    p_ptDist.initialize(getSegementAt(p, i), getSegementAt(q, j));
-    if(i == 0 && j == 0) {
-        ca[i][j] = ptDist;
-    }
-    else if(i > 0 && j == 0) {
-        PointPairDistance nextDist = getFrecheDistance(ca, i - 1, 0, p, q);
-        ca[i][j] = (nextDist.getDistance() > p_ptDist.getDistance()) ? nextDist : p_ptDist;
-    }
-    else if(i == 0 && j > 0) {
-        PointPairDistance nextDist = getFrecheDistance(ca, 0, j - 1, p, q);
-        ca[i][j] = (nextDist.getDistance() > p_ptDist.getDistance()) ? nextDist : p_ptDist;
-    }
-    else {
-        PointPairDistance d1 = getFrecheDistance(ca, i - 1, j, p, q),
-                          d2 = getFrecheDistance(ca, i - 1, j - 1, p, q),
-                          d3 = getFrecheDistance(ca, i, j - 1, p, q);
-        PointPairDistance& minDist = (d1.getDistance() < d2.getDistance()) ? d1 : d2;
-        if(d3.getDistance() < minDist.getDistance()) {
+    const Coupling* minDist;
+    if(d1 && d2 && d3) {
+        minDist = (d1->distance < d2->distance) ? d1 : d2;
+        if(d3->distance < minDist->distance) {
             minDist = d3;
         }
-        ca[i][j] = (minDist.getDistance() > p_ptDist.getDistance()) ? minDist : p_ptDist;
     }
-
-    return ca[i][j];
+    else {
+        minDist = d1 ? d1 : d3;
+    }
+    return (minDist && minDist->distance > pairDist.distance) ? *minDist : pairDist;
 }
 
+/* private */
 void
 DiscreteFrechetDistance::compute(
     const geom::Geometry& discreteGeom,
     const geom::Geometry& geom)
 {
+    if(discreteGeom.isEmpty() || geom.isEmpty()) {
+        throw util::IllegalArgumentException(
+            "DiscreteFrechetDistance called with empty inputs.");
+    }
+
     auto lp = discreteGeom.getCoordinates();
     auto lq = geom.getCoordinates();
-    std::size_t pSize, qSize;
-    if(densifyFrac > 0) {
-        std::size_t numSubSegs =  std::size_t(util::round(1.0 / densifyFrac));
-        pSize = numSubSegs * (lp->size() - 1) + 1;
-        qSize = numSubSegs * (lq->size() - 1) + 1;
+    std::vector<Coordinate> p = getDiscretePoints(*lp);
+    std::vector<Coordinate> q = getDiscretePoints(*lq);
+
+    auto pairDist = [&p, &q](std::size_t i, std::size_t j) {
+        return Coupling{ p[i].distance(q[j]), i, j };
+    };
+
+    /*
+     * The coupling distance of cell (i, j) depends only on cells
+     * (i - 1, j), (i - 1, j - 1) and (i, j - 1),
+     * so the table is computed one row at a time,
+     * keeping only the previous row.
+     * Rows run along the longer of the two sequences,
+     * so memory use is linear in the size of the shorter one.
+     */
+    std::vector<Coupling> prevRow, row;
+    if(p.size() <= q.size()) {
+        prevRow.resize(p.size());
+        row.resize(p.size());
+        for(std::size_t j = 0; j < q.size(); j++) {
+            for(std::size_t i = 0; i < p.size(); i++) {
+                row[i] = getCoupling(i > 0 ? &row[i - 1] : nullptr,
+                                     i > 0 && j > 0 ? &prevRow[i - 1] : nullptr,
+                                     j > 0 ? &prevRow[i] : nullptr,
+                                     pairDist(i, j));
+            }
+            std::swap(row, prevRow);
+        }
     }
     else {
-        pSize = lp->size();
-        qSize = lq->size();
-    }
-    std::vector< std::vector<PointPairDistance> > ca(pSize, std::vector<PointPairDistance>(qSize));
-    for(std::size_t i = 0; i < pSize; i++) {
-        for(std::size_t j = 0; j < qSize; j++) {
-            ca[i][j].initialize();
+        prevRow.resize(q.size());
+        row.resize(q.size());
+        for(std::size_t i = 0; i < p.size(); i++) {
+            for(std::size_t j = 0; j < q.size(); j++) {
+                row[j] = getCoupling(i > 0 ? &prevRow[j] : nullptr,
+                                     i > 0 && j > 0 ? &prevRow[j - 1] : nullptr,
+                                     j > 0 ? &row[j - 1] : nullptr,
+                                     pairDist(i, j));
+            }
+            std::swap(row, prevRow);
         }
     }
-    ptDist = getFrecheDistance(ca, pSize - 1, qSize - 1, *lp, *lq);
+
+    const Coupling& result = prevRow.back();
+    ptDist.initialize(p[result.i], q[result.j]);
 }
 
 } // namespace geos.algorithm.distance
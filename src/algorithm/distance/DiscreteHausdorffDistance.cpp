@@ -17,46 +17,312 @@
  **********************************************************************/
 
 #include <geos/algorithm/distance/DiscreteHausdorffDistance.h>
+#include <geos/geom/CoordinateFilter.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFilter.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/operation/distance/FacetSequence.h>
+#include <geos/operation/distance/FacetSequenceTreeBuilder.h>
+#include <geos/util/Executor.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/math.h>
 
 #include <typeinfo>
 #include <cassert>
 #include <limits>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
 
 using namespace geos::geom;
+using geos::index::strtree::TemplateSTRtree;
+using geos::operation::distance::FacetSequence;
+using geos::operation::distance::FacetSequenceTreeBuilder;
 
 namespace geos {
 namespace algorithm { // geos.algorithm
 namespace distance { // geos.algorithm.distance
 
-void
-DiscreteHausdorffDistance::MaxDensifiedByFractionDistanceFilter::filter_ro(
-    const geom::CoordinateSequence& seq, std::size_t index)
-{
+namespace {
+
+// The number of points below which a search is not split between threads
+const std::size_t MIN_POINTS_PER_THREAD = 1 << 12;
+
+/*
+ * Computes the maximum over a set of points of the distance
+ * to the nearest facet of a geometry.
+ *
+ * The facets are held in an STR tree, which is searched best-first
+ * from each point.
+ * A search stops as soon as a facet is found which is no further
+ * than the current maximum, since the point cannot increase it.
+ * Points near to each other usually have similar distances,
+ * so most searches terminate after visiting a few facets.
+ */
+class MaxFacetDistance {
+public:
+
+    using Tree = TemplateSTRtree<const FacetSequence*>;
+
     /*
-     * This logic also handles skipping Point geometries
+     * The tree must be built. It is only read, so it can be
+     * shared by several instances searching in different threads.
      */
-    if(index == 0) {
-        return;
+    explicit MaxFacetDistance(Tree& p_tree)
+        : tree(p_tree)
+    {}
+
+    void
+    add(const Coordinate& pt)
+    {
+        minPtDist.initialize();
+        // an empty geometry leaves minPtDist null, as DistanceToPoint does
+        if(computeDistance(pt)) {
+            maxPtDist.setMaximum(minPtDist);
+        }
     }
 
-    const geom::Coordinate& p0 = seq.getAt(index - 1);
-    const geom::Coordinate& p1 = seq.getAt(index);
+    const PointPairDistance&
+    getMaxPointDistance() const
+    {
+        return maxPtDist;
+    }
 
-    double delx = (p1.x - p0.x) / static_cast<double>(numSubSegs);
-    double dely = (p1.y - p0.y) / static_cast<double>(numSubSegs);
+private:
 
-    for(std::size_t i = 0; i < numSubSegs; ++i) {
-        double x = p0.x + static_cast<double>(i) * delx;
-        double y = p0.y + static_cast<double>(i) * dely;
-        Coordinate pt(x, y);
-        minPtDist.initialize();
-        DistanceToPoint::computeDistance(geom, pt, minPtDist);
-        maxPtDist.setMaximum(minPtDist);
+    using Node = Tree::Node;
+
+    Tree& tree;
+    /// The search queue, as a min-heap on the squared distance to the node bounds
+    std::vector<std::pair<double, const Node*>> queue;
+    PointPairDistance maxPtDist;
+    PointPairDistance minPtDist;
+
+    static double
+    distanceSquared(const PointPairDistance& ppd)
+    {
+        return ppd.getCoordinate(0).distanceSquared(ppd.getCoordinate(1));
+    }
+
+    static double
+    distanceSquared(const Envelope& env, const Coordinate& pt)
+    {
+        double dx = std::max(0.0, std::max(env.getMinX() - pt.x, pt.x - env.getMaxX()));
+        double dy = std::max(0.0, std::max(env.getMinY() - pt.y, pt.y - env.getMaxY()));
+        return dx * dx + dy * dy;
     }
 
+    void
+    computeFacetDistance(const FacetSequence& facets, const Coordinate& pt)
+    {
+        if(facets.isPoint()) {
+            minPtDist.setMinimum(*facets.getCoordinate(0), pt);
+            return;
+        }
+        LineSegment seg;
+        Coordinate closestPt;
+        for(std::size_t i = 1; i < facets.size(); i++) {
+            seg.p0 = *facets.getCoordinate(i - 1);
+            seg.p1 = *facets.getCoordinate(i);
+            seg.closestPoint(pt, closestPt);
+            minPtDist.setMinimum(closestPt, pt);
+        }
+    }
+
+    /*
+     * Computes the nearest point to pt in minPtDist.
+     * Returns false if the search was stopped because
+     * pt is no further from the geometry than the current maximum.
+     */
+    bool
+    computeDistance(const Coordinate& pt)
+    {
+        const Node* root = tree.getRoot();
+        if(root == nullptr) {
+            return true;
+        }
+        // setMaximum only accepts strictly greater distances
+        double boundSq = maxPtDist.getIsNull() ? -1.0 : distanceSquared(maxPtDist);
+
+        auto cmp = std::greater<std::pair<double, const Node*>>();
+        queue.clear();
+        queue.emplace_back(distanceSquared(root->getBounds(), pt), root);
+        while(! queue.empty()) {
+            std::pop_heap(queue.begin(), queue.end(), cmp);
+            double nodeDistSq = queue.back().first;
+            const Node* node = queue.back().second;
+            queue.pop_back();
+
+            if(! minPtDist.getIsNull() && nodeDistSq > distanceSquared(minPtDist)) {
+                break;
+            }
+            if(node->isLeaf()) {
+                if(node->isDeleted()) {
+                    continue;
+                }
+                computeFacetDistance(*node->getItem(), pt);
+                if(distanceSquared(minPtDist) <= boundSq) {
+                    return false;
+                }
+                continue;
+            }
+            for(const Node* child = node->beginChildren(); child < node->endChildren(); ++child) {
+                queue.emplace_back(distanceSquared(child->getBounds(), pt), child);
+                std::push_heap(queue.begin(), queue.end(), cmp);
+            }
+        }
+        return true;
+    }
+};
+
+class MaxFacetDistanceFilter : public CoordinateFilter {
+public:
+    MaxFacetDistanceFilter(MaxFacetDistance& p_maxDist)
+        : maxDist(p_maxDist)
+    {}
+
+    void
+    filter_ro(const Coordinate* pt) override
+    {
+        maxDist.add(*pt);
+    }
+
+private:
+    MaxFacetDistance& maxDist;
+};
+
+class MaxDensifiedFacetDistanceFilter : public CoordinateSequenceFilter {
+public:
+    MaxDensifiedFacetDistanceFilter(MaxFacetDistance& p_maxDist, double fraction)
+        : maxDist(p_maxDist)
+        // Validity of the cast to size_t has been verified in setDensifyFraction()
+        , numSubSegs(std::size_t(util::round(1.0 / fraction)))
+    {}
+
+    void
+    filter_ro(const CoordinateSequence& seq, std::size_t index) override
+    {
+        // This logic also handles skipping Point geometries
+        if(index == 0) {
+            return;
+        }
+        const Coordinate& p0 = seq.getAt(index - 1);
+        const Coordinate& p1 = seq.getAt(index);
+
+        double delx = (p1.x - p0.x) / static_cast<double>(numSubSegs);
+        double dely = (p1.y - p0.y) / static_cast<double>(numSubSegs);
+
+        for(std::size_t i = 0; i < numSubSegs; ++i) {
+            double x = p0.x + static_cast<double>(i) * delx;
+            double y = p0.y + static_cast<double>(i) * dely;
+            maxDist.add(Coordinate(x, y));
+        }
+    }
+
+    bool
+    isGeometryChanged() const override
+    {
+        return false;
+    }
+
+    bool
+    isDone() const override
+    {
+        return false;
+    }
+
+private:
+    MaxFacetDistance& maxDist;
+    std::size_t numSubSegs;
+};
+
+class PointCollector : public CoordinateFilter {
+public:
+    PointCollector(std::vector<Coordinate>& p_pts)
+        : pts(p_pts)
+    {}
+
+    void
+    filter_ro(const Coordinate* pt) override
+    {
+        pts.push_back(*pt);
+    }
+
+private:
+    std::vector<Coordinate>& pts;
+};
+
+/*
+ * Collects the segments of a geometry, each one given by
+ * its sequence and the index of its end point.
+ */
+class SegmentCollector : public CoordinateSequenceFilter {
+public:
+    using Segment = std::pair<const CoordinateSequence*, std::size_t>;
+
+    SegmentCollector(std::vector<Segment>& p_segs)
+        : segs(p_segs)
+    {}
+
+    void
+    filter_ro(const CoordinateSequence& seq, std::size_t index) override
+    {
+        if(index > 0) {
+            segs.emplace_back(&seq, index);
+        }
+    }
+
+    bool
+    isGeometryChanged() const override
+    {
+        return false;
+    }
+
+    bool
+    isDone() const override
+    {
+        return false;
+    }
+
+private:
+    std::vector<Segment>& segs;
+};
+
+/*
+ * Splits the items [0, n) into numParts ranges, and searches the points
+ * of each range in a separate thread.
+ * The maxima of the ranges are merged in order, so the result is the
+ * same as when the items are processed in a single thread.
+ */
+template<class ItemFunction>
+void
+computeMaxInParts(MaxFacetDistance::Tree& tree, std::size_t n, std::size_t numParts,
+                  util::Executor& executor, PointPairDistance& p_ptDist,
+                  const ItemFunction& addItem)
+{
+    std::vector<PointPairDistance> partDist(numParts);
+    executor.parallelFor(numParts, 1, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; i++) {
+            MaxFacetDistance maxDist(tree);
+            for(std::size_t j = i * n / numParts; j < (i + 1) * n / numParts; j++) {
+                addItem(maxDist, j);
+            }
+            partDist[i] = maxDist.getMaxPointDistance();
+        }
+    });
+    for(PointPairDistance& dist : partDist) {
+        // a range may be empty if there are fewer items than parts
+        if(! dist.getIsNull()) {
+            p_ptDist.setMaximum(dist);
+        }
+    }
 }
 
+} // anonymous namespace
+
 /* static public */
 double
 DiscreteHausdorffDistance::distance(const geom::Geometry& g0,
@@ -101,15 +367,46 @@ DiscreteHausdorffDistance::computeOrientedDistance(
     const geom::Geometry& geom,
     PointPairDistance& p_ptDist)
 {
-    MaxPointDistanceFilter distFilter(geom);
-    discreteGeom.apply_ro(&distFilter);
-    p_ptDist.setMaximum(distFilter.getMaxPointDistance());
+    std::unique_ptr<MaxFacetDistance::Tree> tree = FacetSequenceTreeBuilder::build(&geom);
+
+    std::size_t numParts = 1;
+    std::size_t numPts = discreteGeom.getNumPoints();
+    if(executor != nullptr && tree->getRoot() != nullptr) {
+        numParts = std::min(executor->getNumThreads(), numPts / MIN_POINTS_PER_THREAD);
+    }
+
+    if(numParts <= 1) {
+        MaxFacetDistance maxDist(*tree);
+
+        MaxFacetDistanceFilter distFilter(maxDist);
+        discreteGeom.apply_ro(&distFilter);
+
+        if(densifyFrac > 0) {
+            MaxDensifiedFacetDistanceFilter fracFilter(maxDist, densifyFrac);
+            discreteGeom.apply_ro(fracFilter);
+        }
+        p_ptDist.setMaximum(maxDist.getMaxPointDistance());
+        return;
+    }
+
+    std::vector<Coordinate> pts;
+    pts.reserve(numPts);
+    PointCollector ptCollector(pts);
+    discreteGeom.apply_ro(&ptCollector);
+    computeMaxInParts(*tree, pts.size(), numParts, *executor, p_ptDist,
+    [&pts](MaxFacetDistance& maxDist, std::size_t i) {
+        maxDist.add(pts[i]);
+    });
 
     if(densifyFrac > 0) {
-        MaxDensifiedByFractionDistanceFilter fracFilter(geom,
-                densifyFrac);
-        discreteGeom.apply_ro(fracFilter);
-        ptDist.setMaximum(fracFilter.getMaxPointDistance());
+        std::vector<SegmentCollector::Segment> segs;
+        SegmentCollector segCollector(segs);
+        discreteGeom.apply_ro(segCollector);
+        computeMaxInParts(*tree, segs.size(), numParts, *executor, p_ptDist,
+        [&segs, this](MaxFacetDistance& maxDist, std::size_t i) {
+            MaxDensifiedFacetDistanceFilter fracFilter(maxDist, densifyFrac);
+            fracFilter.filter_ro(*segs[i].first, segs[i].second);
+        });
     }
 }
 
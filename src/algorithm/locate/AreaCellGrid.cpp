@@ -0,0 +1,320 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/algorithm/locate/AreaCellGrid.h>
+#include <geos/algorithm/locate/PointOnGeometryLocator.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/util/LinearComponentExtracter.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using geos::geom::Location;
+
+namespace geos {
+namespace algorithm { // geos::algorithm
+namespace locate { // geos::algorithm::locate
+
+namespace {
+
+// The maximum number of cells looked up at the finer levels
+const std::size_t MAX_QUERY_CELLS = 16;
+
+// Segments are clipped to the rows of cells only if the cells are
+// much larger than the rounding errors of the clipping.
+const double MIN_RELATIVE_CELL_SIZE = 1e-6;
+
+// Returns the memory used by the levels, saturated to the maximum size_t
+std::size_t
+levelsSize(std::size_t resolution)
+{
+    const std::size_t maxSize = std::numeric_limits<std::size_t>::max();
+    std::size_t size = 0;
+    for(std::size_t n = resolution; n > 0; n /= 2) {
+        if(n > maxSize / n || n * n > maxSize - size) {
+            return maxSize;
+        }
+        size += n * n;
+    }
+    if(size > maxSize / sizeof(Location)) {
+        return maxSize;
+    }
+    return size * sizeof(Location);
+}
+
+} // anonymous namespace
+
+const std::size_t AreaCellGrid::MAX_RESOLUTION;
+
+AreaCellGrid::AreaCellGrid(const geom::Geometry& area, PointOnGeometryLocator& locator,
+                           std::size_t p_resolution, std::size_t maxBytes)
+    : env(*area.getEnvelopeInternal())
+    , resolution(1)
+    , scaleX(0)
+    , scaleY(0)
+    , cellWidth(0)
+    , cellHeight(0)
+    , clipSegments(false)
+{
+    std::size_t maxResolution = std::min(p_resolution, MAX_RESOLUTION);
+    while(resolution < maxResolution) {
+        resolution *= 2;
+    }
+    while(resolution > 1 && levelsSize(resolution) > maxBytes) {
+        resolution /= 2;
+    }
+
+    levels.emplace_back(resolution * resolution, Location::NONE);
+
+    if(!(env.getWidth() > 0 && env.getHeight() > 0)) {
+        // no area, so no cell can be classified
+        std::fill(levels[0].begin(), levels[0].end(), Location::BOUNDARY);
+        buildLevels();
+        return;
+    }
+
+    double n = static_cast<double>(resolution);
+    scaleX = n / env.getWidth();
+    scaleY = n / env.getHeight();
+    cellWidth = env.getWidth() / n;
+    cellHeight = env.getHeight() / n;
+    double magnitude = std::max(std::max(std::fabs(env.getMinX()), std::fabs(env.getMaxX())),
+                                std::max(std::fabs(env.getMinY()), std::fabs(env.getMaxY())));
+    clipSegments = cellWidth > MIN_RELATIVE_CELL_SIZE * magnitude
+                   && cellHeight > MIN_RELATIVE_CELL_SIZE * magnitude;
+
+    geom::LineString::ConstVect lines;
+    geom::util::LinearComponentExtracter::getLines(area, lines);
+    for(const geom::LineString* line : lines) {
+        markBoundary(*line->getCoordinatesRO());
+    }
+    classifyCells(locator);
+    buildLevels();
+}
+
+/*
+ * Maps an ordinate of the envelope to a column or row. The mapping is
+ * monotonic, so the cell of a point of a segment is within the cells of
+ * the envelope of the segment, and the points mapped to a range of cells
+ * form a rectangle.
+ */
+std::size_t
+AreaCellGrid::cellX(double x) const
+{
+    double d = (x - env.getMinX()) * scaleX;
+    if(!(d > 0)) {
+        return 0;
+    }
+    if(d >= static_cast<double>(resolution)) {
+        return resolution - 1;
+    }
+    return static_cast<std::size_t>(d);
+}
+
+std::size_t
+AreaCellGrid::cellY(double y) const
+{
+    double d = (y - env.getMinY()) * scaleY;
+    if(!(d > 0)) {
+        return 0;
+    }
+    if(d >= static_cast<double>(resolution)) {
+        return resolution - 1;
+    }
+    return static_cast<std::size_t>(d);
+}
+
+void
+AreaCellGrid::markBoundary(const geom::CoordinateSequence& pts)
+{
+    for(std::size_t i = 1, n = pts.size(); i < n; i++) {
+        markSegment(pts.getAt(i - 1), pts.getAt(i));
+    }
+}
+
+void
+AreaCellGrid::markCells(std::size_t row, std::size_t minCol, std::size_t maxCol)
+{
+    std::vector<Location>& cells = levels[0];
+    std::size_t rowStart = row * resolution;
+    std::fill(cells.begin() + static_cast<std::ptrdiff_t>(rowStart + minCol),
+              cells.begin() + static_cast<std::ptrdiff_t>(rowStart + maxCol + 1),
+              Location::BOUNDARY);
+}
+
+void
+AreaCellGrid::markSegment(const geom::Coordinate& p0, const geom::Coordinate& p1)
+{
+    double segMinX = std::min(p0.x, p1.x);
+    double segMaxX = std::max(p0.x, p1.x);
+    double segMinY = std::min(p0.y, p1.y);
+    double segMaxY = std::max(p0.y, p1.y);
+    std::size_t minCol = cellX(segMinX);
+    std::size_t maxCol = cellX(segMaxX);
+    std::size_t minRow = cellY(segMinY);
+    std::size_t maxRow = cellY(segMaxY);
+
+    if(!clipSegments || minRow == maxRow || minCol == maxCol) {
+        for(std::size_t row = minRow; row <= maxRow; row++) {
+            markCells(row, minCol, maxCol);
+        }
+        return;
+    }
+
+    // Mark the cells crossed by the segment within each row, with a margin
+    // of one cell for the rounding errors of the clipping.
+    double dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+    for(std::size_t row = minRow; row <= maxRow; row++) {
+        double rowMinY = env.getMinY() + (static_cast<double>(row) - 1) * cellHeight;
+        double rowMaxY = env.getMinY() + (static_cast<double>(row) + 2) * cellHeight;
+        double y0 = std::max(segMinY, rowMinY);
+        double y1 = std::min(segMaxY, rowMaxY);
+        double xa = p0.x + (y0 - p0.y) * dxdy;
+        double xb = p0.x + (y1 - p0.y) * dxdy;
+        std::size_t col0 = cellX(std::max(segMinX, std::min(xa, xb)));
+        std::size_t col1 = cellX(std::min(segMaxX, std::max(xa, xb)));
+        col0 = col0 > minCol ? col0 - 1 : minCol;
+        col1 = col1 < maxCol ? col1 + 1 : maxCol;
+        markCells(row, std::min(col0, col1), std::max(col0, col1));
+    }
+}
+
+void
+AreaCellGrid::classifyCells(PointOnGeometryLocator& locator)
+{
+    // A run of cells of a row which are not crossed by the boundary
+    // has the location of the centre of its first cell.
+    std::vector<Location>& cells = levels[0];
+    for(std::size_t row = 0; row < resolution; row++) {
+        double y = env.getMinY() + (static_cast<double>(row) + 0.5) * cellHeight;
+        Location runLocation = Location::NONE;
+        for(std::size_t col = 0; col < resolution; col++) {
+            Location& cell = cells[row * resolution + col];
+            if(cell == Location::BOUNDARY) {
+                runLocation = Location::NONE;
+                continue;
+            }
+            if(runLocation == Location::NONE) {
+                geom::Coordinate centre(env.getMinX() + (static_cast<double>(col) + 0.5) * cellWidth, y);
+                if(cellX(centre.x) != col || cellY(centre.y) != row) {
+                    // cells too small to be classified reliably
+                    cell = Location::BOUNDARY;
+                    continue;
+                }
+                runLocation = locator.locate(&centre);
+            }
+            cell = runLocation;
+        }
+    }
+}
+
+void
+AreaCellGrid::buildLevels()
+{
+    for(std::size_t n = resolution / 2; n > 0; n /= 2) {
+        const std::vector<Location>& fine = levels.back();
+        std::size_t fineSize = n * 2;
+        std::vector<Location> coarse(n * n);
+        for(std::size_t row = 0; row < n; row++) {
+            for(std::size_t col = 0; col < n; col++) {
+                std::size_t i = 2 * row * fineSize + 2 * col;
+                Location loc = fine[i];
+                if(fine[i + 1] != loc || fine[i + fineSize] != loc || fine[i + fineSize + 1] != loc) {
+                    loc = Location::BOUNDARY;
+                }
+                coarse[row * n + col] = loc;
+            }
+        }
+        levels.push_back(std::move(coarse));
+    }
+}
+
+Location
+AreaCellGrid::locateCells(std::size_t level,
+                          std::size_t minCol, std::size_t maxCol,
+                          std::size_t minRow, std::size_t maxRow) const
+{
+    const std::vector<Location>& cells = levels[level];
+    std::size_t n = resolution >> level;
+    Location loc = cells[minRow * n + minCol];
+    for(std::size_t row = minRow; row <= maxRow; row++) {
+        for(std::size_t col = minCol; col <= maxCol; col++) {
+            Location cell = cells[row * n + col];
+            if(cell == Location::BOUNDARY || cell != loc) {
+                return Location::BOUNDARY;
+            }
+        }
+    }
+    return loc;
+}
+
+/* public */
+Location
+AreaCellGrid::locate(const geom::Envelope& queryEnv) const
+{
+    if(queryEnv.isNull()) {
+        return Location::BOUNDARY;
+    }
+    if(!env.intersects(queryEnv)) {
+        return Location::EXTERIOR;
+    }
+
+    std::size_t minCol = cellX(queryEnv.getMinX());
+    std::size_t maxCol = cellX(queryEnv.getMaxX());
+    std::size_t minRow = cellY(queryEnv.getMinY());
+    std::size_t maxRow = cellY(queryEnv.getMaxY());
+
+    std::size_t level = 0;
+    while((maxCol >> level) - (minCol >> level) > 1 || (maxRow >> level) - (minRow >> level) > 1) {
+        level++;
+    }
+
+    for(;;) {
+        Location loc = locateCells(level, minCol >> level, maxCol >> level,
+                                   minRow >> level, maxRow >> level);
+        if(loc == Location::INTERIOR && !env.covers(&queryEnv)) {
+            // part of the envelope is outside the area
+            return Location::BOUNDARY;
+        }
+        if(loc != Location::BOUNDARY || level == 0) {
+            return loc;
+        }
+        level--;
+        std::size_t numCells = ((maxCol >> level) - (minCol >> level) + 1)
+                               * ((maxRow >> level) - (minRow >> level) + 1);
+        if(numCells > MAX_QUERY_CELLS) {
+            return Location::BOUNDARY;
+        }
+    }
+}
+
+/* public */
+Location
+AreaCellGrid::locate(const geom::Coordinate& p) const
+{
+    return locate(geom::Envelope(p));
+}
+
+/* public */
+std::size_t
+AreaCellGrid::getMemorySize() const
+{
+    return levelsSize(resolution);
+}
+
+} // geos::algorithm::locate
+} // geos::algorithm
+} // geos
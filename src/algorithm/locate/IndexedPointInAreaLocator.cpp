@@ -23,60 +23,187 @@
 #include <geos/geom/LinearRing.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/util/LinearComponentExtracter.h>
-#include <geos/index/strtree/Interval.h>
-#include <geos/index/strtree/TemplateSTRtree.h>
 #include <geos/util.h>
+#include <geos/util/GEOSException.h>
 #include <geos/algorithm/RayCrossingCounter.h>
-#include <geos/index/ItemVisitor.h>
 
 #include <algorithm>
+#include <limits>
 #include <typeinfo>
 
 namespace geos {
 namespace algorithm {
 namespace locate {
-//
-// private:
-//
-IndexedPointInAreaLocator::IntervalIndexedGeometry::IntervalIndexedGeometry(const geom::Geometry& g)
+
+namespace {
+
+// The average number of segments per strip, before splitting
+const std::size_t SEGMENTS_PER_STRIP = 4;
+
+// The maximum number of strip entries per segment. Segments crossing
+// several strips are stored in each of them, so tall segments make
+// the index use fewer strips.
+const std::size_t MAX_ENTRIES_PER_SEGMENT = 4;
+
+struct Segment {
+    double x0, y0, x1, y1;
+
+    double
+    minY() const
+    {
+        return std::min(y0, y1);
+    }
+};
+
+/*
+ * Maps an ordinate in [min, min + n / scale] to [0, n). The mapping is
+ * monotonic, so the index of a point of a segment is between the indexes
+ * of the ends of the segment.
+ */
+std::size_t
+ordinateIndex(double v, double min, double scale, std::size_t n)
 {
-    init(g);
+    double d = (v - min) * scale;
+    if(!(d > 0)) {
+        return 0;
+    }
+    if(d >= static_cast<double>(n)) {
+        return n - 1;
+    }
+    return static_cast<std::size_t>(d);
 }
 
-void
-IndexedPointInAreaLocator::IntervalIndexedGeometry::init(const geom::Geometry& g)
+} // anonymous namespace
+
+const std::size_t IndexedPointInAreaLocator::DEFAULT_GRID_MAX_BYTES;
+
+//
+// private:
+//
+IndexedPointInAreaLocator::StripIndexedGeometry::StripIndexedGeometry(const geom::Geometry& g)
+    : numStrips(1)
+    , stripScale(0)
 {
     geom::LineString::ConstVect lines;
     geom::util::LinearComponentExtracter::getLines(g, lines);
 
-    // pre-compute size of segment vector
-    std::size_t nsegs = 0;
+    std::vector<Segment> segs;
     for(const geom::LineString* line : lines) {
-        nsegs += line->getCoordinatesRO()->size() - 1;
+        const geom::CoordinateSequence* pts = line->getCoordinatesRO();
+        for(std::size_t i = 1, ni = pts->size(); i < ni; i++) {
+            const geom::Coordinate& p0 = pts->getAt(i - 1);
+            const geom::Coordinate& p1 = pts->getAt(i);
+            segs.push_back({p0.x, p0.y, p1.x, p1.y});
+            env.expandToInclude(p0);
+            env.expandToInclude(p1);
+        }
+    }
+    if(segs.size() > std::numeric_limits<uint32_t>::max()) {
+        throw util::GEOSException("IndexedPointInAreaLocator: too many segments");
     }
-    index = decltype(index)(10, nsegs);
 
-    for(const geom::LineString* line : lines) {
-        addLine(line->getCoordinatesRO());
+    // Within each strip the segments are then sorted by minimum Y,
+    // so that a query stops at the first segment above the point.
+    std::sort(segs.begin(), segs.end(), [](const Segment& a, const Segment& b) {
+        return a.minY() < b.minY();
+    });
+
+    x0.reserve(segs.size());
+    y0.reserve(segs.size());
+    x1.reserve(segs.size());
+    y1.reserve(segs.size());
+    for(const Segment& seg : segs) {
+        x0.push_back(seg.x0);
+        y0.push_back(seg.y0);
+        x1.push_back(seg.x1);
+        y1.push_back(seg.y1);
+    }
+
+    std::size_t n = std::max<std::size_t>(1, segs.size() / SEGMENTS_PER_STRIP);
+    setNumStrips(n);
+    while(n > 1 && countStripSegments() > MAX_ENTRIES_PER_SEGMENT * segs.size()) {
+        n /= 2;
+        setNumStrips(n);
+    }
+    buildStrips();
+}
+
+void
+IndexedPointInAreaLocator::StripIndexedGeometry::setNumStrips(std::size_t n)
+{
+    numStrips = n;
+    double height = env.getHeight();
+    stripScale = height > 0 ? static_cast<double>(n) / height : 0;
+}
+
+std::size_t
+IndexedPointInAreaLocator::StripIndexedGeometry::stripIndex(double y) const
+{
+    return ordinateIndex(y, env.getMinY(), stripScale, numStrips);
+}
+
+std::size_t
+IndexedPointInAreaLocator::StripIndexedGeometry::countStripSegments() const
+{
+    std::size_t count = 0;
+    for(std::size_t i = 0, n = x0.size(); i < n; i++) {
+        auto r = std::minmax(y0[i], y1[i]);
+        count += stripIndex(r.second) - stripIndex(r.first) + 1;
     }
+    return count;
 }
 
 void
-IndexedPointInAreaLocator::IntervalIndexedGeometry::addLine(const geom::CoordinateSequence* pts)
+IndexedPointInAreaLocator::StripIndexedGeometry::buildStrips()
 {
-    for(std::size_t i = 1, ni = pts->size(); i < ni; i++) {
-        SegmentView seg(&pts->getAt(i-1), &pts->getAt(i));
-        auto r = std::minmax(seg.p0().y, seg.p1().y);
+    stripOffsets.assign(numStrips + 1, 0);
+    for(std::size_t i = 0, n = x0.size(); i < n; i++) {
+        auto r = std::minmax(y0[i], y1[i]);
+        for(std::size_t s = stripIndex(r.first), last = stripIndex(r.second); s <= last; s++) {
+            stripOffsets[s + 1]++;
+        }
+    }
+    for(std::size_t s = 0; s < numStrips; s++) {
+        stripOffsets[s + 1] += stripOffsets[s];
+    }
 
-        index.insert(index::strtree::Interval(r.first, r.second), seg);
+    // segments are added in order, so each strip remains sorted by minimum Y
+    std::vector<std::size_t> next(stripOffsets.begin(), stripOffsets.end() - 1);
+    stripSegments.resize(stripOffsets.back());
+    for(std::size_t i = 0, n = x0.size(); i < n; i++) {
+        auto r = std::minmax(y0[i], y1[i]);
+        for(std::size_t s = stripIndex(r.first), last = stripIndex(r.second); s <= last; s++) {
+            stripSegments[next[s]++] = static_cast<uint32_t>(i);
+        }
     }
 }
 
+void
+IndexedPointInAreaLocator::StripIndexedGeometry::countSegments(RayCrossingCounter& rcc,
+        const geom::Coordinate& p) const
+{
+    std::size_t s = stripIndex(p.y);
+    for(std::size_t k = stripOffsets[s], end = stripOffsets[s + 1]; k < end; k++) {
+        uint32_t i = stripSegments[k];
+        if(std::min(y0[i], y1[i]) > p.y) {
+            return;
+        }
+        rcc.countSegment(geom::Coordinate(x0[i], y0[i]), geom::Coordinate(x1[i], y1[i]));
+        if(rcc.isOnSegment()) {
+            return;
+        }
+    }
+}
 
 void
 IndexedPointInAreaLocator::buildIndex(const geom::Geometry& g)
 {
-    index = detail::make_unique<IntervalIndexedGeometry>(g);
+    index = detail::make_unique<StripIndexedGeometry>(g);
+    const geom::Envelope& env = index->getEnvelope();
+    if(gridSize > 0 && env.getWidth() > 0 && env.getHeight() > 0) {
+        // the cells are classified by this locator, before it has a grid
+        grid = detail::make_unique<AreaCellGrid>(g, *this, gridSize, gridMaxBytes);
+    }
 }
 
 
@@ -88,7 +215,15 @@ IndexedPointInAreaLocator::buildIndex(const geom::Geometry& g)
 // public:
 //
 IndexedPointInAreaLocator::IndexedPointInAreaLocator(const geom::Geometry& g)
+    : IndexedPointInAreaLocator(g, 0)
+{
+}
+
+IndexedPointInAreaLocator::IndexedPointInAreaLocator(const geom::Geometry& g, std::size_t p_gridSize,
+                                                     std::size_t p_gridMaxBytes)
     :	areaGeom(g)
+    ,	gridSize(p_gridSize)
+    ,	gridMaxBytes(p_gridMaxBytes)
 {
     const std::type_info& areaGeomId = typeid(areaGeom);
     if(areaGeomId != typeid(geom::Polygon)
@@ -105,12 +240,19 @@ IndexedPointInAreaLocator::locate(const geom::Coordinate* /*const*/ p)
         buildIndex(areaGeom);
     }
 
-    algorithm::RayCrossingCounter rcc(*p);
+    if(!index->getEnvelope().covers(p->x, p->y)) {
+        return geom::Location::EXTERIOR;
+    }
 
-    index->query(p->y, p->y, [&rcc](const SegmentView& ls) {
-        rcc.countSegment(ls.p0(), ls.p1());
-    });
+    if(grid) {
+        geom::Location loc = grid->locate(*p);
+        if(loc != geom::Location::BOUNDARY) {
+            return loc;
+        }
+    }
 
+    algorithm::RayCrossingCounter rcc(*p);
+    index->countSegments(rcc, *p);
     return rcc.getLocation();
 }
 
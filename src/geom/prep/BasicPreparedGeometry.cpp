@@ -19,6 +19,7 @@
 
 #include <geos/geom/prep/BasicPreparedGeometry.h>
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/GeometryComponentFilter.h>
 #include <geos/algorithm/PointLocator.h>
 #include <geos/geom/util/ComponentCoordinateExtracter.h>
 #include <geos/operation/distance/DistanceOp.h>
@@ -74,6 +75,19 @@ BasicPreparedGeometry::BasicPreparedGeometry(const Geometry* geom)
     setGeometry(geom);
 }
 
+void
+BasicPreparedGeometry::buildIndexes() const
+{
+    struct EnvelopeFilter : public geom::GeometryComponentFilter {
+        void
+        filter_ro(const geom::Geometry* g) override
+        {
+            g->getEnvelopeInternal();
+        }
+    } filter;
+    baseGeom->apply_ro(&filter);
+}
+
 bool
 BasicPreparedGeometry::isAnyTargetComponentInTest(const geom::Geometry* testGeom) const
 {
@@ -0,0 +1,380 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/prep/PreparedGeometryCache.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateFilter.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+namespace geos {
+namespace geom { // geos::geom
+namespace prep { // geos::geom::prep
+
+namespace {
+
+/*
+ * Computes a FNV-1a hash of the bits of the ordinates of all coordinates.
+ */
+class HashFilter : public CoordinateFilter {
+public:
+    HashFilter(uint64_t seed, bool p_hasZ)
+        : h(14695981039346656037ULL ^ seed)
+        , hasZ(p_hasZ)
+    {}
+
+    void
+    filter_ro(const Coordinate* c) override
+    {
+        add(c->x);
+        add(c->y);
+        if(hasZ) {
+            add(c->z);
+        }
+    }
+
+    uint64_t
+    getHash() const
+    {
+        return h;
+    }
+
+private:
+    uint64_t h;
+    bool hasZ;
+
+    void
+    add(double d)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &d, sizeof(bits));
+        for(int i = 0; i < 8; i++) {
+            h ^= (bits >> (8 * i)) & 0xff;
+            h *= 1099511628211ULL;
+        }
+    }
+};
+
+/*
+ * Collects the Z values of all coordinates.
+ */
+class ZFilter : public CoordinateFilter {
+public:
+    void
+    filter_ro(const Coordinate* c) override
+    {
+        z.push_back(c->z);
+    }
+
+    std::vector<double> z;
+};
+
+bool
+sameZ(const Geometry& g1, const Geometry& g2)
+{
+    ZFilter f1;
+    ZFilter f2;
+    g1.apply_ro(&f1);
+    g2.apply_ro(&f2);
+    if(f1.z.size() != f2.z.size()) {
+        return false;
+    }
+    for(std::size_t i = 0; i < f1.z.size(); i++) {
+        double z1 = f1.z[i];
+        double z2 = f2.z[i];
+        if(z1 != z2 && !(std::isnan(z1) && std::isnan(z2))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Tests whether a cached geometry can stand for a requested one:
+ * their coordinates, SRID and coordinate dimension must be the same.
+ */
+bool
+isSameGeometry(const Geometry& cached, const Geometry& geom)
+{
+    if(cached.getSRID() != geom.getSRID()
+            || cached.getCoordinateDimension() != geom.getCoordinateDimension()
+            || !cached.equalsExact(&geom)) {
+        return false;
+    }
+    return geom.getCoordinateDimension() < 3 || sameZ(cached, geom);
+}
+
+} // anonymous namespace
+
+/*
+ * A geometry and its prepared geometry, whose indexes are built
+ * before the entry is shared, so that it can be used concurrently.
+ */
+struct PreparedGeometryCache::Entry {
+    std::size_t key;
+    std::unique_ptr<Geometry> geom;
+    std::unique_ptr<PreparedGeometry> prepared;
+
+    Entry(std::size_t p_key, const Geometry& g)
+        : key(p_key)
+        , geom(g.clone())
+        , prepared(PreparedGeometryFactory::prepare(geom.get()))
+    {
+        prepared->buildIndexes();
+    }
+};
+
+/*
+ * The prepared geometries returned by the cache, which forward
+ * to a shared entry.
+ */
+class PreparedGeometryCache::CachedPreparedGeometry : public PreparedGeometry {
+public:
+    explicit CachedPreparedGeometry(std::shared_ptr<Entry> p_entry)
+        : entry(std::move(p_entry))
+    {}
+
+    const Geometry&
+    getGeometry() const override
+    {
+        return *entry->geom;
+    }
+
+    bool
+    contains(const Geometry* g) const override
+    {
+        return entry->prepared->contains(g);
+    }
+
+    bool
+    containsProperly(const Geometry* g) const override
+    {
+        return entry->prepared->containsProperly(g);
+    }
+
+    bool
+    coveredBy(const Geometry* g) const override
+    {
+        return entry->prepared->coveredBy(g);
+    }
+
+    bool
+    covers(const Geometry* g) const override
+    {
+        return entry->prepared->covers(g);
+    }
+
+    bool
+    crosses(const Geometry* g) const override
+    {
+        return entry->prepared->crosses(g);
+    }
+
+    bool
+    disjoint(const Geometry* g) const override
+    {
+        return entry->prepared->disjoint(g);
+    }
+
+    bool
+    intersects(const Geometry* g) const override
+    {
+        return entry->prepared->intersects(g);
+    }
+
+    bool
+    overlaps(const Geometry* g) const override
+    {
+        return entry->prepared->overlaps(g);
+    }
+
+    bool
+    touches(const Geometry* g) const override
+    {
+        return entry->prepared->touches(g);
+    }
+
+    bool
+    within(const Geometry* g) const override
+    {
+        return entry->prepared->within(g);
+    }
+
+    std::unique_ptr<CoordinateSequence>
+    nearestPoints(const Geometry* g) const override
+    {
+        return entry->prepared->nearestPoints(g);
+    }
+
+    double
+    distance(const Geometry* g) const override
+    {
+        return entry->prepared->distance(g);
+    }
+
+private:
+    std::shared_ptr<Entry> entry;
+};
+
+PreparedGeometryCache::PreparedGeometryCache(std::size_t p_maxEntries, std::size_t p_minNumPoints)
+    : maxEntries(p_maxEntries)
+    , minNumPoints(p_minNumPoints)
+    , numHits(0)
+    , numMisses(0)
+{}
+
+PreparedGeometryCache::~PreparedGeometryCache() = default;
+
+/* public static */
+std::size_t
+PreparedGeometryCache::hash(const Geometry& geom)
+{
+    uint64_t seed = static_cast<uint64_t>(geom.getGeometryTypeId())
+                    ^ (static_cast<uint64_t>(static_cast<uint32_t>(geom.getSRID())) << 8)
+                    ^ (static_cast<uint64_t>(geom.getCoordinateDimension()) << 40);
+    HashFilter filter(seed, geom.getCoordinateDimension() > 2);
+    geom.apply_ro(&filter);
+    return static_cast<std::size_t>(filter.getHash());
+}
+
+/* public */
+std::unique_ptr<PreparedGeometry>
+PreparedGeometryCache::prepare(const Geometry& geom)
+{
+    if(geom.getNumPoints() < minNumPoints) {
+        return PreparedGeometryFactory::prepare(&geom);
+    }
+
+    std::size_t key = hash(geom);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::shared_ptr<Entry> entry = find(geom, key);
+        if(entry) {
+            numHits++;
+            return std::unique_ptr<PreparedGeometry>(new CachedPreparedGeometry(entry));
+        }
+    }
+
+    // Copy and prepare outside the lock, so that other threads
+    // are not blocked by a large geometry.
+    std::shared_ptr<Entry> entry = std::make_shared<Entry>(key, geom);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    // another thread may have added the geometry in the meantime
+    std::shared_ptr<Entry> existing = find(geom, key);
+    if(existing) {
+        numHits++;
+        return std::unique_ptr<PreparedGeometry>(new CachedPreparedGeometry(existing));
+    }
+    numMisses++;
+    if(maxEntries > 0) {
+        entries.push_front(entry);
+        index.emplace(key, entries.begin());
+        trim();
+    }
+    return std::unique_ptr<PreparedGeometry>(new CachedPreparedGeometry(entry));
+}
+
+/* private */
+std::shared_ptr<PreparedGeometryCache::Entry>
+PreparedGeometryCache::find(const Geometry& geom, std::size_t key)
+{
+    auto range = index.equal_range(key);
+    for(auto it = range.first; it != range.second; ++it) {
+        EntryList::iterator entryIt = it->second;
+        if(isSameGeometry(*(*entryIt)->geom, geom)) {
+            // move to the front of the list; iterators remain valid
+            entries.splice(entries.begin(), entries, entryIt);
+            return *entryIt;
+        }
+    }
+    return nullptr;
+}
+
+/* private */
+void
+PreparedGeometryCache::trim()
+{
+    while(entries.size() > maxEntries) {
+        const std::shared_ptr<Entry>& last = entries.back();
+        auto range = index.equal_range(last->key);
+        for(auto it = range.first; it != range.second; ++it) {
+            if(it->second == std::prev(entries.end())) {
+                index.erase(it);
+                break;
+            }
+        }
+        entries.pop_back();
+    }
+}
+
+/* public */
+void
+PreparedGeometryCache::setMaxEntries(std::size_t p_maxEntries)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    maxEntries = p_maxEntries;
+    trim();
+}
+
+/* public */
+std::size_t
+PreparedGeometryCache::getMaxEntries() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return maxEntries;
+}
+
+/* public */
+std::size_t
+PreparedGeometryCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+/* public */
+void
+PreparedGeometryCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    index.clear();
+    entries.clear();
+}
+
+/* public */
+std::size_t
+PreparedGeometryCache::getNumHits() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return numHits;
+}
+
+/* public */
+std::size_t
+PreparedGeometryCache::getNumMisses() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return numMisses;
+}
+
+} // namespace geos::geom::prep
+} // namespace geos::geom
+} // namespace geos
@@ -55,6 +55,14 @@ PreparedLineString::getIntersectionFinder()
     return segIntFinder.get();
 }
 
+void
+PreparedLineString::buildIndexes() const
+{
+    BasicPreparedGeometry::buildIndexes();
+    const_cast<PreparedLineString*>(this)->getIntersectionFinder();
+    getIndexedFacetDistance();
+}
+
 bool
 PreparedLineString::intersects(const geom::Geometry* g) const
 {
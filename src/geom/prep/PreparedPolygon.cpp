@@ -30,17 +30,23 @@
 #include <geos/operation/predicate/RectangleIntersects.h>
 #include <geos/algorithm/locate/PointOnGeometryLocator.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/algorithm/locate/AreaCellGrid.h>
 // std
 #include <cstddef>
 
 namespace geos {
 namespace geom { // geos.geom
 namespace prep { // geos.geom.prep
+
+const std::size_t PreparedPolygon::DEFAULT_CELL_GRID_MAX_BYTES;
+
 //
 // public:
 //
 PreparedPolygon::PreparedPolygon(const geom::Geometry* geom)
     : BasicPreparedGeometry(geom)
+    , cellGridResolution(0)
+    , cellGridMaxBytes(DEFAULT_CELL_GRID_MAX_BYTES)
 {
     isRectangle = getGeometry().isRectangle();
 }
@@ -75,6 +81,56 @@ getPointLocator() const
     return ptOnGeomLoc.get();
 }
 
+void
+PreparedPolygon::
+buildIndexes() const
+{
+    BasicPreparedGeometry::buildIndexes();
+    getIntersectionFinder();
+    getIndexedFacetDistance();
+    // the point locator builds its index on the first location
+    geom::Coordinate p;
+    if(getGeometry().getEnvelopeInternal()->centre(p)) {
+        getPointLocator()->locate(&p);
+    }
+    getCellGrid();
+}
+
+void
+PreparedPolygon::
+setCellGrid(std::size_t resolution, std::size_t maxBytes)
+{
+    cellGridResolution = resolution;
+    cellGridMaxBytes = maxBytes;
+    cellGrid.reset();
+}
+
+const algorithm::locate::AreaCellGrid*
+PreparedPolygon::
+getCellGrid() const
+{
+    if(!cellGrid && cellGridResolution > 0) {
+        cellGrid.reset(new algorithm::locate::AreaCellGrid(getGeometry(), *getPointLocator(),
+                       cellGridResolution, cellGridMaxBytes));
+    }
+    return cellGrid.get();
+}
+
+/*
+ * Returns the location of all points of a non-empty geometry if the
+ * cell grid can tell, or BOUNDARY.
+ */
+geom::Location
+PreparedPolygon::
+locateInCellGrid(const geom::Geometry* g) const
+{
+    const algorithm::locate::AreaCellGrid* grid = getCellGrid();
+    if(grid == nullptr) {
+        return geom::Location::BOUNDARY;
+    }
+    return grid->locate(*g->getEnvelopeInternal());
+}
+
 bool
 PreparedPolygon::
 contains(const geom::Geometry* g) const
@@ -92,6 +148,11 @@ contains(const geom::Geometry* g) const
         return operation::predicate::RectangleContains::contains(poly, *g);
     }
 
+    geom::Location loc = locateInCellGrid(g);
+    if(loc != geom::Location::BOUNDARY) {
+        return loc == geom::Location::INTERIOR;
+    }
+
     return PreparedPolygonContains::contains(this, g);
 }
 
@@ -104,6 +165,11 @@ containsProperly(const geom::Geometry* g) const
         return false;
     }
 
+    geom::Location loc = locateInCellGrid(g);
+    if(loc != geom::Location::BOUNDARY) {
+        return loc == geom::Location::INTERIOR;
+    }
+
     return PreparedPolygonContainsProperly::containsProperly(this, g);
 }
 
@@ -121,6 +187,11 @@ covers(const geom::Geometry* g) const
         return true;
     }
 
+    geom::Location loc = locateInCellGrid(g);
+    if(loc != geom::Location::BOUNDARY) {
+        return loc == geom::Location::INTERIOR;
+    }
+
     return PreparedPolygonCovers::covers(this, g);
 }
 
@@ -141,6 +212,11 @@ intersects(const geom::Geometry* g) const
         return operation::predicate::RectangleIntersects::intersects(poly, *g);
     }
 
+    geom::Location loc = locateInCellGrid(g);
+    if(loc != geom::Location::BOUNDARY) {
+        return loc == geom::Location::INTERIOR;
+    }
+
     return PreparedPolygonIntersects::intersects(this, g);
 }
 
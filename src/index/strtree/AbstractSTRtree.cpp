@@ -18,6 +18,7 @@
 #include <geos/index/strtree/AbstractNode.h>
 #include <geos/index/strtree/ItemBoundable.h>
 #include <geos/index/ItemVisitor.h>
+#include <geos/util/Stats.h>
 // std
 #include <algorithm>
 #include <vector>
@@ -58,6 +59,7 @@ AbstractSTRtree::build()
         return;
     }
 
+    geos::util::Stats::Timer timer(geos::util::Stats::INDEX_BUILD);
     root = (itemBoundables->empty() ? createNode(0) : createHigherLevels(itemBoundables, -1));
     built = true;
 }
@@ -120,6 +122,7 @@ AbstractSTRtree::query(const void* searchBounds, std::vector<void*>& matches)
         build();
     }
 
+    geos::util::Stats::Timer timer(geos::util::Stats::INDEX_QUERY);
     if(itemBoundables->empty()) {
         assert(root->getBounds() == nullptr);
         return;
@@ -138,6 +141,7 @@ AbstractSTRtree::query(const void* searchBounds, ItemVisitor& visitor)
         build();
     }
 
+    geos::util::Stats::Timer timer(geos::util::Stats::INDEX_QUERY);
     if(itemBoundables->empty()) {
         assert(root->getBounds() == nullptr);
         return;
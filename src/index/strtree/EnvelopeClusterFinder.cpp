@@ -0,0 +1,70 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/index/strtree/EnvelopeClusterFinder.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/geom/Envelope.h>
+
+#include <numeric>
+
+namespace geos {
+namespace index {   // geos.index
+namespace strtree { // geos.index.strtree
+
+/*public static*/
+std::vector<std::vector<std::size_t>>
+EnvelopeClusterFinder::cluster(const std::vector<const geom::Envelope*>& envelopes)
+{
+    std::size_t n = envelopes.size();
+
+    TemplateSTRtree<std::size_t> tree(10, n);
+    for (std::size_t i = 0; i < n; i++) {
+        tree.insert(*envelopes[i], i);
+    }
+
+    // union-find over the item indexes
+    std::vector<std::size_t> parent(n);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto findRoot = [&parent](std::size_t i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    for (std::size_t i = 0; i < n; i++) {
+        tree.query(*envelopes[i], [&](std::size_t j) {
+            std::size_t ri = findRoot(i);
+            std::size_t rj = findRoot(j);
+            if (ri != rj) {
+                parent[rj] = ri;
+            }
+        });
+    }
+
+    std::vector<std::vector<std::size_t>> clusters;
+    std::vector<std::size_t> clusterIndex(n, n);
+    for (std::size_t i = 0; i < n; i++) {
+        std::size_t root = findRoot(i);
+        if (clusterIndex[root] == n) {
+            clusterIndex[root] = clusters.size();
+            clusters.emplace_back();
+        }
+        clusters[clusterIndex[root]].push_back(i);
+    }
+    return clusters;
+}
+
+} // namespace geos.index.strtree
+} // namespace geos.index
+} // namespace geos
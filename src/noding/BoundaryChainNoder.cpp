@@ -0,0 +1,152 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/noding/BoundaryChainNoder.h>
+#include <geos/noding/NodedSegmentString.h>
+#include <geos/noding/SegmentString.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/util/Interrupt.h>
+
+using geos::geom::Coordinate;
+using geos::geom::CoordinateArraySequence;
+using geos::geom::CoordinateSequence;
+
+namespace geos {
+namespace noding { // geos.noding
+
+/*public*/
+BoundaryChainNoder::~BoundaryChainNoder()
+{
+    if (chainList != nullptr) {
+        for (SegmentString* ss : *chainList) {
+            delete ss;
+        }
+        delete chainList;
+    }
+}
+
+/*private static*/
+void
+BoundaryChainNoder::addSegments(std::vector<SegmentString*>* segStrings, SegmentSet& segSet)
+{
+    for (std::size_t i = 0; i < segStrings->size(); i++) {
+        const CoordinateSequence* pts = (*segStrings)[i]->getCoordinates();
+        for (std::size_t j = 1; j < pts->size(); j++) {
+            const Coordinate& p0 = pts->getAt(j - 1);
+            const Coordinate& p1 = pts->getAt(j);
+            if (p0.equals2D(p1))
+                continue;
+            Segment seg(p0, p1, i, j - 1);
+            // a segment which occurs twice is interior to the coverage
+            auto it = segSet.find(seg);
+            if (it == segSet.end()) {
+                segSet.insert(seg);
+            }
+            else {
+                segSet.erase(it);
+            }
+        }
+        GEOS_CHECK_FOR_INTERRUPTS();
+    }
+}
+
+/*public*/
+void
+BoundaryChainNoder::computeNodes(std::vector<SegmentString*>* segStrings)
+{
+    SegmentSet segSet;
+    addSegments(segStrings, segSet);
+
+    /**
+    * Mark the boundary segments of each segment string,
+    * and count the boundary segments incident on each vertex.
+    */
+    std::vector<std::vector<bool>> isBoundary(segStrings->size());
+    for (std::size_t i = 0; i < segStrings->size(); i++) {
+        std::size_t nPts = (*segStrings)[i]->size();
+        isBoundary[i].assign(nPts > 0 ? nPts - 1 : 0, false);
+    }
+    VertexDegreeMap degree;
+    for (const Segment& seg : segSet) {
+        isBoundary[seg.ssIndex][seg.index] = true;
+        degree[seg.p0]++;
+        degree[seg.p1]++;
+    }
+
+    if (chainList != nullptr) {
+        for (SegmentString* ss : *chainList) {
+            delete ss;
+        }
+        delete chainList;
+    }
+    chainList = new std::vector<SegmentString*>();
+    for (std::size_t i = 0; i < segStrings->size(); i++) {
+        extractChains((*segStrings)[i], isBoundary[i], degree);
+    }
+}
+
+/*private*/
+void
+BoundaryChainNoder::extractChains(const SegmentString* ss,
+    const std::vector<bool>& isBoundary,
+    const VertexDegreeMap& degree)
+{
+    const CoordinateSequence* pts = ss->getCoordinates();
+    std::unique_ptr<std::vector<Coordinate>> chainPts;
+
+    for (std::size_t i = 0; i < isBoundary.size(); i++) {
+        if (! isBoundary[i]) {
+            // zero-length segments do not break a chain
+            if (chainPts && pts->getAt(i).equals2D(pts->getAt(i + 1)))
+                continue;
+            if (chainPts) {
+                chainList->push_back(new NodedSegmentString(
+                    new CoordinateArraySequence(chainPts.release()), ss->getData()));
+            }
+            continue;
+        }
+        if (! chainPts) {
+            chainPts.reset(new std::vector<Coordinate>());
+            chainPts->push_back(pts->getAt(i));
+        }
+        const Coordinate& p = pts->getAt(i + 1);
+        chainPts->push_back(p);
+
+        /**
+        * End the chain at a node, i.e. a vertex where
+        * other than two boundary segments meet.
+        */
+        auto it = degree.find(p);
+        if (it != degree.end() && it->second != 2) {
+            chainList->push_back(new NodedSegmentString(
+                new CoordinateArraySequence(chainPts.release()), ss->getData()));
+        }
+    }
+    if (chainPts) {
+        chainList->push_back(new NodedSegmentString(
+            new CoordinateArraySequence(chainPts.release()), ss->getData()));
+    }
+}
+
+/*public*/
+std::vector<SegmentString*>*
+BoundaryChainNoder::getNodedSubstrings() const
+{
+    std::vector<SegmentString*>* result = chainList;
+    chainList = nullptr;
+    return result;
+}
+
+} // namespace geos.noding
+} // namespace geos
+
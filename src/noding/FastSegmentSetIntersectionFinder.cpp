@@ -39,17 +39,19 @@ namespace noding { // geos::noding
  */
 FastSegmentSetIntersectionFinder::
 FastSegmentSetIntersectionFinder(noding::SegmentString::ConstVect* baseSegStrings)
-    :	segSetMutInt(new MCIndexSegmentSetMutualIntersector()),
-      lineIntersector(new algorithm::LineIntersector())
+    :	segSetMutInt(new MCIndexSegmentSetMutualIntersector())
 {
     segSetMutInt->setBaseSegments(baseSegStrings);
+    // built now, so that intersects() only reads the index
+    segSetMutInt->buildIndex();
 }
 
 bool
 FastSegmentSetIntersectionFinder::
 intersects(noding::SegmentString::ConstVect* segStrings)
 {
-    SegmentIntersectionDetector intFinder(lineIntersector.get());
+    algorithm::LineIntersector li;
+    SegmentIntersectionDetector intFinder(&li);
 
     return this->intersects(segStrings, &intFinder);
 }
@@ -59,8 +61,7 @@ FastSegmentSetIntersectionFinder::
 intersects(noding::SegmentString::ConstVect* segStrings,
            SegmentIntersectionDetector* intDetector)
 {
-    segSetMutInt->setSegmentIntersector(intDetector);
-    segSetMutInt->process(segStrings);
+    segSetMutInt->process(segStrings, intDetector);
 
     return intDetector->hasIntersection();
 }
@@ -44,30 +44,32 @@ MCIndexSegmentSetMutualIntersector::addToIndex(SegmentString* segStr)
 }
 
 
-/*private*/
+/*private static*/
 void
-MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr)
+MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr, MonoChains& chains)
 {
     MonotoneChainBuilder::getChains(segStr->getCoordinates(),
-                                    segStr, monoChains);
+                                    segStr, chains);
 
 }
 
 
 /*private*/
-void
-MCIndexSegmentSetMutualIntersector::intersectChains()
+int
+MCIndexSegmentSetMutualIntersector::intersectChains(MonoChains& queryChains, SegmentIntersector& si)
 {
-    MCIndexSegmentSetMutualIntersector::SegmentOverlapAction overlapAction(*segInt);
+    MCIndexSegmentSetMutualIntersector::SegmentOverlapAction overlapAction(si);
+    int numOverlaps = 0;
 
-    for(auto& queryChain : monoChains) {
-        index.query(queryChain.getEnvelope(), [&queryChain, &overlapAction, this](const MonotoneChain* testChain) {
+    for(auto& queryChain : queryChains) {
+        index.query(queryChain.getEnvelope(), [&queryChain, &overlapAction, &si, &numOverlaps](const MonotoneChain* testChain) {
             queryChain.computeOverlaps(testChain, &overlapAction);
-            nOverlaps++;
+            numOverlaps++;
 
-            return !segInt->isDone(); // abort early if segInt->isDone()
+            return !si.isDone(); // abort early if si.isDone()
         });
     }
+    return numOverlaps;
 }
 
 
@@ -85,25 +87,46 @@ MCIndexSegmentSetMutualIntersector::setBaseSegments(SegmentString::ConstVect* se
 
 /*public*/
 void
-MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings)
+MCIndexSegmentSetMutualIntersector::buildIndex()
 {
     if (!indexBuilt) {
         for (auto& mc: indexChains) {
             index.insert(&(mc.getEnvelope()), &mc);
         }
+        index.build();
         indexBuilt = true;
     }
+}
+
+/*public*/
+void
+MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings)
+{
+    buildIndex();
 
     // Reset counters for new inputs
     monoChains.clear();
     processCounter = indexCounter + 1;
-    nOverlaps = 0;
 
     for(const SegmentString* css: *segStrings) {
         SegmentString* ss = const_cast<SegmentString*>(css);
-        addToMonoChains(ss);
+        addToMonoChains(ss, monoChains);
+    }
+    nOverlaps = intersectChains(monoChains, *segInt);
+}
+
+/*public*/
+void
+MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings, SegmentIntersector* si)
+{
+    buildIndex();
+
+    MonoChains queryChains;
+    for(const SegmentString* css: *segStrings) {
+        SegmentString* ss = const_cast<SegmentString*>(css);
+        addToMonoChains(ss, queryChains);
     }
-    intersectChains();
+    intersectChains(queryChains, *si);
 }
 
 
@@ -53,6 +53,7 @@
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/profiler.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/Stats.h>
 
 #include <cassert>
 #include <vector>
@@ -429,11 +430,14 @@ BufferBuilder::buffer(const Geometry* g, double distance)
 
     try {
         PlanarGraph graph(OverlayNodeFactory::instance());
-        graph.addEdges(edgeList.getEdges());
+        {
+            geos::util::Stats::Timer timer(geos::util::Stats::GRAPH_BUILD);
+            graph.addEdges(edgeList.getEdges());
 
-        GEOS_CHECK_FOR_INTERRUPTS();
+            GEOS_CHECK_FOR_INTERRUPTS();
 
-        createSubgraphs(&graph, subgraphList);
+            createSubgraphs(&graph, subgraphList);
+        }
 
 #if GEOS_DEBUG
         std::cerr << "Created " << subgraphList.size() << " subgraphs" << std::endl;
@@ -448,6 +452,7 @@ BufferBuilder::buffer(const Geometry* g, double distance)
 
         {
             // scope for earlier PolygonBuilder cleanup
+            geos::util::Stats::Timer timer(geos::util::Stats::RING_BUILDING);
             PolygonBuilder polyBuilder(geomFact);
             buildSubgraphs(subgraphList, polyBuilder);
 
@@ -550,7 +555,10 @@ BufferBuilder::computeNodedEdges(SegmentString::NonConstVect& bufferSegStrList,
               ) << std::endl;
 #endif
 
-    noder->computeNodes(&bufferSegStrList);
+    {
+        geos::util::Stats::Timer timer(geos::util::Stats::NODING);
+        noder->computeNodes(&bufferSegStrList);
+    }
 
     SegmentString::NonConstVect* nodedSegStrings = \
             noder->getNodedSubstrings();
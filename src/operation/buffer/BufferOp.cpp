@@ -26,9 +26,22 @@
 #include <geos/precision/GeometryPrecisionReducer.h>
 #include <geos/operation/buffer/BufferOp.h>
 #include <geos/operation/buffer/BufferBuilder.h>
+#include <geos/operation/buffer/OffsetCurveBuilder.h>
+#include <geos/operation/valid/RepeatedPointRemover.h>
+#include <geos/algorithm/Orientation.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/PrecisionModel.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/Position.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/util/Interrupt.h>
+#include <geos/util/Stats.h>
 
 #include <geos/noding/ScaledNoder.h>
 
@@ -132,6 +145,12 @@ BufferOp::computeGeometry()
     std::cerr << "BufferOp::computeGeometry: trying with original precision" << std::endl;
 #endif
 
+    std::unique_ptr<Geometry> simpleResult = bufferSimple();
+    if(simpleResult != nullptr) {
+        resultGeometry = simpleResult.release();
+        return;
+    }
+
     bufferOriginalPrecision();
 
     if(resultGeometry != nullptr) {
@@ -143,6 +162,7 @@ BufferOp::computeGeometry()
               << std::endl;
 #endif
 
+    geos::util::Stats::Timer timer(geos::util::Stats::ROBUSTNESS_RETRY);
     const PrecisionModel& argPM = *(argGeom->getFactory()->getPrecisionModel());
     if(argPM.getType() == PrecisionModel::FIXED) {
         bufferFixedPrecision(argPM);
@@ -284,6 +304,227 @@ BufferOp::bufferFixedPrecision(const PrecisionModel& fixedPM)
 #endif
 }
 
+/*private*/
+std::unique_ptr<Geometry>
+BufferOp::bufferSimple()
+{
+    // Raw offset curves are only known to be simple for outward
+    // offsets computed without rounding; inverted orientation is
+    // used by bufferByZero, which never gets here with distance > 0
+    if(distance <= 0.0 || isInvertOrientation || argGeom->isEmpty()) {
+        return nullptr;
+    }
+    const PrecisionModel* pm = argGeom->getPrecisionModel();
+    if(pm->getType() != PrecisionModel::FLOATING) {
+        return nullptr;
+    }
+
+    OffsetCurveBuilder curveBuilder(pm, bufParams);
+    std::vector<CoordinateSequence*> lineList;
+
+    switch(argGeom->getGeometryTypeId()) {
+    case GEOS_POINT: {
+        const CoordinateSequence* coord = static_cast<const Point*>(argGeom)->getCoordinatesRO();
+        if(! coord->getAt(0).isValid()) {
+            return nullptr;
+        }
+        curveBuilder.getLineCurve(coord, distance, lineList);
+        break;
+    }
+    case GEOS_MULTIPOINT: {
+        const MultiPoint* mp = static_cast<const MultiPoint*>(argGeom);
+        if(! isBufferDisjoint(mp)) {
+            return nullptr;
+        }
+        for(std::size_t i = 0, n = mp->getNumGeometries(); i < n; i++) {
+            const Point* pt = mp->getGeometryN(i);
+            if(pt->isEmpty()) {
+                continue;
+            }
+            curveBuilder.getLineCurve(pt->getCoordinatesRO(), distance, lineList);
+        }
+        break;
+    }
+    case GEOS_LINESTRING: {
+        // single-sided curves of lines are not closed
+        if(bufParams.isSingleSided()) {
+            return nullptr;
+        }
+        const LineString* line = static_cast<const LineString*>(argGeom);
+        auto coord = valid::RepeatedPointRemover::removeRepeatedAndInvalidPoints(line->getCoordinatesRO());
+        if(coord->size() != 2) {
+            return nullptr;
+        }
+        curveBuilder.getLineCurve(coord.get(), distance, lineList);
+        break;
+    }
+    case GEOS_POLYGON: {
+        const Polygon* poly = static_cast<const Polygon*>(argGeom);
+        if(poly->getNumInteriorRing() > 0) {
+            return nullptr;
+        }
+        auto coord = valid::RepeatedPointRemover::removeRepeatedAndInvalidPoints(
+            poly->getExteriorRing()->getCoordinatesRO());
+        if(! isConvex(coord.get())) {
+            return nullptr;
+        }
+        // offset to the outside of the ring, as OffsetCurveSetBuilder does
+        int side = algorithm::Orientation::isCCW(coord.get()) ? Position::RIGHT : Position::LEFT;
+        curveBuilder.getRingCurve(coord.get(), side, distance, lineList);
+        break;
+    }
+    default:
+        return nullptr;
+    }
+
+    // take ownership of all curves before building anything
+    std::vector<std::unique_ptr<CoordinateSequence>> curves;
+    for(CoordinateSequence* line : lineList) {
+        curves.emplace_back(line);
+    }
+
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    const GeometryFactory* geomFact = argGeom->getFactory();
+    std::vector<std::unique_ptr<Geometry>> polys;
+    for(auto& curve : curves) {
+        if(curve->size() < LinearRing::MINIMUM_VALID_SIZE) {
+            continue;
+        }
+        // buffer shells are oriented clockwise
+        if(algorithm::Orientation::isCCW(curve.get())) {
+            CoordinateSequence::reverse(curve.get());
+        }
+        polys.emplace_back(geomFact->createPolygon(geomFact->createLinearRing(std::move(curve))));
+    }
+
+    if(polys.empty()) {
+        return geomFact->createPolygon();
+    }
+    if(polys.size() == 1) {
+        return std::move(polys[0]);
+    }
+    return geomFact->createMultiPolygon(std::move(polys));
+}
+
+/*private*/
+bool
+BufferOp::isBufferDisjoint(const MultiPoint* mp) const
+{
+    // square caps are axis-aligned, so they overlap exactly
+    // when their envelopes do
+    bool isRound = bufParams.getEndCapStyle() == BufferParameters::CAP_ROUND;
+    double reach = 2 * distance;
+
+    index::strtree::TemplateSTRtree<const Coordinate*> tree(10, mp->getNumGeometries());
+    for(std::size_t i = 0, n = mp->getNumGeometries(); i < n; i++) {
+        const Point* pt = mp->getGeometryN(i);
+        if(pt->isEmpty()) {
+            continue;
+        }
+        const Coordinate* c = pt->getCoordinate();
+        if(! c->isValid()) {
+            return false;
+        }
+        tree.insert(Envelope(*c), c);
+    }
+
+    bool isDisjoint = true;
+    for(std::size_t i = 0, n = mp->getNumGeometries(); i < n && isDisjoint; i++) {
+        const Point* pt = mp->getGeometryN(i);
+        if(pt->isEmpty()) {
+            continue;
+        }
+        const Coordinate* c = pt->getCoordinate();
+        Envelope queryEnv(*c);
+        queryEnv.expandBy(reach);
+        tree.query(queryEnv, [c, isRound, reach, &isDisjoint](const Coordinate* other) {
+            if(other != c && (! isRound || c->distance(*other) <= reach)) {
+                isDisjoint = false;
+            }
+            return isDisjoint;
+        });
+    }
+    return isDisjoint;
+}
+
+/*private static*/
+bool
+BufferOp::isConvex(const CoordinateSequence* ring)
+{
+    std::size_t n = ring->size();
+    if(n < LinearRing::MINIMUM_VALID_SIZE || ! CoordinateSequence::isRing(ring)) {
+        return false;
+    }
+    std::size_t nSeg = n - 1;
+
+    int turn = 0;
+    for(std::size_t i = 0; i < nSeg; i++) {
+        const Coordinate& p0 = ring->getAt(i == 0 ? nSeg - 1 : i - 1);
+        const Coordinate& p1 = ring->getAt(i);
+        const Coordinate& p2 = ring->getAt(i + 1);
+        int orient = algorithm::Orientation::index(p0, p1, p2);
+        if(orient == 0) {
+            // a collinear vertex is allowed, but not a spike
+            double dot = (p1.x - p0.x) * (p2.x - p1.x) + (p1.y - p0.y) * (p2.y - p1.y);
+            if(dot <= 0.0) {
+                return false;
+            }
+            continue;
+        }
+        if(turn == 0) {
+            turn = orient;
+        }
+        else if(orient != turn) {
+            return false;
+        }
+    }
+    if(turn == 0) {
+        return false;
+    }
+
+    // A ring turning consistently one way is convex only if it winds
+    // once, in which case each edge direction component changes
+    // sign exactly twice (this rejects star polygons)
+    int xFlips = 0;
+    int yFlips = 0;
+    int xPrev = 0;
+    int yPrev = 0;
+    int xFirst = 0;
+    int yFirst = 0;
+    for(std::size_t i = 0; i < nSeg; i++) {
+        const Coordinate& p0 = ring->getAt(i);
+        const Coordinate& p1 = ring->getAt(i + 1);
+        int xSign = (p1.x > p0.x) - (p1.x < p0.x);
+        int ySign = (p1.y > p0.y) - (p1.y < p0.y);
+        if(xSign != 0) {
+            if(xPrev == 0) {
+                xFirst = xSign;
+            }
+            else if(xSign != xPrev) {
+                xFlips++;
+            }
+            xPrev = xSign;
+        }
+        if(ySign != 0) {
+            if(yPrev == 0) {
+                yFirst = ySign;
+            }
+            else if(ySign != yPrev) {
+                yFlips++;
+            }
+            yPrev = ySign;
+        }
+    }
+    if(xPrev != xFirst) {
+        xFlips++;
+    }
+    if(yPrev != yFirst) {
+        yFlips++;
+    }
+    return xFlips <= 2 && yFlips <= 2;
+}
+
 /* public static */
 std::unique_ptr<Geometry>
 BufferOp::bufferByZero(const Geometry* geom, bool isBothOrientations)
@@ -79,6 +79,15 @@ FacetSequence::distance(const FacetSequence& facetSeq) const
     }
 }
 
+double
+FacetSequence::distance(const Coordinate& pt) const
+{
+    if(isPoint()) {
+        return pt.distance(pts->getAt(start));
+    }
+    return computeDistancePointLine(pt, *this, nullptr);
+}
+
 /*
 * Rather than get bent out of shape about returning a pointer
 * just return the whole mess, since it only ends up holding two
@@ -20,6 +20,12 @@
 #include <geos/index/strtree/STRtree.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
 using namespace geos::geom;
 using namespace geos::index::strtree;
 
@@ -27,6 +33,56 @@ namespace geos {
 namespace operation {
 namespace distance {
 
+namespace {
+
+using FacetNode = TemplateSTRtree<const FacetSequence*>::Node;
+
+double
+boundsDistance(const Envelope& env, const Coordinate& pt)
+{
+    double dx = std::max(0.0, std::max(env.getMinX() - pt.x, pt.x - env.getMaxX()));
+    double dy = std::max(0.0, std::max(env.getMinY() - pt.y, pt.y - env.getMaxY()));
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+/*
+ * Depth-first branch-and-bound search for the nearest facet to a point.
+ * Children are visited nearest first, using a fixed-size buffer
+ * on the stack so that no memory is allocated.
+ */
+void
+nearestFacetDistance(const FacetNode& node, const Coordinate& pt, double& minDistance)
+{
+    if(node.isLeaf()) {
+        if(!node.isDeleted()) {
+            minDistance = std::min(minDistance, node.getItem()->distance(pt));
+        }
+        return;
+    }
+
+    constexpr std::size_t MAX_SORTED_CHILDREN = 16;
+    std::array<std::pair<double, const FacetNode*>, MAX_SORTED_CHILDREN> children;
+    std::size_t numChildren = 0;
+    for(const FacetNode* child = node.beginChildren(); child < node.endChildren(); ++child) {
+        double dist = boundsDistance(child->getBounds(), pt);
+        if(dist >= minDistance) {
+            continue;
+        }
+        if(numChildren < MAX_SORTED_CHILDREN) {
+            children[numChildren++] = std::make_pair(dist, child);
+        }
+        else {
+            nearestFacetDistance(*child, pt, minDistance);
+        }
+    }
+    std::sort(children.begin(), children.begin() + static_cast<std::ptrdiff_t>(numChildren));
+    for(std::size_t i = 0; i < numChildren && children[i].first < minDistance; i++) {
+        nearestFacetDistance(*children[i].second, pt, minDistance);
+    }
+}
+
+} // anonymous namespace
+
 /*public static*/
 double
 IndexedFacetDistance::distance(const Geometry* g1, const Geometry* g2)
@@ -62,6 +118,19 @@ IndexedFacetDistance::distance(const Geometry* g) const
     return nearest.first->distance(*nearest.second);
 }
 
+double
+IndexedFacetDistance::distance(const Coordinate& pt) const
+{
+    const FacetNode* root = cachedTree->getRoot();
+    if(root == nullptr) {
+        throw util::GEOSException("Cannot calculate IndexedFacetDistance on empty geometries.");
+    }
+
+    double minDistance = std::numeric_limits<double>::infinity();
+    nearestFacetDistance(*root, pt, minDistance);
+    return minDistance;
+}
+
 std::vector<GeometryLocation>
 IndexedFacetDistance::nearestLocations(const geom::Geometry* g) const
 {
@@ -0,0 +1,147 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/intersection/RectangleGridIntersection.h>
+#include <geos/operation/intersection/Rectangle.h>
+#include <geos/operation/intersection/RectangleIntersection.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace operation { // geos::operation
+namespace intersection { // geos::operation::intersection
+
+RectangleGridIntersection::RectangleGridIntersection(double p_originX, double p_originY,
+        double p_cellWidth, double p_cellHeight,
+        double p_buffer)
+    : originX(p_originX)
+    , originY(p_originY)
+    , cellWidth(p_cellWidth)
+    , cellHeight(p_cellHeight)
+    , buffer(p_buffer)
+{
+    if(!(cellWidth > 0 && cellHeight > 0)) {
+        throw util::IllegalArgumentException("Grid cell size must be positive");
+    }
+    if(!(buffer >= 0)) {
+        throw util::IllegalArgumentException("Grid buffer must be non-negative");
+    }
+}
+
+/* public static */
+std::vector<RectangleGridIntersection::Tile>
+RectangleGridIntersection::clip(const Geometry& geom,
+                                double originX, double originY,
+                                double cellWidth, double cellHeight,
+                                double buffer)
+{
+    RectangleGridIntersection rgi(originX, originY, cellWidth, cellHeight, buffer);
+    return rgi.clip(geom);
+}
+
+/* public */
+std::vector<RectangleGridIntersection::Tile>
+RectangleGridIntersection::clip(const Geometry& geom) const
+{
+    std::vector<Tile> tiles;
+    if(geom.isEmpty()) {
+        return tiles;
+    }
+
+    // The tiles whose buffered rectangle intersects the envelope
+    const Envelope* env = geom.getEnvelopeInternal();
+    TileRange range;
+    range.col0 = toIndex(std::ceil((env->getMinX() - buffer - originX) / cellWidth) - 1);
+    range.col1 = toIndex(std::floor((env->getMaxX() + buffer - originX) / cellWidth) + 1);
+    range.row0 = toIndex(std::ceil((env->getMinY() - buffer - originY) / cellHeight) - 1);
+    range.row1 = toIndex(std::floor((env->getMaxY() + buffer - originY) / cellHeight) + 1);
+
+    // The geometry lies within the rectangle of the whole range,
+    // so it does not need to be clipped to it.
+    if(range.isSingle()) {
+        clipRange(geom, range, tiles);
+    }
+    else {
+        clipHalves(geom, range, tiles);
+    }
+    return tiles;
+}
+
+/* private */
+Rectangle
+RectangleGridIntersection::getRectangle(const TileRange& range) const
+{
+    return Rectangle(originX + range.col0 * cellWidth - buffer,
+                     originY + range.row0 * cellHeight - buffer,
+                     originX + range.col1 * cellWidth + buffer,
+                     originY + range.row1 * cellHeight + buffer);
+}
+
+/* private static */
+int
+RectangleGridIntersection::toIndex(double offset)
+{
+    if(!(offset >= std::numeric_limits<int>::min() && offset <= std::numeric_limits<int>::max())) {
+        throw util::IllegalArgumentException("Geometry covers too many grid cells");
+    }
+    return static_cast<int>(offset);
+}
+
+/* private */
+void
+RectangleGridIntersection::clipHalves(const Geometry& geom, const TileRange& range,
+                                      std::vector<Tile>& tiles) const
+{
+    // split the longer side of the range
+    TileRange lo = range;
+    TileRange hi = range;
+    if(range.col1 - range.col0 >= range.row1 - range.row0) {
+        int mid = range.col0 + (range.col1 - range.col0) / 2;
+        lo.col1 = mid;
+        hi.col0 = mid;
+    }
+    else {
+        int mid = range.row0 + (range.row1 - range.row0) / 2;
+        lo.row1 = mid;
+        hi.row0 = mid;
+    }
+
+    clipRange(geom, lo, tiles);
+    clipRange(geom, hi, tiles);
+}
+
+/* private */
+void
+RectangleGridIntersection::clipRange(const Geometry& geom, const TileRange& range,
+                                     std::vector<Tile>& tiles) const
+{
+    std::unique_ptr<Geometry> clipped = RectangleIntersection::clip(geom, getRectangle(range));
+    if(clipped->isEmpty()) {
+        return;
+    }
+
+    if(range.isSingle()) {
+        tiles.push_back(Tile{ range.col0, range.row0, std::move(clipped) });
+        return;
+    }
+    clipHalves(*clipped, range, tiles);
+}
+
+} // namespace geos::operation::intersection
+} // namespace geos::operation
+} // namespace geos
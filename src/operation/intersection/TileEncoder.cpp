@@ -0,0 +1,343 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/intersection/TileEncoder.h>
+#include <geos/operation/intersection/Rectangle.h>
+#include <geos/operation/intersection/RectangleIntersection.h>
+#include <geos/operation/valid/IsValidOp.h>
+#include <geos/simplify/DouglasPeuckerLineSimplifier.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/Dimension.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/util/GeometryFixer.h>
+#include <geos/geom/util/LinearComponentExtracter.h>
+#include <geos/geom/util/PointExtracter.h>
+#include <geos/geom/util/PolygonExtracter.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace operation { // geos::operation
+namespace intersection { // geos::operation::intersection
+
+TileEncoder::TileEncoder(const Envelope& p_tileEnv, uint32_t p_extent, uint32_t p_buffer)
+    : tileEnv(p_tileEnv)
+    , extent(p_extent)
+    , buffer(p_buffer)
+    , scaleX(0)
+    , scaleY(0)
+    , pm(1.0)
+    , simplifyTolerance(0)
+    , fixValidity(true)
+{
+    if(tileEnv.isNull() || !(tileEnv.getWidth() > 0 && tileEnv.getHeight() > 0)) {
+        throw util::IllegalArgumentException("Tile envelope must be non-empty");
+    }
+    if(p_extent == 0) {
+        throw util::IllegalArgumentException("Tile extent must be positive");
+    }
+    if(static_cast<uint64_t>(p_extent) + p_buffer > static_cast<uint64_t>(std::numeric_limits<int32_t>::max())) {
+        throw util::IllegalArgumentException("Tile extent and buffer must fit in 32-bit grid coordinates");
+    }
+    scaleX = extent / tileEnv.getWidth();
+    scaleY = extent / tileEnv.getHeight();
+}
+
+/* public */
+void
+TileEncoder::setSimplifyTolerance(double tolerance)
+{
+    if(!(tolerance >= 0)) {
+        throw util::IllegalArgumentException("Tolerance must be non-negative");
+    }
+    simplifyTolerance = tolerance;
+}
+
+/* public */
+void
+TileEncoder::encode(const Geometry& geom, Result& result) const
+{
+    result.clear();
+    if(geom.isEmpty()) {
+        return;
+    }
+
+    Rectangle rect(tileEnv.getMinX() - buffer / scaleX, tileEnv.getMinY() - buffer / scaleY,
+                   tileEnv.getMaxX() + buffer / scaleX, tileEnv.getMaxY() + buffer / scaleY);
+    std::unique_ptr<Geometry> clipped = RectangleIntersection::clip(geom, rect);
+    if(clipped->isEmpty()) {
+        return;
+    }
+
+    GeomType type;
+    switch(clipped->getDimension()) {
+    case Dimension::P:
+        encodePoints(*clipped, result);
+        type = POINT;
+        break;
+    case Dimension::L:
+        encodeLines(*clipped, result);
+        type = LINESTRING;
+        break;
+    default:
+        encodePolygons(*clipped, result);
+        type = POLYGON;
+        break;
+    }
+    if(!result.isEmpty()) {
+        result.type = type;
+    }
+}
+
+/* private */
+void
+TileEncoder::toTile(const LineString& line, CoordsVect& pts) const
+{
+    const CoordinateSequence* seq = line.getCoordinatesRO();
+    std::size_t n = seq->size();
+    pts.resize(n);
+    for(std::size_t i = 0; i < n; i++) {
+        const Coordinate& c = seq->getAt(i);
+        pts[i].x = (c.x - tileEnv.getMinX()) * scaleX;
+        pts[i].y = (tileEnv.getMaxY() - c.y) * scaleY;
+        pm.makePrecise(pts[i]);
+    }
+}
+
+/* private */
+void
+TileEncoder::reduce(CoordsVect& pts, bool isRing) const
+{
+    auto last = std::unique(pts.begin(), pts.end(), [](const Coordinate& a, const Coordinate& b) {
+        return a.equals2D(b);
+    });
+    pts.erase(last, pts.end());
+
+    // a ring needs at least one point between its endpoints to be simplified
+    std::size_t minSize = isRing ? 4 : 3;
+    if(simplifyTolerance > 0 && pts.size() >= minSize) {
+        auto simplified = simplify::DouglasPeuckerLineSimplifier::simplify(pts, simplifyTolerance);
+        pts.swap(*simplified);
+    }
+}
+
+/* private */
+void
+TileEncoder::encodePoints(const Geometry& geom, Result& result) const
+{
+    Point::ConstVect points;
+    geom::util::PointExtracter::getPoints(geom, points);
+
+    std::size_t numPoints = 0;
+    for(const Point* pt : points) {
+        if(pt->isEmpty()) {
+            continue;
+        }
+        Coordinate c((pt->getX() - tileEnv.getMinX()) * scaleX, (tileEnv.getMaxY() - pt->getY()) * scaleY);
+        pm.makePrecise(c);
+        result.coords.push_back(toGrid(c.x));
+        result.coords.push_back(toGrid(c.y));
+        numPoints++;
+    }
+    if(numPoints > 0) {
+        result.parts.push_back(static_cast<uint32_t>(numPoints));
+    }
+}
+
+/* private */
+void
+TileEncoder::encodeLines(const Geometry& geom, Result& result) const
+{
+    std::vector<const LineString*> lines;
+    geom::util::LinearComponentExtracter::getLines(geom, lines);
+
+    CoordsVect pts;
+    for(const LineString* line : lines) {
+        if(line->isEmpty()) {
+            continue;
+        }
+        toTile(*line, pts);
+        reduce(pts, false);
+        if(pts.size() >= 2) {
+            addPart(pts, pts.size(), result);
+        }
+    }
+}
+
+/* private */
+void
+TileEncoder::encodePolygons(const Geometry& geom, Result& result) const
+{
+    std::vector<const Polygon*> polys;
+    geom::util::PolygonExtracter::getPolygons(geom, polys);
+
+    std::vector<CoordsVect> rings;
+    for(const Polygon* poly : polys) {
+        if(poly->isEmpty()) {
+            continue;
+        }
+        std::size_t numHoles = poly->getNumInteriorRing();
+        rings.resize(1 + numHoles);
+        toTile(*poly->getExteriorRing(), rings[0]);
+        for(std::size_t j = 0; j < numHoles; j++) {
+            toTile(*poly->getInteriorRingN(j), rings[1 + j]);
+        }
+        encodePolygon(rings, result);
+    }
+}
+
+/* private */
+void
+TileEncoder::encodePolygon(std::vector<CoordsVect>& rings, Result& result) const
+{
+    // drop collapsed rings; a collapsed shell removes the whole polygon
+    std::size_t numRings = 0;
+    for(std::size_t i = 0; i < rings.size(); i++) {
+        reduce(rings[i], true);
+        if(rings[i].size() < 4 || signedArea(rings[i]) == 0) {
+            if(i == 0) {
+                return;
+            }
+            continue;
+        }
+        if(numRings != i) {
+            rings[numRings].swap(rings[i]);
+        }
+        numRings++;
+    }
+    rings.resize(numRings);
+
+    if(fixValidity) {
+        const GeometryFactory* factory = GeometryFactory::getDefaultInstance();
+        const CoordinateSequenceFactory* csf = factory->getCoordinateSequenceFactory();
+        std::vector<std::unique_ptr<LinearRing>> holes;
+        for(std::size_t i = 1; i < rings.size(); i++) {
+            holes.push_back(factory->createLinearRing(csf->create(CoordsVect(rings[i]))));
+        }
+        std::unique_ptr<Polygon> poly = factory->createPolygon(
+            factory->createLinearRing(csf->create(CoordsVect(rings[0]))), std::move(holes));
+        if(!valid::IsValidOp::isValid(poly.get())) {
+            fixPolygon(*poly, result);
+            return;
+        }
+    }
+
+    for(std::size_t i = 0; i < rings.size(); i++) {
+        // shells have positive area, holes negative
+        bool isShell = (i == 0);
+        if((signedArea(rings[i]) > 0) != isShell) {
+            std::reverse(rings[i].begin(), rings[i].end());
+        }
+        addPart(rings[i], rings[i].size() - 1, result);
+    }
+}
+
+/* private */
+void
+TileEncoder::fixPolygon(const Polygon& poly, Result& result) const
+{
+    std::unique_ptr<Geometry> fixed = geom::util::GeometryFixer::fix(&poly);
+
+    // The repaired polygons have new vertices at self-intersections,
+    // which are rounded to the grid again. They are not checked again,
+    // since rounding may not converge to a valid result.
+    std::vector<const Polygon*> parts;
+    geom::util::PolygonExtracter::getPolygons(*fixed, parts);
+
+    std::vector<CoordsVect> rings;
+    for(const Polygon* part : parts) {
+        if(part->isEmpty()) {
+            continue;
+        }
+        std::size_t numHoles = part->getNumInteriorRing();
+        rings.resize(1 + numHoles);
+        for(std::size_t j = 0; j <= numHoles; j++) {
+            const LineString* ring = (j == 0) ? part->getExteriorRing() : part->getInteriorRingN(j - 1);
+            ring->getCoordinatesRO()->toVector(rings[j]);
+            for(Coordinate& c : rings[j]) {
+                pm.makePrecise(c);
+            }
+        }
+
+        for(std::size_t j = 0; j < rings.size(); j++) {
+            auto last = std::unique(rings[j].begin(), rings[j].end(), [](const Coordinate& a, const Coordinate& b) {
+                return a.equals2D(b);
+            });
+            rings[j].erase(last, rings[j].end());
+            if(rings[j].size() < 4 || signedArea(rings[j]) == 0) {
+                if(j == 0) {
+                    break;
+                }
+                continue;
+            }
+            bool isShell = (j == 0);
+            if((signedArea(rings[j]) > 0) != isShell) {
+                std::reverse(rings[j].begin(), rings[j].end());
+            }
+            addPart(rings[j], rings[j].size() - 1, result);
+        }
+    }
+}
+
+/*
+ * The clipped coordinates are within the buffered tile up to rounding
+ * errors, which the constructor checked to fit in an int32_t. Clamping
+ * keeps the conversion defined for any remaining error or NaN.
+ */
+int32_t
+TileEncoder::toGrid(double v) const
+{
+    if(!(v >= -buffer)) {
+        return static_cast<int32_t>(-buffer);
+    }
+    if(v > extent + buffer) {
+        return static_cast<int32_t>(extent + buffer);
+    }
+    return static_cast<int32_t>(v);
+}
+
+/* private */
+void
+TileEncoder::addPart(const CoordsVect& pts, std::size_t n, Result& result) const
+{
+    for(std::size_t i = 0; i < n; i++) {
+        result.coords.push_back(toGrid(pts[i].x));
+        result.coords.push_back(toGrid(pts[i].y));
+    }
+    result.parts.push_back(static_cast<uint32_t>(n));
+}
+
+/* private static */
+double
+TileEncoder::signedArea(const CoordsVect& ring)
+{
+    double sum = 0;
+    for(std::size_t i = 0; i + 1 < ring.size(); i++) {
+        sum += ring[i].x * ring[i + 1].y - ring[i + 1].x * ring[i].y;
+    }
+    return sum;
+}
+
+} // namespace geos::operation::intersection
+} // namespace geos::operation
+} // namespace geos
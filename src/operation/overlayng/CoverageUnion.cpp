@@ -0,0 +1,142 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/overlayng/CoverageUnion.h>
+
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+#include <geos/noding/BoundaryChainNoder.h>
+#include <geos/noding/ValidatingNoder.h>
+#include <geos/index/strtree/EnvelopeClusterFinder.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/util/PolygonExtracter.h>
+#include <geos/util/TopologyException.h>
+
+#include <cmath>
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+using namespace geos::geom;
+
+/*public static*/
+std::unique_ptr<Geometry>
+CoverageUnion::geomunion(const Geometry* coverage)
+{
+    if (coverage->isEmpty() || ! coverage->isPolygonal()) {
+        return OverlayNGRobust::Union(coverage);
+    }
+
+    std::vector<std::vector<const Polygon*>> clusters = cluster(coverage);
+    if (clusters.size() == 1) {
+        return unionCluster(coverage);
+    }
+
+    /**
+    * Clusters have disjoint envelopes,
+    * so their unions can simply be combined.
+    */
+    const GeometryFactory* geomFact = coverage->getFactory();
+    std::vector<std::unique_ptr<Geometry>> resultPolys;
+    for (const auto& clusterPolys : clusters) {
+        std::unique_ptr<Geometry> clusterResult;
+        if (clusterPolys.size() == 1) {
+            clusterResult = clusterPolys[0]->clone();
+        }
+        else {
+            std::vector<std::unique_ptr<Geometry>> polys;
+            polys.reserve(clusterPolys.size());
+            for (const Polygon* poly : clusterPolys) {
+                polys.emplace_back(poly->clone());
+            }
+            std::unique_ptr<Geometry> clusterGeom = geomFact->createMultiPolygon(std::move(polys));
+            clusterResult = unionCluster(clusterGeom.get());
+        }
+
+        for (std::size_t i = 0; i < clusterResult->getNumGeometries(); i++) {
+            const Geometry* comp = clusterResult->getGeometryN(i);
+            if (! comp->isEmpty()) {
+                resultPolys.emplace_back(comp->clone());
+            }
+        }
+    }
+    return geomFact->buildGeometry(std::move(resultPolys));
+}
+
+/*private static*/
+std::vector<std::vector<const Polygon*>>
+CoverageUnion::cluster(const Geometry* geom)
+{
+    std::vector<const Polygon*> polys;
+    geom::util::PolygonExtracter::getPolygons(*geom, polys);
+
+    std::vector<const Envelope*> envelopes;
+    envelopes.reserve(polys.size());
+    for (const Polygon* poly : polys) {
+        envelopes.push_back(poly->getEnvelopeInternal());
+    }
+
+    std::vector<std::vector<const Polygon*>> clusters;
+    for (const auto& clusterItems : index::strtree::EnvelopeClusterFinder::cluster(envelopes)) {
+        clusters.emplace_back();
+        for (std::size_t i : clusterItems) {
+            clusters.back().push_back(polys[i]);
+        }
+    }
+    return clusters;
+}
+
+/*private static*/
+std::unique_ptr<Geometry>
+CoverageUnion::unionCluster(const Geometry* geom)
+{
+    std::unique_ptr<Geometry> result = unionCoverage(geom);
+    if (result == nullptr) {
+        result = OverlayNGRobust::Union(geom);
+    }
+    return result;
+}
+
+/*private static*/
+std::unique_ptr<Geometry>
+CoverageUnion::unionCoverage(const Geometry* geom)
+{
+    noding::BoundaryChainNoder chainNoder;
+    noding::ValidatingNoder noder(chainNoder);
+
+    std::unique_ptr<Geometry> result;
+    try {
+        // a precision model is not needed since no noding is done
+        result = OverlayNG::geomunion(geom, nullptr, &noder);
+    }
+    catch (const geos::util::TopologyException&) {
+        // boundary chains are not correctly noded
+        return nullptr;
+    }
+
+    // an overlap in the input shows up as a loss of area
+    double areaIn = geom->getArea();
+    double areaOut = result->getArea();
+    if (areaIn > 0 && std::abs(areaOut - areaIn) / areaIn > AREA_PCT_DIFF_TOL) {
+        return nullptr;
+    }
+    return result;
+}
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
@@ -18,6 +18,7 @@
 
 #include <geos/operation/overlayng/EdgeNodingBuilder.h>
 #include <geos/operation/overlayng/EdgeMerger.h>
+#include <geos/noding/FastNodingValidator.h>
 #include <geos/util.h>
 
 using geos::operation::valid::RepeatedPointRemover;
@@ -35,7 +36,7 @@ EdgeNodingBuilder::getNoder()
     }
 
     if (OverlayUtil::isFloating(pm)) {
-        internalNoder = createFloatingPrecisionNoder(IS_NODING_VALIDATED);
+        internalNoder = createFloatingPrecisionNoder(IS_NODING_VALIDATED && isThrowOnInvalidNoding);
     }
     else {
         internalNoder = createFixedPrecisionNoder(pm);
@@ -102,6 +103,23 @@ EdgeNodingBuilder::node(std::vector<SegmentString*>* segStrings)
 
     std::unique_ptr<std::vector<SegmentString*>> nodedSS(noder->getNodedSubstrings());
 
+    /**
+    * If the validating noder is not in use, check the
+    * floating noding here and report failure through
+    * isNodingValid() rather than by throwing.
+    */
+    if (customNoder == nullptr && OverlayUtil::isFloating(pm)
+        && IS_NODING_VALIDATED && ! isThrowOnInvalidNoding) {
+        noding::FastNodingValidator nv(*nodedSS);
+        if (! nv.isValid()) {
+            nodingError = nv.getErrorMessage();
+            for (SegmentString* ss : *nodedSS) {
+                delete ss;
+            }
+            return nodedEdges;
+        }
+    }
+
     nodedEdges = createEdges(nodedSS.get());
 
     // Clean up now that all the info is transferred to Edges
@@ -22,6 +22,7 @@ namespace overlayng { // geos.operation.overlayng
 /*public*/
 InputGeometry::InputGeometry(const Geometry* geomA, const Geometry* geomB)
     : geom{{geomA, geomB}}
+    , ptLocatorExt{{nullptr, nullptr}}
     , isCollapsed{{false, false}}
 {}
 
@@ -151,6 +152,9 @@ InputGeometry::locatePointInArea(uint8_t geomIndex, const Coordinate& pt)
 PointOnGeometryLocator*
 InputGeometry::getLocator(uint8_t geomIndex)
 {
+    if (ptLocatorExt[geomIndex] != nullptr) {
+        return ptLocatorExt[geomIndex];
+    }
     if (geomIndex == 0) {
         if (ptLocatorA == nullptr)
             ptLocatorA.reset(new IndexedPointInAreaLocator(*getGeometry(geomIndex)));
@@ -164,6 +168,13 @@ InputGeometry::getLocator(uint8_t geomIndex)
 }
 
 
+/*public*/
+void
+InputGeometry::setLocator(uint8_t geomIndex, PointOnGeometryLocator* locator)
+{
+    ptLocatorExt[geomIndex] = locator;
+}
+
 /*public*/
 void
 InputGeometry::setCollapsed(uint8_t geomIndex, bool isGeomCollapsed)
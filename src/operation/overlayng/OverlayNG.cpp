@@ -31,11 +31,20 @@
 #include <geos/operation/overlayng/OverlayPoints.h>
 #include <geos/operation/overlayng/OverlayUtil.h>
 #include <geos/operation/overlayng/PolygonBuilder.h>
+#include <geos/operation/valid/RepeatedPointRemover.h>
+#include <geos/algorithm/Orientation.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/Envelope.h>
 #include <geos/geom/Location.h>
 #include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/Stats.h>
 
 #include <algorithm>
 
@@ -55,6 +64,7 @@ namespace operation { // geos.operation
 namespace overlayng { // geos.operation.overlayng
 
 using namespace geos::geom;
+using geos::util::Stats;
 
 
 /*public static*/
@@ -177,7 +187,15 @@ OverlayNG::getResult()
     }
     else {
         // handle case where both inputs are formed of edges (Lines and Polygons)
-        result = computeEdgeOverlay();
+        result = computeDisjointOverlay();
+        if (result == nullptr && nodingError.empty()) {
+            result = computeEdgeOverlay();
+        }
+    }
+
+    // noding failed and throwing is disabled
+    if (result == nullptr) {
+        return nullptr;
     }
 
 #if GEOS_DEBUG
@@ -211,6 +229,7 @@ OverlayNG::computeEdgeOverlay()
      * Formerly in nodeEdges())
      */
     EdgeNodingBuilder nodingBuilder(pm, noder);
+    nodingBuilder.setThrowOnInvalidNoding(isThrowOnInvalidNoding);
 
     GEOS_CHECK_FOR_INTERRUPTS();
 
@@ -222,9 +241,18 @@ OverlayNG::computeEdgeOverlay()
         }
     }
 
-    std::vector<Edge*> edges = nodingBuilder.build(
-        inputGeom.getGeometry(0),
-        inputGeom.getGeometry(1));
+    std::vector<Edge*> edges;
+    {
+        Stats::Timer timer(Stats::NODING);
+        edges = nodingBuilder.build(
+            inputGeom.getGeometry(0),
+            inputGeom.getGeometry(1));
+    }
+
+    if (! nodingBuilder.isNodingValid()) {
+        nodingError = nodingBuilder.getNodingError();
+        return nullptr;
+    }
 
     GEOS_CHECK_FOR_INTERRUPTS();
 
@@ -244,10 +272,13 @@ OverlayNG::computeEdgeOverlay()
     // Sort the edges first, for comparison with JTS results
     // std::sort(edges.begin(), edges.end(), EdgeComparator);
     OverlayGraph graph;
-    for (Edge* e : edges) {
-        // Write out edge graph as hex for examination
-        // std::cout << *e << std::endl;
-        graph.addEdge(e);
+    {
+        Stats::Timer timer(Stats::GRAPH_BUILD);
+        for (Edge* e : edges) {
+            // Write out edge graph as hex for examination
+            // std::cout << *e << std::endl;
+            graph.addEdge(e);
+        }
     }
 
     if (isOutputNodedEdges) {
@@ -267,10 +298,187 @@ OverlayNG::computeEdgeOverlay()
     return extractResult(opCode, &graph);
 }
 
+/*private*/
+std::unique_ptr<Geometry>
+OverlayNG::computeDisjointOverlay()
+{
+    const Geometry* g0 = inputGeom.getGeometry(0);
+    const Geometry* g1 = inputGeom.getGeometry(1);
+
+    if (g1 == nullptr || opCode == INTERSECTION)
+        return nullptr;
+    if (! isOptimized || noder != nullptr || ! OverlayUtil::isFloating(pm))
+        return nullptr;
+    if (isOutputEdges || isOutputResultEdges)
+        return nullptr;
+
+    auto isPolygonal = [](const Geometry* g) {
+        return g->getGeometryTypeId() == GEOS_POLYGON
+            || g->getGeometryTypeId() == GEOS_MULTIPOLYGON;
+    };
+    if (! isPolygonal(g0) || ! isPolygonal(g1))
+        return nullptr;
+
+    // a single pair of polygons can only be partitioned
+    // if they are disjoint, which is handled elsewhere
+    if (g0->getNumGeometries() < 2 && g1->getNumGeometries() < 2)
+        return nullptr;
+
+    auto extractPolygons = [](const Geometry* g, std::vector<const Polygon*>& polys) {
+        for (std::size_t i = 0; i < g->getNumGeometries(); i++) {
+            const Polygon* poly = static_cast<const Polygon*>(g->getGeometryN(i));
+            if (! poly->isEmpty()) {
+                polys.push_back(poly);
+            }
+        }
+    };
+    std::vector<const Polygon*> polys0;
+    std::vector<const Polygon*> polys1;
+    extractPolygons(g0, polys0);
+    extractPolygons(g1, polys1);
+
+    index::strtree::TemplateSTRtree<std::size_t> index(10, polys1.size());
+    for (std::size_t i = 0; i < polys1.size(); i++) {
+        index.insert(*(polys1[i]->getEnvelopeInternal()), i);
+    }
+
+    std::vector<bool> isInteracting0(polys0.size(), false);
+    std::vector<bool> isInteracting1(polys1.size(), false);
+    std::size_t numInteracting0 = 0;
+    for (std::size_t i = 0; i < polys0.size(); i++) {
+        index.query(*(polys0[i]->getEnvelopeInternal()), [&](std::size_t j) {
+            isInteracting0[i] = true;
+            isInteracting1[j] = true;
+        });
+        if (isInteracting0[i])
+            numInteracting0++;
+    }
+    std::size_t numInteracting1 = static_cast<std::size_t>(
+        std::count(isInteracting1.begin(), isInteracting1.end(), true));
+
+    if (numInteracting0 == polys0.size() && numInteracting1 == polys1.size())
+        return nullptr;
+
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    std::vector<std::unique_ptr<Polygon>> resultPolyList;
+    std::vector<std::unique_ptr<LineString>> resultLineList;
+    std::vector<std::unique_ptr<Point>> resultPointList;
+
+    //--- disjoint components of A are in the result of every remaining op,
+    //--- disjoint components of B are not in the result of a difference
+    std::vector<std::unique_ptr<Geometry>> interacting0;
+    std::vector<std::unique_ptr<Geometry>> interacting1;
+    //--- a disjoint component with a collapsing ring needs the full overlay
+    for (std::size_t i = 0; i < polys0.size(); i++) {
+        if (isInteracting0[i]) {
+            interacting0.emplace_back(polys0[i]->clone());
+            continue;
+        }
+        std::unique_ptr<Polygon> poly = copyDisjointPolygon(polys0[i]);
+        if (poly == nullptr)
+            return nullptr;
+        resultPolyList.push_back(std::move(poly));
+    }
+    for (std::size_t i = 0; i < polys1.size(); i++) {
+        if (isInteracting1[i]) {
+            interacting1.emplace_back(polys1[i]->clone());
+            continue;
+        }
+        if (opCode == DIFFERENCE)
+            continue;
+        std::unique_ptr<Polygon> poly = copyDisjointPolygon(polys1[i]);
+        if (poly == nullptr)
+            return nullptr;
+        resultPolyList.push_back(std::move(poly));
+    }
+
+    //--- interaction is symmetric, so both sides are empty or neither is
+    if (! interacting0.empty()) {
+        std::unique_ptr<Geometry> part0 = geomFact->createMultiPolygon(std::move(interacting0));
+        std::unique_ptr<Geometry> part1 = geomFact->createMultiPolygon(std::move(interacting1));
+
+        OverlayNG ov(part0.get(), part1.get(), pm, opCode);
+        ov.setStrictMode(isStrictMode);
+        ov.setAreaResultOnly(isAreaResultOnly);
+        ov.setThrowOnInvalidNoding(isThrowOnInvalidNoding);
+        std::unique_ptr<Geometry> partResult = ov.computeEdgeOverlay();
+        if (partResult == nullptr) {
+            nodingError = ov.nodingError;
+            return nullptr;
+        }
+
+        std::vector<std::unique_ptr<Geometry>> partComponents;
+        if (partResult->isCollection()) {
+            partComponents = static_cast<GeometryCollection*>(partResult.get())->releaseGeometries();
+        }
+        else {
+            partComponents.push_back(std::move(partResult));
+        }
+        for (auto& comp : partComponents) {
+            if (comp->isEmpty())
+                continue;
+            switch (comp->getGeometryTypeId()) {
+            case GEOS_POLYGON:
+                resultPolyList.emplace_back(static_cast<Polygon*>(comp.release()));
+                break;
+            case GEOS_LINESTRING:
+                resultLineList.emplace_back(static_cast<LineString*>(comp.release()));
+                break;
+            case GEOS_POINT:
+                resultPointList.emplace_back(static_cast<Point*>(comp.release()));
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    if (resultPolyList.empty() &&
+        resultLineList.empty() &&
+        resultPointList.empty())
+    {
+        return createEmptyResult();
+    }
+    return OverlayUtil::createResultGeometry(resultPolyList, resultLineList, resultPointList, geomFact);
+}
+
+/*private*/
+std::unique_ptr<LinearRing>
+OverlayNG::copyDisjointRing(const LinearRing* ring, bool isCCW) const
+{
+    std::unique_ptr<CoordinateSequence> pts =
+        operation::valid::RepeatedPointRemover::removeRepeatedPoints(ring->getCoordinatesRO());
+    if (pts->size() < 4)
+        return nullptr;
+    if (algorithm::Orientation::isCCW(pts.get()) != isCCW)
+        CoordinateSequence::reverse(pts.get());
+    return geomFact->createLinearRing(std::move(pts));
+}
+
+/*private*/
+std::unique_ptr<Polygon>
+OverlayNG::copyDisjointPolygon(const Polygon* poly) const
+{
+    //--- orient rings the way PolygonBuilder does: shells CW, holes CCW
+    std::unique_ptr<LinearRing> shell = copyDisjointRing(poly->getExteriorRing(), false);
+    if (shell == nullptr)
+        return nullptr;
+    std::vector<std::unique_ptr<LinearRing>> holes;
+    for (std::size_t i = 0; i < poly->getNumInteriorRing(); i++) {
+        std::unique_ptr<LinearRing> hole = copyDisjointRing(poly->getInteriorRingN(i), true);
+        if (hole == nullptr)
+            return nullptr;
+        holes.push_back(std::move(hole));
+    }
+    return geomFact->createPolygon(std::move(shell), std::move(holes));
+}
+
 /*private*/
 void
 OverlayNG::labelGraph(OverlayGraph* graph)
 {
+    Stats::Timer timer(Stats::LABELLING);
     OverlayLabeller labeller(graph, &inputGeom);
     labeller.computeLabelling();
     labeller.markResultAreaEdges(opCode);
@@ -290,9 +498,13 @@ OverlayNG::extractResult(int p_opCode, OverlayGraph* graph)
     bool isAllowMixedIntResult = ! isStrictMode;
 
     //--- Build polygons
-    std::vector<OverlayEdge*> resultAreaEdges = graph->getResultAreaEdges();
-    PolygonBuilder polyBuilder(resultAreaEdges, geomFact);
-    std::vector<std::unique_ptr<Polygon>> resultPolyList = polyBuilder.getPolygons();
+    std::vector<std::unique_ptr<Polygon>> resultPolyList;
+    {
+        Stats::Timer timer(Stats::RING_BUILDING);
+        std::vector<OverlayEdge*> resultAreaEdges = graph->getResultAreaEdges();
+        PolygonBuilder polyBuilder(resultAreaEdges, geomFact);
+        resultPolyList = polyBuilder.getPolygons();
+    }
     bool hasResultAreaComponents = (!resultPolyList.empty());
 
     std::vector<std::unique_ptr<LineString>> resultLineList;
@@ -26,8 +26,11 @@
 #include <geos/noding/snap/SnappingNoder.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/PrecisionModel.h>
+#include <geos/util/Stats.h>
 #include <geos/util/TopologyException.h>
 
+#include <array>
+#include <atomic>
 #include <stdexcept>
 
 #ifndef GEOS_DEBUG
@@ -39,7 +42,32 @@ namespace operation { // geos.operation
 namespace overlayng { // geos.operation.overlayng
 
 using namespace geos::geom;
+using geos::util::Stats;
 
+static std::array<std::atomic<std::size_t>, OverlayNGRobust::NUM_STRATEGIES> strategyCounts;
+
+/*private static*/
+void
+OverlayNGRobust::countStrategy(int strategy)
+{
+    strategyCounts[static_cast<std::size_t>(strategy)].fetch_add(1, std::memory_order_relaxed);
+}
+
+/*public static*/
+std::size_t
+OverlayNGRobust::getStrategyCount(Strategy strategy)
+{
+    return strategyCounts[static_cast<std::size_t>(strategy)].load(std::memory_order_relaxed);
+}
+
+/*public static*/
+void
+OverlayNGRobust::resetStrategyCounts()
+{
+    for (auto& count : strategyCounts) {
+        count.store(0, std::memory_order_relaxed);
+    }
+}
 
 /*public static*/
 std::unique_ptr<Geometry>
@@ -94,7 +122,9 @@ OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCod
 #if GEOS_DEBUG
         std::cout << "Using fixed precision overlay." << std::endl;
 #endif
-        return OverlayNG::overlay(geom0, geom1, opCode, geom0->getPrecisionModel());
+        result = OverlayNG::overlay(geom0, geom1, opCode, geom0->getPrecisionModel());
+        countStrategy(STRATEGY_FIXED_PRECISION);
+        return result;
     }
 
     /**
@@ -103,18 +133,34 @@ OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCod
      * By default the noder is validated, which is required in order
      * to detect certain invalid noding situations which otherwise
      * cause incorrect overlay output.
+     * The noding validity is reported as a status rather than
+     * by throwing, since noding failure is the common case for
+     * falling back to the snapping strategies.
      */
     try {
         geom::PrecisionModel PM_FLOAT;
         // std::cout << "Using floating point overlay." << std::endl;
-        result = OverlayNG::overlay(geom0, geom1, opCode, &PM_FLOAT);
+        OverlayNG ov(geom0, geom1, &PM_FLOAT, opCode);
+        ov.setThrowOnInvalidNoding(false);
+        result = ov.getResult();
 
         // Simple noding with no validation
         // There are cases where this succeeds with invalid noding (e.g. STMLF 1608).
         // So currently it is NOT safe to run overlay without noding validation
         //result = OverlayNG.overlay(geom0, geom1, opCode, createFloatingNoValidNoder());
-        // std::cout << "Floating point overlay success." << std::endl;
-        return result;
+        if (result != nullptr) {
+            // std::cout << "Floating point overlay success." << std::endl;
+            countStrategy(STRATEGY_FLOATING);
+            return result;
+        }
+        /**
+        * Capture noding failure,
+        * so it can be thrown if the remaining strategies all fail.
+        */
+        exOriginal = geos::util::TopologyException(ov.getNodingError());
+#if GEOS_DEBUG
+        std::cout << "Floating point overlay noding FAILURE: " << ov.getNodingError() << std::endl;
+#endif
     }
     catch (const std::runtime_error &ex) {
         /**
@@ -132,20 +178,29 @@ OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCod
      * if this throws an exception just let it go,
      * since it is something that is not a TopologyException
      */
-    result = overlaySnapTries(geom0, geom1, opCode);
+    {
+        Stats::Timer timer(Stats::ROBUSTNESS_RETRY);
+        result = overlaySnapTries(geom0, geom1, opCode);
+    }
     if (result != nullptr)
         return result;
 
     /**
      * On failure retry using snap-rounding with a heuristic scale factor (grid size).
      */
-    result = overlaySR(geom0, geom1, opCode);
-    if (result != nullptr)
+    {
+        Stats::Timer timer(Stats::SNAP_ROUNDING);
+        result = overlaySR(geom0, geom1, opCode);
+    }
+    if (result != nullptr) {
+        countStrategy(STRATEGY_SNAP_ROUNDING);
         return result;
+    }
 
     /**
      * Just can't get overlay to work, so throw original error.
      */
+    countStrategy(STRATEGY_FAILED);
     throw exOriginal;
 }
 
@@ -164,14 +219,20 @@ OverlayNGRobust::overlaySnapTries(const Geometry* geom0, const Geometry* geom1,
 #endif
 
         result = overlaySnapping(geom0, geom1, opCode, snapTol);
-        if (result != nullptr) return result;
+        if (result != nullptr) {
+            countStrategy(STRATEGY_SNAPPING);
+            return result;
+        }
 
       /**
        * Now try snapping each input individually,
        * and then doing the overlay.
        */
       result = overlaySnapBoth(geom0, geom1, opCode, snapTol);
-      if (result != nullptr) return result;
+      if (result != nullptr) {
+          countStrategy(STRATEGY_SNAP_BOTH);
+          return result;
+      }
 
       // increase the snap tolerance and try again
       snapTol = snapTol * 10;
@@ -0,0 +1,179 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/overlayng/PreparedOverlay.h>
+
+#include <geos/algorithm/locate/PointOnGeometryLocator.h>
+#include <geos/algorithm/locate/SimplePointInAreaLocator.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedPolygon.h>
+#include <geos/geom/util/ComponentCoordinateExtracter.h>
+#include <geos/noding/FastSegmentSetIntersectionFinder.h>
+#include <geos/noding/SegmentString.h>
+#include <geos/noding/SegmentStringUtil.h>
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+#include <geos/operation/overlayng/OverlayUtil.h>
+
+#include <stdexcept>
+#include <vector>
+
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+using namespace geos::geom;
+using geos::algorithm::locate::SimplePointInAreaLocator;
+
+
+/*public*/
+PreparedOverlay::PreparedOverlay(const prep::PreparedGeometry& p_prepGeom)
+    : prepGeom(p_prepGeom)
+    , prepPoly(dynamic_cast<const prep::PreparedPolygon*>(&p_prepGeom))
+{}
+
+/*public*/
+std::unique_ptr<Geometry>
+PreparedOverlay::intersection(const Geometry* g) const
+{
+    const Geometry* pg = &(prepGeom.getGeometry());
+    switch (locate(g)) {
+    case Location::INTERIOR:
+        return g->clone();
+    case Location::EXTERIOR:
+        return createEmptyResult(OverlayNG::INTERSECTION, pg, g);
+    default:
+        return overlay(pg, g, OverlayNG::INTERSECTION, 0);
+    }
+}
+
+/*public*/
+std::unique_ptr<Geometry>
+PreparedOverlay::difference(const Geometry* g) const
+{
+    const Geometry* pg = &(prepGeom.getGeometry());
+    switch (locate(g)) {
+    case Location::INTERIOR:
+        return createEmptyResult(OverlayNG::DIFFERENCE, g, pg);
+    case Location::EXTERIOR:
+        return g->clone();
+    default:
+        return overlay(g, pg, OverlayNG::DIFFERENCE, 1);
+    }
+}
+
+/*private*/
+Location
+PreparedOverlay::locate(const Geometry* g) const
+{
+    if (prepPoly == nullptr
+        || g->isEmpty()
+        || g->getGeometryTypeId() == GEOS_GEOMETRYCOLLECTION) {
+        return Location::BOUNDARY;
+    }
+    const Geometry& pg = prepGeom.getGeometry();
+    if (pg.isEmpty()) {
+        return Location::BOUNDARY;
+    }
+    if (! pg.getEnvelopeInternal()->intersects(g->getEnvelopeInternal())) {
+        return Location::EXTERIOR;
+    }
+
+    //-- any contact between the linework requires a full overlay
+    if (! g->isPuntal()) {
+        noding::SegmentString::ConstVect segStrings;
+        noding::SegmentStringUtil::extractSegmentStrings(g, segStrings);
+        bool isSegIntersecting = prepPoly->getIntersectionFinder()->intersects(&segStrings);
+        for (const noding::SegmentString* ss : segStrings) {
+            delete ss;
+        }
+        if (isSegIntersecting) {
+            return Location::BOUNDARY;
+        }
+    }
+
+    //-- now each component lies wholly inside or outside the prepared polygon
+    std::vector<const Coordinate*> pts;
+    geom::util::ComponentCoordinateExtracter::getCoordinates(*g, pts);
+    Location loc = Location::NONE;
+    for (const Coordinate* pt : pts) {
+        Location ptLoc = prepPoly->getPointLocator()->locate(pt);
+        if (ptLoc == Location::BOUNDARY) {
+            return Location::BOUNDARY;
+        }
+        if (loc == Location::NONE) {
+            loc = ptLoc;
+        }
+        else if (ptLoc != loc) {
+            return Location::BOUNDARY;
+        }
+    }
+
+    //-- an exterior area may still contain the prepared polygon,
+    //-- and an interior area may contain one of its holes
+    if (g->getDimension() == 2) {
+        for (const Coordinate* pt : *(prepPoly->getRepresentativePoints())) {
+            if (SimplePointInAreaLocator::locate(*pt, g) != Location::EXTERIOR) {
+                return Location::BOUNDARY;
+            }
+        }
+    }
+    return loc;
+}
+
+/*private*/
+std::unique_ptr<Geometry>
+PreparedOverlay::overlay(const Geometry* g0, const Geometry* g1, int opCode, uint8_t prepIndex) const
+{
+    if (prepPoly == nullptr
+        || ! g0->getPrecisionModel()->isFloating()
+        || g0->getGeometryTypeId() == GEOS_GEOMETRYCOLLECTION
+        || g1->getGeometryTypeId() == GEOS_GEOMETRYCOLLECTION) {
+        if (opCode == OverlayNG::INTERSECTION) {
+            return g0->intersection(g1);
+        }
+        return g0->difference(g1);
+    }
+
+    /**
+     * Run the floating overlay with the prepared locator,
+     * as the first step of OverlayNGRobust does.
+     */
+    try {
+        PrecisionModel PM_FLOAT;
+        OverlayNG ov(g0, g1, &PM_FLOAT, opCode);
+        ov.setPointLocator(prepIndex, prepPoly->getPointLocator());
+        return ov.getResult();
+    }
+    catch (const std::runtime_error&) {
+        // fall through to the full robust overlay
+    }
+    return OverlayNGRobust::Overlay(g0, g1, opCode);
+}
+
+/*private*/
+std::unique_ptr<Geometry>
+PreparedOverlay::createEmptyResult(int opCode, const Geometry* g0, const Geometry* g1) const
+{
+    int dim = OverlayUtil::resultDimension(opCode, g0->getDimension(), g1->getDimension());
+    return OverlayUtil::createEmptyResult(dim, g0->getFactory());
+}
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,266 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/shape/fractal/CurveSort.h>
+#include <geos/shape/fractal/HilbertCode.h>
+#include <geos/shape/fractal/MortonCode.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/util/Executor.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+
+namespace geos {
+namespace shape {   // geos.shape
+namespace fractal { // geos.shape.fractal
+
+namespace {
+
+// The minimum number of items processed by a thread
+const std::size_t MIN_ITEMS_PER_THREAD = 1 << 14;
+
+const unsigned int RADIX_BITS = 8;
+const std::size_t RADIX = std::size_t(1) << RADIX_BITS;
+
+std::size_t
+numThreads(std::size_t n, util::Executor* executor, std::size_t maxThreads)
+{
+    if(executor == nullptr) {
+        return 1;
+    }
+    std::size_t threads = executor->getNumThreads();
+    if(maxThreads > 0) {
+        threads = std::min(threads, maxThreads);
+    }
+    return std::max<std::size_t>(1, std::min(threads, n / MIN_ITEMS_PER_THREAD));
+}
+
+/*
+ * Processes the items [0, n) in ranges, in parallel if the executor
+ * has threads and there are enough items.
+ */
+template<typename F>
+void
+forRanges(std::size_t n, util::Executor* executor, std::size_t maxThreads, F&& f)
+{
+    if(numThreads(n, executor, maxThreads) > 1) {
+        executor->parallelFor(n, MIN_ITEMS_PER_THREAD, f, maxThreads);
+    }
+    else {
+        f(0, n);
+    }
+}
+
+/*
+ * Maps an ordinate to a column or row of the curve, clamping values
+ * outside the extent. Non-finite values are mapped to 0.
+ */
+uint32_t
+curveOrdinate(double v, double min, double scale, uint32_t maxOrd)
+{
+    double d = (v - min) * scale;
+    if(!(d > 0)) {
+        return 0;
+    }
+    if(d >= static_cast<double>(maxOrd)) {
+        return std::isfinite(d) ? maxOrd : 0;
+    }
+    return static_cast<uint32_t>(d);
+}
+
+} // anonymous namespace
+
+std::vector<std::size_t>
+sortOrder(const std::vector<uint32_t>& codes, util::Executor* executor, std::size_t maxThreads)
+{
+    std::size_t n = codes.size();
+    std::vector<std::size_t> idx(n);
+    std::iota(idx.begin(), idx.end(), std::size_t(0));
+
+    std::size_t numParts = numThreads(n, executor, maxThreads);
+    auto forParts = [&](const std::function<void(std::size_t, std::size_t, std::size_t)>& f) {
+        auto partRange = [&](std::size_t begin, std::size_t end) {
+            for(std::size_t p = begin; p < end; p++) {
+                f(p, n * p / numParts, n * (p + 1) / numParts);
+            }
+        };
+        if(numParts > 1) {
+            executor->parallelFor(numParts, 1, partRange, numParts);
+        }
+        else {
+            partRange(0, 1);
+        }
+    };
+
+    std::vector<uint32_t> keys(codes);
+    std::vector<uint32_t> keysTmp(n);
+    std::vector<std::size_t> idxTmp(n);
+    // counts, then output offsets, of each digit in each part
+    std::vector<std::size_t> offsets(numParts * RADIX);
+
+    // Least significant digit first; each pass is stable, and each part
+    // writes its items of a digit after those of the previous parts.
+    for(unsigned int shift = 0; shift < 32; shift += RADIX_BITS) {
+        forParts([&](std::size_t part, std::size_t begin, std::size_t end) {
+            std::size_t* count = &offsets[part * RADIX];
+            std::fill(count, count + RADIX, 0);
+            for(std::size_t i = begin; i < end; i++) {
+                count[(keys[i] >> shift) & (RADIX - 1)]++;
+            }
+        });
+
+        std::size_t offset = 0;
+        bool singleDigit = false;
+        for(std::size_t d = 0; d < RADIX; d++) {
+            std::size_t digitStart = offset;
+            for(std::size_t part = 0; part < numParts; part++) {
+                std::size_t count = offsets[part * RADIX + d];
+                offsets[part * RADIX + d] = offset;
+                offset += count;
+            }
+            if(offset - digitStart == n) {
+                singleDigit = true;
+            }
+        }
+        if(singleDigit) {
+            // all items have the same digit, so the pass would not move them
+            continue;
+        }
+
+        forParts([&](std::size_t part, std::size_t begin, std::size_t end) {
+            std::size_t* next = &offsets[part * RADIX];
+            for(std::size_t i = begin; i < end; i++) {
+                std::size_t pos = next[(keys[i] >> shift) & (RADIX - 1)]++;
+                keysTmp[pos] = keys[i];
+                idxTmp[pos] = idx[i];
+            }
+        });
+        keys.swap(keysTmp);
+        idx.swap(idxTmp);
+    }
+    return idx;
+}
+
+std::vector<uint32_t>
+encode(const double* x, const double* y, std::size_t n, Curve curve, const geom::Envelope& extent,
+       util::Executor* executor, std::size_t maxThreads)
+{
+    std::vector<uint32_t> codes(n);
+    if(n == 0) {
+        return codes;
+    }
+
+    // Both curves have 2^16 cells along each side at their maximum level
+    const uint32_t level = HilbertCode::MAX_LEVEL;
+    const uint32_t maxOrd = HilbertCode::maxOrdinate(level);
+    double minX = extent.getMinX();
+    double minY = extent.getMinY();
+    double scaleX = extent.getWidth() > 0 ? maxOrd / extent.getWidth() : 0;
+    double scaleY = extent.getHeight() > 0 ? maxOrd / extent.getHeight() : 0;
+    if(extent.isNull()) {
+        minX = minY = scaleX = scaleY = 0;
+    }
+
+    forRanges(n, executor, maxThreads, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; i++) {
+            uint32_t ix = curveOrdinate(x[i], minX, scaleX, maxOrd);
+            uint32_t iy = curveOrdinate(y[i], minY, scaleY, maxOrd);
+            if(!std::isfinite(x[i]) || !std::isfinite(y[i])) {
+                ix = iy = 0;
+            }
+            codes[i] = curve == Curve::HILBERT
+                       ? HilbertCode::encode(level, ix, iy)
+                       : MortonCode::encode(static_cast<int>(ix), static_cast<int>(iy));
+        }
+    });
+    return codes;
+}
+
+std::vector<std::size_t>
+order(const double* x, const double* y, std::size_t n, Curve curve, const geom::Envelope* extent,
+      util::Executor* executor, std::size_t maxThreads)
+{
+    geom::Envelope pointsExtent;
+    if(extent == nullptr) {
+        for(std::size_t i = 0; i < n; i++) {
+            if(std::isfinite(x[i]) && std::isfinite(y[i])) {
+                pointsExtent.expandToInclude(x[i], y[i]);
+            }
+        }
+        extent = &pointsExtent;
+    }
+    std::vector<uint32_t> codes = encode(x, y, n, curve, *extent, executor, maxThreads);
+    return sortOrder(codes, executor, maxThreads);
+}
+
+std::vector<std::size_t>
+order(const std::vector<const geom::Envelope*>& envs, Curve curve, const geom::Envelope* extent,
+      util::Executor* executor, std::size_t maxThreads)
+{
+    // null envelopes are placed first, and the others ordered by their centres
+    std::vector<std::size_t> ord;
+    std::vector<std::size_t> nonNull;
+    for(std::size_t i = 0; i < envs.size(); i++) {
+        if(envs[i]->isNull()) {
+            ord.push_back(i);
+        }
+        else {
+            nonNull.push_back(i);
+        }
+    }
+
+    std::size_t n = nonNull.size();
+    std::vector<double> x(n);
+    std::vector<double> y(n);
+    forRanges(n, executor, maxThreads, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; i++) {
+            const geom::Envelope* env = envs[nonNull[i]];
+            x[i] = env->getMinX() + env->getWidth() / 2;
+            y[i] = env->getMinY() + env->getHeight() / 2;
+        }
+    });
+
+    for(std::size_t i : order(x.data(), y.data(), n, curve, extent, executor, maxThreads)) {
+        ord.push_back(nonNull[i]);
+    }
+    return ord;
+}
+
+void
+sort(geom::CoordinateSequence& seq, Curve curve, const geom::Envelope* extent,
+     util::Executor* executor, std::size_t maxThreads)
+{
+    std::vector<geom::Coordinate> coords;
+    seq.toVector(coords);
+
+    std::size_t n = coords.size();
+    std::vector<double> x(n);
+    std::vector<double> y(n);
+    for(std::size_t i = 0; i < n; i++) {
+        x[i] = coords[i].x;
+        y[i] = coords[i].y;
+    }
+
+    std::vector<std::size_t> ord = order(x.data(), y.data(), n, curve, extent, executor, maxThreads);
+    for(std::size_t i = 0; i < n; i++) {
+        seq.setAt(coords[ord[i]], i);
+    }
+}
+
+
+} // namespace geos.shape.fractal
+} // namespace geos.shape
+} // namespace geos
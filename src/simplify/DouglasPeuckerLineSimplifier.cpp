@@ -18,8 +18,11 @@
 
 #include <geos/simplify/DouglasPeuckerLineSimplifier.h>
 #include <geos/geom/Coordinate.h>
-#include <geos/geom/LineSegment.h>
+#include <geos/util/Executor.h>
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
 #include <vector>
 #include <memory> // for unique_ptr
 
@@ -28,6 +31,8 @@ namespace geos {
 /// Line simplification algorithms
 namespace simplify { // geos::simplify
 
+constexpr std::size_t DouglasPeuckerLineSimplifier::SCAN_BLOCK_SIZE;
+
 /*public static*/
 DouglasPeuckerLineSimplifier::CoordsVectAutoPtr
 DouglasPeuckerLineSimplifier::simplify(
@@ -67,7 +72,31 @@ DouglasPeuckerLineSimplifier::simplify()
     }
 
     usePt = BoolVectAutoPtr(new BoolVect(pts.size(), true));
-    simplifySection(0, pts.size() - 1);
+
+    // Sections are processed from an explicit stack rather than
+    // by recursion, which can be very deep for long lines
+    std::vector<std::pair<std::size_t, std::size_t>> sections;
+    sections.emplace_back(0, pts.size() - 1);
+    while(! sections.empty()) {
+        std::size_t i = sections.back().first;
+        std::size_t j = sections.back().second;
+        sections.pop_back();
+        if((i + 1) >= j) {
+            continue;
+        }
+
+        double maxDistance;
+        std::size_t maxIndex = findFurthestPoint(pts.data(), i, j, maxDistance);
+        if(maxDistance <= distanceTolerance) {
+            for(std::size_t k = i + 1; k < j; k++) {
+                usePt->operator[](k) = false;
+            }
+        }
+        else {
+            sections.emplace_back(maxIndex, j);
+            sections.emplace_back(i, maxIndex);
+        }
+    }
 
     for(std::size_t i = 0, n = pts.size(); i < n; ++i) {
         if(usePt->operator[](i)) {
@@ -80,37 +109,83 @@ DouglasPeuckerLineSimplifier::simplify()
     return coordList;
 }
 
-/*private*/
-void
-DouglasPeuckerLineSimplifier::simplifySection(
-    std::size_t i,
-    std::size_t j)
+/*public static*/
+std::vector<DouglasPeuckerLineSimplifier::CoordsVectAutoPtr>
+DouglasPeuckerLineSimplifier::simplify(
+    const std::vector<const CoordsVect*>& lines,
+    double distanceTolerance,
+    util::Executor* executor)
 {
-    if((i + 1) == j) {
-        return;
-    }
+    std::vector<CoordsVectAutoPtr> results(lines.size());
+    auto simplifyRange = [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; i++) {
+            results[i] = simplify(*lines[i], distanceTolerance);
+        }
+    };
 
-    geos::geom::LineSegment seg(pts[i], pts[j]);
-    double maxDistance = -1.0;
+    if(executor == nullptr) {
+        simplifyRange(0, lines.size());
+    }
+    else {
+        executor->parallelFor(lines.size(), 1, simplifyRange);
+    }
+    return results;
+}
 
+/*public static*/
+std::size_t
+DouglasPeuckerLineSimplifier::findFurthestPoint(
+    const geom::Coordinate* pts,
+    std::size_t i, std::size_t j,
+    double& maxDistance)
+{
+    const geom::Coordinate& A = pts[i];
+    const geom::Coordinate& B = pts[j];
+    const double ax = A.x;
+    const double ay = A.y;
+    const double bx = B.x;
+    const double by = B.y;
+    const double dx = bx - ax;
+    const double dy = by - ay;
+    const double len2 = dx * dx + dy * dy;
+    const double len = std::sqrt(len2);
+    const bool isPoint = (A == B);
+
+    double maxDist = -1.0;
     std::size_t maxIndex = i;
-
-    for(std::size_t k = i + 1; k < j; k++) {
-        double distance = seg.distance(pts[k]);
-        if(distance > maxDistance) {
-            maxDistance = distance;
-            maxIndex = k;
+    double dist[SCAN_BLOCK_SIZE];
+
+    for(std::size_t start = i + 1; start < j; start += SCAN_BLOCK_SIZE) {
+        std::size_t n = std::min(SCAN_BLOCK_SIZE, j - start);
+        const geom::Coordinate* p = pts + start;
+
+        // Same expressions as Distance::pointToSegment,
+        // with the branches replaced by selections
+        for(std::size_t k = 0; k < n; k++) {
+            const double px = p[k].x;
+            const double py = p[k].y;
+            const double pax = px - ax;
+            const double pay = py - ay;
+            const double pbx = px - bx;
+            const double pby = py - by;
+            const double r = (pax * dx + pay * dy) / len2;
+            const double s = ((ay - py) * dx - (ax - px) * dy) / len2;
+            const bool isEndA = isPoint || r <= 0.0;
+            const bool isEnd = isEndA || r >= 1.0;
+            const double endDist2 = isEndA ? (pax * pax + pay * pay) : (pbx * pbx + pby * pby);
+            dist[k] = isEnd ? std::sqrt(endDist2) : std::fabs(s) * len;
         }
-    }
-    if(maxDistance <= distanceTolerance) {
-        for(std::size_t k = i + 1; k < j; k++) {
-            usePt->operator[](k) = false;
+
+        for(std::size_t k = 0; k < n; k++) {
+            if(dist[k] > maxDist) {
+                maxDist = dist[k];
+                maxIndex = start + k;
+            }
         }
     }
-    else {
-        simplifySection(i, maxIndex);
-        simplifySection(maxIndex, j);
-    }
+
+    maxDistance = maxDist;
+    return maxIndex;
 }
 
 } // namespace geos::simplify
@@ -19,96 +19,31 @@
 #include <geos/simplify/LineSegmentIndex.h>
 #include <geos/simplify/TaggedLineSegment.h>
 #include <geos/simplify/TaggedLineString.h>
-#include <geos/index/quadtree/Quadtree.h>
-#include <geos/index/ItemVisitor.h>
 #include <geos/geom/LineSegment.h>
 #include <geos/geom/Envelope.h>
 
+#include <algorithm>
 #include <vector>
 #include <memory> // for unique_ptr
-#include <cassert>
-
-#ifndef GEOS_DEBUG
-#define GEOS_DEBUG 0
-#endif
-
-#ifdef GEOS_DEBUG
-#include <iostream>
-#endif
 
 
 using namespace geos::geom;
-using namespace geos::index::quadtree;
 
 namespace geos {
 namespace simplify { // geos::simplify
 
-/**
- * ItemVisitor subclass to reduce volume of query results.
- */
-class LineSegmentVisitor: public index::ItemVisitor {
-
-// MD - only seems to make about a 10% difference in overall time.
-
-private:
-
-    const LineSegment* querySeg;
-
-    std::unique_ptr< std::vector<LineSegment*> > items;
-
-public:
-
-    LineSegmentVisitor(const LineSegment* s)
-        :
-        ItemVisitor(),
-        querySeg(s),
-        items(new std::vector<LineSegment*>())
-    {}
-
-    ~LineSegmentVisitor() override
-    {
-        // nothing to do, LineSegments are not owned by us
-    }
-
-    LineSegmentVisitor(const LineSegmentVisitor& o)
-        :
-        ItemVisitor(),
-        querySeg(o.querySeg),
-        items(new std::vector<LineSegment*>(*(o.items.get())))
-    {
-    }
-
-    LineSegmentVisitor&
-    operator=(const LineSegmentVisitor& o)
-    {
-        if(this == &o) {
-            return *this;
-        }
-        querySeg = o.querySeg;
-        items.reset(new std::vector<LineSegment*>(*(o.items.get())));
-        return *this;
-    }
+constexpr std::size_t LineSegmentIndex::BUFFER_SIZE;
 
-    void
-    visitItem(void* item) override
-    {
-        LineSegment* seg = (LineSegment*) item;
-        if(Envelope::intersects(seg->p0, seg->p1,
-                                querySeg->p0, querySeg->p1)) {
-            items->push_back(seg);
-        }
-    }
-
-    std::unique_ptr< std::vector<LineSegment*> >
-    getItems()
-    {
-        // NOTE: Apparently, this is 'source' method giving up the object resource.
-        return std::move(items);
-    }
-
-
-};
+/*public*/
+LineSegmentIndex::LineSegmentIndex()
+    :
+    staticIndex(10),
+    numStatic(0),
+    isStaticBuilt(false)
+{
+}
 
+LineSegmentIndex::~LineSegmentIndex() = default;
 
 /*public*/
 void
@@ -123,13 +58,48 @@ LineSegmentIndex::add(const TaggedLineString& line)
 void
 LineSegmentIndex::add(const LineSegment* seg)
 {
-    std::unique_ptr<Envelope> env{new Envelope(seg->p0, seg->p1)};
+    if(isStaticBuilt) {
+        addDynamic(seg);
+        return;
+    }
+    staticIndex.insert(Envelope(seg->p0, seg->p1), seg);
+    numStatic++;
+}
 
-    // We need a cast because index wants a non-const,
-    // although it won't change the argument
-    index.insert(env.get(), const_cast<LineSegment*>(seg));
+/*private*/
+void
+LineSegmentIndex::addDynamic(const LineSegment* seg)
+{
+    buffer.push_back(seg);
+    if(buffer.size() < BUFFER_SIZE) {
+        return;
+    }
+
+    // Carry the full buffer up the levels, like a binary counter
+    std::vector<const LineSegment*> carry;
+    carry.swap(buffer);
+    for(auto& level : levels) {
+        if(! level) {
+            level = buildTree(carry);
+            return;
+        }
+        // removed segments are not carried into the merged tree
+        carry.insert(carry.end(), level->items().begin(), level->items().end());
+        level.reset();
+    }
+    levels.push_back(buildTree(carry));
+}
 
-    newEnvelopes.push_back(std::move(env));
+/*private static*/
+std::unique_ptr<LineSegmentIndex::SegmentTree>
+LineSegmentIndex::buildTree(const std::vector<const LineSegment*>& segs)
+{
+    std::unique_ptr<SegmentTree> tree(new SegmentTree(10, segs.size()));
+    for(const LineSegment* seg : segs) {
+        tree->insert(Envelope(seg->p0, seg->p1), seg);
+    }
+    tree->build();
+    return tree;
 }
 
 /*public*/
@@ -138,21 +108,38 @@ LineSegmentIndex::remove(const LineSegment* seg)
 {
     Envelope env(seg->p0, seg->p1);
 
-    // We need a cast because index wants a non-const
-    // although it won't change the argument
-    index.remove(&env, const_cast<LineSegment*>(seg));
+    isStaticBuilt = true;
+    if(numStatic > 0) {
+        staticIndex.build();
+        if(staticIndex.remove(env, seg)) {
+            return;
+        }
+    }
+
+    for(auto& level : levels) {
+        if(level && level->remove(env, seg)) {
+            return;
+        }
+    }
+
+    auto it = std::find(buffer.begin(), buffer.end(), seg);
+    if(it != buffer.end()) {
+        buffer.erase(it);
+    }
 }
 
 /*public*/
 std::unique_ptr< std::vector<LineSegment*> >
 LineSegmentIndex::query(const LineSegment* querySeg)
 {
-    Envelope env(querySeg->p0, querySeg->p1);
-
-    LineSegmentVisitor visitor(querySeg);
-    index.query(&env, visitor);
-
-    std::unique_ptr< std::vector<LineSegment*> > itemsFound = visitor.getItems();
+    std::unique_ptr< std::vector<LineSegment*> > itemsFound(new std::vector<LineSegment*>());
+
+    query(*querySeg, [&itemsFound](const LineSegment* seg) {
+        // The index does not change the segments, but
+        // the result type is non-const for compatibility
+        itemsFound->push_back(const_cast<LineSegment*>(seg));
+        return true;
+    });
 
     return itemsFound;
 }
@@ -18,6 +18,7 @@
 
 #include <geos/simplify/TaggedLineStringSimplifier.h>
 #include <geos/simplify/LineSegmentIndex.h>
+#include <geos/simplify/DouglasPeuckerLineSimplifier.h>
 #include <geos/algorithm/LineIntersector.h>
 #include <geos/simplify/TaggedLineString.h>
 #include <geos/simplify/TaggedLineSegment.h>
@@ -81,8 +82,20 @@ TaggedLineStringSimplifier::simplify(TaggedLineString* nLine)
     if(linePts->isEmpty()) {
         return;
     }
-    simplifySection(0, linePts->size() - 1, 0);
-
+    linePts->toVector(linePtsVect);
+
+    // Sections are processed from an explicit stack rather than
+    // by recursion, which can be very deep for long lines.
+    // The first half of a split section is processed first,
+    // so that result segments are added in order.
+    sections.clear();
+    sections.push_back({0, linePts->size() - 1, 0});
+    while(! sections.empty()) {
+        Section section = sections.back();
+        sections.pop_back();
+        simplifySection(section.i, section.j, section.depth);
+    }
+    linePtsVect.clear();
 }
 
 
@@ -133,7 +146,8 @@ TaggedLineStringSimplifier::simplifySection(std::size_t i,
     double distance;
 
     // pass distance by ref
-    std::size_t furthestPtIndex = findFurthestPoint(linePts, i, j, distance);
+    std::size_t furthestPtIndex = DouglasPeuckerLineSimplifier::findFurthestPoint(
+                                      linePtsVect.data(), i, j, distance);
 
 #if GEOS_DEBUG
     std::cerr << "furthest point " << furthestPtIndex
@@ -168,9 +182,8 @@ TaggedLineStringSimplifier::simplifySection(std::size_t i,
         return;
     }
 
-    simplifySection(i, furthestPtIndex, depth);
-    simplifySection(furthestPtIndex, j, depth);
-
+    sections.push_back({furthestPtIndex, j, depth});
+    sections.push_back({i, furthestPtIndex, depth});
 }
 
 
@@ -211,16 +224,10 @@ bool
 TaggedLineStringSimplifier::hasBadOutputIntersection(
     const LineSegment& candidateSeg)
 {
-    std::unique_ptr< std::vector<LineSegment*> > querySegs =
-        outputIndex->query(&candidateSeg);
-
-    for(const LineSegment* querySeg : *querySegs) {
-        if(hasInteriorIntersection(*querySeg, candidateSeg)) {
-            return true;
-        }
-    }
-
-    return false;
+    bool isClear = outputIndex->query(candidateSeg, [this, &candidateSeg](const LineSegment* querySeg) {
+        return !hasInteriorIntersection(*querySeg, candidateSeg);
+    });
+    return !isClear;
 }
 
 /*private*/
@@ -240,19 +247,13 @@ TaggedLineStringSimplifier::hasBadInputIntersection(
     const pair<std::size_t, std::size_t>& sectionIndex,
     const LineSegment& candidateSeg)
 {
-    std::unique_ptr< std::vector<LineSegment*> > querySegs =
-        inputIndex->query(&candidateSeg);
-
-    for(const LineSegment* ls : *querySegs) {
+    bool isClear = inputIndex->query(candidateSeg,
+            [this, parentLine, &sectionIndex, &candidateSeg](const LineSegment* ls) {
         const TaggedLineSegment* querySeg = static_cast<const TaggedLineSegment*>(ls);
-
-        if(!isInLineSection(parentLine, sectionIndex, querySeg) && hasInteriorIntersection(*querySeg, candidateSeg)) {
-
-            return true;
-        }
-    }
-
-    return false;
+        return isInLineSection(parentLine, sectionIndex, querySeg)
+               || !hasInteriorIntersection(*querySeg, candidateSeg);
+    });
+    return !isClear;
 }
 
 /*static private*/
@@ -290,41 +291,5 @@ TaggedLineStringSimplifier::remove(const TaggedLineString* p_line,
     }
 }
 
-/*private static*/
-std::size_t
-TaggedLineStringSimplifier::findFurthestPoint(
-    const geom::CoordinateSequence* pts,
-    std::size_t i, std::size_t j,
-    double& maxDistance)
-{
-    LineSegment seg(pts->getAt(i), pts->getAt(j));
-#if GEOS_DEBUG
-    std::cerr << __FUNCTION__ << "segment " << seg
-              << std::endl;
-#endif
-    double maxDist = -1.0;
-    std::size_t maxIndex = i;
-    for(std::size_t k = i + 1; k < j; k++) {
-        const Coordinate& midPt = pts->getAt(k);
-        double distance = seg.distance(midPt);
-#if GEOS_DEBUG
-        std::cerr << "dist to " << midPt
-                  << ": " << distance
-                  << std::endl;
-#endif
-        if(distance > maxDist) {
-#if GEOS_DEBUG
-            std::cerr << "this is max"
-                      << std::endl;
-#endif
-            maxDist = distance;
-            maxIndex = k;
-        }
-    }
-    maxDistance = maxDist;
-    return maxIndex;
-
-}
-
 } // namespace geos::simplify
 } // namespace geos
@@ -18,21 +18,17 @@
 
 #include <geos/simplify/TaggedLinesSimplifier.h>
 #include <geos/simplify/LineSegmentIndex.h>
+#include <geos/simplify/TaggedLineString.h>
 #include <geos/simplify/TaggedLineStringSimplifier.h>
-#include <geos/algorithm/LineIntersector.h>
+#include <geos/algorithm/LineIntersector.h> // for unique_ptr dtor
+#include <geos/index/strtree/EnvelopeClusterFinder.h>
+#include <geos/geom/LineString.h>
+#include <geos/util/Executor.h>
 
 #include <cassert>
 #include <algorithm>
 #include <memory>
 
-#ifndef GEOS_DEBUG
-#define GEOS_DEBUG 0
-#endif
-
-#ifdef GEOS_DEBUG
-#include <iostream>
-#endif
-
 using namespace geos::geom;
 
 
@@ -42,10 +38,8 @@ namespace simplify { // geos::simplify
 /*public*/
 TaggedLinesSimplifier::TaggedLinesSimplifier()
     :
-    inputIndex(new LineSegmentIndex()),
-    outputIndex(new LineSegmentIndex()),
-    taggedlineSimplifier(new TaggedLineStringSimplifier(inputIndex.get(),
-                         outputIndex.get()))
+    distanceTolerance(0.0),
+    executor(nullptr)
 {
 }
 
@@ -53,14 +47,80 @@ TaggedLinesSimplifier::TaggedLinesSimplifier()
 void
 TaggedLinesSimplifier::setDistanceTolerance(double d)
 {
-    taggedlineSimplifier->setDistanceTolerance(d);
+    distanceTolerance = d;
+}
+
+/*public*/
+void
+TaggedLinesSimplifier::setExecutor(util::Executor* p_executor)
+{
+    executor = p_executor;
+}
+
+/*public*/
+void
+TaggedLinesSimplifier::simplify(const std::vector<TaggedLineString*>& lines)
+{
+    if(lines.size() <= 1) {
+        simplifyCluster(lines);
+        return;
+    }
+
+    std::vector<std::vector<TaggedLineString*>> clusters = cluster(lines);
+    if(executor == nullptr) {
+        for(const auto& clusterLines : clusters) {
+            simplifyCluster(clusterLines);
+        }
+        return;
+    }
+
+    // The clusters share no state. The envelopes of the parent
+    // geometries were computed while clustering.
+    executor->parallelFor(clusters.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; i++) {
+            simplifyCluster(clusters[i]);
+        }
+    });
+}
+
+/*private static*/
+std::vector<std::vector<TaggedLineString*>>
+TaggedLinesSimplifier::cluster(const std::vector<TaggedLineString*>& lines)
+{
+    std::vector<const Envelope*> envelopes;
+    envelopes.reserve(lines.size());
+    for(const TaggedLineString* line : lines) {
+        envelopes.push_back(line->getParent()->getEnvelopeInternal());
+    }
+
+    std::vector<std::vector<TaggedLineString*>> clusters;
+    for(const auto& clusterItems : index::strtree::EnvelopeClusterFinder::cluster(envelopes)) {
+        clusters.emplace_back();
+        for(std::size_t i : clusterItems) {
+            clusters.back().push_back(lines[i]);
+        }
+    }
+    return clusters;
 }
 
 /*private*/
 void
-TaggedLinesSimplifier::simplify(TaggedLineString& tls)
+TaggedLinesSimplifier::simplifyCluster(const std::vector<TaggedLineString*>& lines) const
 {
-    taggedlineSimplifier->simplify(&tls);
+    LineSegmentIndex inputIndex;
+    LineSegmentIndex outputIndex;
+    TaggedLineStringSimplifier taggedlineSimplifier(&inputIndex, &outputIndex);
+    taggedlineSimplifier.setDistanceTolerance(distanceTolerance);
+
+    // add lines to the index
+    for(const TaggedLineString* line : lines) {
+        inputIndex.add(*line);
+    }
+
+    // Simplify lines
+    for(TaggedLineString* line : lines) {
+        taggedlineSimplifier.simplify(line);
+    }
 }
 
 } // namespace geos::simplify
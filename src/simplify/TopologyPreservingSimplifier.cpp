@@ -273,6 +273,13 @@ TopologyPreservingSimplifier::setDistanceTolerance(double d)
     lineSimplifier->setDistanceTolerance(d);
 }
 
+/*public*/
+void
+TopologyPreservingSimplifier::setExecutor(util::Executor* executor)
+{
+    lineSimplifier->setExecutor(executor);
+}
+
 
 /*public*/
 std::unique_ptr<geom::Geometry>
@@ -0,0 +1,288 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: simplify/VWLineSimplifier.java (JTS-1.18)
+ *
+ **********************************************************************
+ *
+ * NOTES: changed from JTS design, keeping the vertices in an
+ *        indexed min-heap instead of rescanning the line after
+ *        every removal.
+ *
+ **********************************************************************/
+
+#include <geos/simplify/VWLineSimplifier.h>
+#include <geos/simplify/LineSegmentIndex.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/LineSegment.h>
+
+#include <cmath>
+#include <utility>
+#include <vector>
+#include <memory> // for unique_ptr
+
+using namespace geos::geom;
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+constexpr std::size_t VWLineSimplifier::NONE;
+
+/*public static*/
+VWLineSimplifier::CoordsVectAutoPtr
+VWLineSimplifier::simplify(
+    const VWLineSimplifier::CoordsVect& nPts,
+    double distanceTolerance)
+{
+    VWLineSimplifier simp(nPts, distanceTolerance);
+    return simp.simplify();
+}
+
+/*public*/
+VWLineSimplifier::VWLineSimplifier(
+    const VWLineSimplifier::CoordsVect& nPts,
+    double distanceTolerance)
+    :
+    pts(nPts),
+    areaTolerance(distanceTolerance * distanceTolerance),
+    minimumSize(2),
+    segIndex(nullptr)
+{
+}
+
+VWLineSimplifier::~VWLineSimplifier() = default;
+
+/*public*/
+void
+VWLineSimplifier::setMinimumSize(std::size_t minSize)
+{
+    minimumSize = minSize;
+}
+
+/*public*/
+void
+VWLineSimplifier::setSegmentIndex(LineSegmentIndex* index)
+{
+    segIndex = index;
+    li.reset(new algorithm::LineIntersector());
+
+    nextSeg.assign(pts.size(), nullptr);
+    for(std::size_t i = 0; i + 1 < pts.size(); i++) {
+        segments.emplace_back(pts[i], pts[i + 1]);
+        nextSeg[i] = &segments.back();
+        segIndex->add(nextSeg[i]);
+    }
+}
+
+/*public*/
+VWLineSimplifier::CoordsVectAutoPtr
+VWLineSimplifier::simplify()
+{
+    CoordsVectAutoPtr coordList(new CoordsVect());
+
+    std::size_t n = pts.size();
+    if(n == 0) {
+        return coordList;
+    }
+
+    prev.resize(n);
+    next.resize(n);
+    area.assign(n, 0.0);
+    heapPos.assign(n, NONE);
+    heap.clear();
+    heap.reserve(n);
+    for(std::size_t i = 0; i < n; i++) {
+        prev[i] = i == 0 ? NONE : i - 1;
+        next[i] = i == n - 1 ? NONE : i + 1;
+    }
+    // the endpoints are never removed, so are not in the heap
+    for(std::size_t i = 1; i + 1 < n; i++) {
+        area[i] = triangleArea(i);
+        heapInsert(i);
+    }
+
+    std::size_t numVertices = n;
+    while(! heap.empty() && numVertices > minimumSize) {
+        std::size_t i = heap.front();
+        if(area[i] >= areaTolerance) {
+            break;
+        }
+        heapRemove(i);
+        // a blocked vertex is reconsidered if a neighbour is removed
+        if(! isRemovable(i)) {
+            continue;
+        }
+        removeVertex(i);
+        numVertices--;
+    }
+
+    coordList->reserve(numVertices);
+    for(std::size_t i = 0; i != NONE; i = next[i]) {
+        coordList->push_back(pts[i]);
+    }
+    return coordList;
+}
+
+/*private*/
+double
+VWLineSimplifier::triangleArea(std::size_t i) const
+{
+    const Coordinate& a = pts[prev[i]];
+    const Coordinate& b = pts[i];
+    const Coordinate& c = pts[next[i]];
+    return std::fabs((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) / 2.0;
+}
+
+/*private*/
+void
+VWLineSimplifier::updateArea(std::size_t i)
+{
+    if(prev[i] == NONE || next[i] == NONE) {
+        return;
+    }
+    area[i] = triangleArea(i);
+    if(heapPos[i] == NONE) {
+        heapInsert(i);
+        return;
+    }
+    heapUp(heapPos[i]);
+    heapDown(heapPos[i]);
+}
+
+/*private*/
+bool
+VWLineSimplifier::isRemovable(std::size_t i)
+{
+    if(segIndex == nullptr) {
+        return true;
+    }
+
+    const LineSegment* seg0 = nextSeg[prev[i]];
+    const LineSegment* seg1 = nextSeg[i];
+    LineSegment candidateSeg(pts[prev[i]], pts[next[i]]);
+    return segIndex->query(candidateSeg, [&](const LineSegment* seg) {
+        if(seg == seg0 || seg == seg1) {
+            return true;
+        }
+        li->computeIntersection(seg->p0, seg->p1, candidateSeg.p0, candidateSeg.p1);
+        return ! li->isInteriorIntersection();
+    });
+}
+
+/*private*/
+void
+VWLineSimplifier::removeVertex(std::size_t i)
+{
+    std::size_t p = prev[i];
+    std::size_t q = next[i];
+    next[p] = q;
+    prev[q] = p;
+
+    if(segIndex != nullptr) {
+        segIndex->remove(nextSeg[p]);
+        segIndex->remove(nextSeg[i]);
+        segments.emplace_back(pts[p], pts[q]);
+        nextSeg[p] = &segments.back();
+        nextSeg[i] = nullptr;
+        segIndex->add(nextSeg[p]);
+    }
+
+    updateArea(p);
+    updateArea(q);
+}
+
+/*private*/
+bool
+VWLineSimplifier::isHeapLess(std::size_t a, std::size_t b) const
+{
+    if(area[a] != area[b]) {
+        return area[a] < area[b];
+    }
+    return a < b;
+}
+
+/*private*/
+void
+VWLineSimplifier::heapSwap(std::size_t a, std::size_t b)
+{
+    std::swap(heap[a], heap[b]);
+    heapPos[heap[a]] = a;
+    heapPos[heap[b]] = b;
+}
+
+/*private*/
+void
+VWLineSimplifier::heapUp(std::size_t pos)
+{
+    while(pos > 0) {
+        std::size_t parent = (pos - 1) / 2;
+        if(! isHeapLess(heap[pos], heap[parent])) {
+            return;
+        }
+        heapSwap(pos, parent);
+        pos = parent;
+    }
+}
+
+/*private*/
+void
+VWLineSimplifier::heapDown(std::size_t pos)
+{
+    std::size_t size = heap.size();
+    for(;;) {
+        std::size_t least = pos;
+        std::size_t left = 2 * pos + 1;
+        std::size_t right = left + 1;
+        if(left < size && isHeapLess(heap[left], heap[least])) {
+            least = left;
+        }
+        if(right < size && isHeapLess(heap[right], heap[least])) {
+            least = right;
+        }
+        if(least == pos) {
+            return;
+        }
+        heapSwap(pos, least);
+        pos = least;
+    }
+}
+
+/*private*/
+void
+VWLineSimplifier::heapInsert(std::size_t i)
+{
+    heapPos[i] = heap.size();
+    heap.push_back(i);
+    heapUp(heapPos[i]);
+}
+
+/*private*/
+void
+VWLineSimplifier::heapRemove(std::size_t i)
+{
+    std::size_t pos = heapPos[i];
+    std::size_t last = heap.size() - 1;
+    if(pos != last) {
+        heapSwap(pos, last);
+    }
+    heap.pop_back();
+    heapPos[i] = NONE;
+    if(pos < heap.size()) {
+        std::size_t moved = heap[pos];
+        heapUp(pos);
+        heapDown(heapPos[moved]);
+    }
+}
+
+} // namespace geos::simplify
+} // namespace geos
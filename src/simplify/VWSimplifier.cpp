@@ -0,0 +1,258 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: simplify/VWSimplifier.java (JTS-1.18)
+ *
+ **********************************************************************
+ *
+ * NOTES: setPreserveTopology is not in JTS.
+ *
+ **********************************************************************/
+
+#include <geos/simplify/VWSimplifier.h>
+#include <geos/simplify/VWLineSimplifier.h>
+#include <geos/simplify/LineSegmentIndex.h>
+#include <geos/geom/Geometry.h> // for Ptr typedefs
+#include <geos/geom/LineString.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/CoordinateSequence.h> // for Ptr typedefs
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/util/GeometryTransformer.h> // for VWTransformer inheritance
+#include <geos/geom/util/LinearComponentExtracter.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <memory> // for unique_ptr
+#include <unordered_map>
+#include <cassert>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+namespace { // module-statics
+
+using LinesMap = std::unordered_map<const Geometry*, VWLineSimplifier::CoordsVectAutoPtr>;
+
+class VWTransformer: public geom::util::GeometryTransformer {
+
+public:
+
+    /**
+     * @param tolerance the distance tolerance
+     * @param isEnsureValid whether polygonal results are made valid
+     * @param simplifiedLines the simplified coordinates of each linear
+     *        component, if they have been computed already (or null)
+     */
+    VWTransformer(double tolerance, bool isEnsureValid, const LinesMap* simplifiedLines);
+
+protected:
+
+    CoordinateSequence::Ptr transformCoordinates(
+        const CoordinateSequence* coords,
+        const Geometry* parent) override;
+
+    Geometry::Ptr transformLinearRing(
+        const LinearRing* geom,
+        const Geometry* parent) override;
+
+    Geometry::Ptr transformPolygon(
+        const Polygon* geom,
+        const Geometry* parent) override;
+
+    Geometry::Ptr transformMultiPolygon(
+        const MultiPolygon* geom,
+        const Geometry* parent) override;
+
+private:
+
+    /*
+     * Creates a valid area geometry from one that possibly has
+     * bad topology (i.e. self-intersections), using a 0-width buffer.
+     */
+    Geometry::Ptr createValidArea(const Geometry* roughAreaGeom);
+
+    double distanceTolerance;
+
+    bool isEnsureValidTopology;
+
+    const LinesMap* linestringMap;
+
+};
+
+VWTransformer::VWTransformer(double t, bool isEnsureValid, const LinesMap* simplifiedLines)
+    :
+    distanceTolerance(t),
+    isEnsureValidTopology(isEnsureValid),
+    linestringMap(simplifiedLines)
+{
+    setSkipTransformedInvalidInteriorRings(true);
+}
+
+Geometry::Ptr
+VWTransformer::createValidArea(const Geometry* roughAreaGeom)
+{
+    bool isValidArea = roughAreaGeom->getDimension() == 2 && roughAreaGeom->isValid();
+    if (! isValidArea)
+        return Geometry::Ptr(roughAreaGeom->buffer(0.0));
+    return Geometry::Ptr(roughAreaGeom->clone());
+}
+
+CoordinateSequence::Ptr
+VWTransformer::transformCoordinates(
+    const CoordinateSequence* coords,
+    const Geometry* parent)
+{
+    std::unique_ptr<Coordinate::Vect> newPts;
+
+    if(linestringMap != nullptr && dynamic_cast<const LineString*>(parent)) {
+        LinesMap::const_iterator it = linestringMap->find(parent);
+        assert(it != linestringMap->end());
+        newPts.reset(new Coordinate::Vect(*it->second));
+    }
+    else {
+        Coordinate::Vect inputPts;
+        coords->toVector(inputPts);
+        newPts = VWLineSimplifier::simplify(inputPts, distanceTolerance);
+    }
+
+    return CoordinateSequence::Ptr(
+               factory->getCoordinateSequenceFactory()->create(
+                   newPts.release()
+               ));
+}
+
+Geometry::Ptr
+VWTransformer::transformLinearRing(
+    const LinearRing* geom,
+    const Geometry* parent)
+{
+    bool removeDegenerateRings = dynamic_cast<const Polygon*>(parent);
+    Geometry::Ptr simpResult(GeometryTransformer::transformLinearRing(geom, parent));
+    if (removeDegenerateRings && ! dynamic_cast<const LinearRing*>(simpResult.get()))
+        return nullptr;
+    return simpResult;
+}
+
+Geometry::Ptr
+VWTransformer::transformPolygon(
+    const Polygon* geom,
+    const Geometry* parent)
+{
+    Geometry::Ptr roughGeom(GeometryTransformer::transformPolygon(geom, parent));
+
+    // don't try and correct if the parent is going to do this
+    if(! isEnsureValidTopology || dynamic_cast<const MultiPolygon*>(parent)) {
+        return roughGeom;
+    }
+
+    return createValidArea(roughGeom.get());
+}
+
+Geometry::Ptr
+VWTransformer::transformMultiPolygon(
+    const MultiPolygon* geom,
+    const Geometry* parent)
+{
+    Geometry::Ptr roughGeom(GeometryTransformer::transformMultiPolygon(geom, parent));
+    if(! isEnsureValidTopology) {
+        return roughGeom;
+    }
+    return createValidArea(roughGeom.get());
+}
+
+} // end of module-statics
+
+/************************************************************************/
+
+/*public static*/
+Geometry::Ptr
+VWSimplifier::simplify(const Geometry* geom,
+                       double tolerance)
+{
+    VWSimplifier simp(geom);
+    simp.setDistanceTolerance(tolerance);
+    return simp.getResultGeometry();
+}
+
+/*public*/
+VWSimplifier::VWSimplifier(const Geometry* geom)
+    :
+    inputGeom(geom),
+    distanceTolerance(0.0),
+    isEnsureValidTopology(true),
+    isPreserveTopology(false)
+{
+}
+
+/*public*/
+void
+VWSimplifier::setDistanceTolerance(double tol)
+{
+    if(tol < 0.0) {
+        throw util::IllegalArgumentException("Tolerance must be non-negative");
+    }
+    distanceTolerance = tol;
+}
+
+/*public*/
+void
+VWSimplifier::setEnsureValid(bool isEnsureValid)
+{
+    isEnsureValidTopology = isEnsureValid;
+}
+
+/*public*/
+void
+VWSimplifier::setPreserveTopology(bool isPreserve)
+{
+    isPreserveTopology = isPreserve;
+}
+
+/*public*/
+Geometry::Ptr
+VWSimplifier::getResultGeometry()
+{
+    if(! isPreserveTopology) {
+        VWTransformer t(distanceTolerance, isEnsureValidTopology, nullptr);
+        return t.transform(inputGeom);
+    }
+
+    std::vector<const LineString*> lines;
+    geom::util::LinearComponentExtracter::getLines(*inputGeom, lines);
+
+    // All lines are indexed before any is simplified,
+    // so that each is checked against the current state of the others
+    LineSegmentIndex segIndex;
+    std::vector<Coordinate::Vect> linePts(lines.size());
+    std::vector<std::unique_ptr<VWLineSimplifier>> lineSimplifiers;
+    lineSimplifiers.reserve(lines.size());
+    for(std::size_t i = 0; i < lines.size(); i++) {
+        lines[i]->getCoordinatesRO()->toVector(linePts[i]);
+        lineSimplifiers.emplace_back(new VWLineSimplifier(linePts[i], distanceTolerance));
+        lineSimplifiers.back()->setMinimumSize(lines[i]->isClosed() ? 4 : 2);
+        lineSimplifiers.back()->setSegmentIndex(&segIndex);
+    }
+
+    LinesMap simplifiedLines;
+    for(std::size_t i = 0; i < lines.size(); i++) {
+        simplifiedLines[lines[i]] = lineSimplifiers[i]->simplify();
+    }
+
+    VWTransformer t(distanceTolerance, false, &simplifiedLines);
+    return t.transform(inputGeom);
+}
+
+} // namespace geos::simplify
+} // namespace geos
@@ -0,0 +1,534 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/BulkDelaunayTriangulator.h>
+
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/Triangle.h>
+#include <geos/shape/fractal/HilbertEncoder.h>
+#include <geos/triangulate/quadedge/LocateFailureException.h>
+#include <geos/triangulate/quadedge/TrianglePredicate.h>
+#include <geos/util/Interrupt.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+
+using geos::algorithm::Orientation;
+using geos::triangulate::quadedge::LocateFailureException;
+using geos::geom::TrianglePredicate;
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+using namespace geos::geom;
+
+constexpr std::size_t BulkDelaunayTriangulator::NONE;
+constexpr std::size_t BulkDelaunayTriangulator::DEFAULT_MIN_SITES;
+constexpr std::size_t BulkDelaunayTriangulator::NUM_FRAME_VERTICES;
+constexpr uint32_t BulkDelaunayTriangulator::HILBERT_LEVEL;
+
+BulkDelaunayTriangulator::BulkDelaunayTriangulator(const CoordinateSequence& sites, double p_tolerance)
+    : tolerance(p_tolerance)
+    , lastTriangle(0)
+    , isTriangulated(false)
+{
+    vertices.reserve(sites.size() + NUM_FRAME_VERTICES);
+    vertices.resize(NUM_FRAME_VERTICES);
+    for (std::size_t i = 0; i < sites.size(); i++) {
+        vertices.push_back(sites.getAt(i));
+    }
+}
+
+/*private*/
+void
+BulkDelaunayTriangulator::createFrame(const Envelope& env)
+{
+    // same frame as QuadEdgeSubdivision, so the triangulations match
+    double deltaX = env.getWidth();
+    double deltaY = env.getHeight();
+    double offset = 0.0;
+    if(deltaX > deltaY) {
+        offset = deltaX * 10.0;
+    }
+    else {
+        offset = deltaY * 10.0;
+    }
+
+    vertices[0] = Coordinate((env.getMaxX() + env.getMinX()) / 2.0, env.getMaxY() + offset);
+    vertices[1] = Coordinate(env.getMinX() - offset, env.getMinY() - offset);
+    vertices[2] = Coordinate(env.getMaxX() + offset, env.getMinY() - offset);
+
+    std::size_t t = addTriangle();
+    setTriangle(t, 0, 1, 2);
+}
+
+/*private*/
+std::vector<std::size_t>
+BulkDelaunayTriangulator::insertionOrder(const Envelope& env) const
+{
+    // the encoder requires a non-degenerate extent
+    Envelope hilbertEnv(env);
+    hilbertEnv.expandBy(env.getWidth() > 0 ? 0 : 1, env.getHeight() > 0 ? 0 : 1);
+    shape::fractal::HilbertEncoder encoder(HILBERT_LEVEL, hilbertEnv);
+
+    /**
+    * Assign each site to a BRIO round: a site is in round k
+    * with probability 1/2^(k+1), and rounds are inserted from
+    * the highest (smallest, most random) to round 0.
+    * A fixed seed keeps the triangulation deterministic.
+    */
+    static constexpr uint64_t MAX_ROUND = 31;
+    std::minstd_rand rng(1);
+    std::vector<std::pair<uint64_t, std::size_t>> keys;
+    keys.reserve(vertices.size() - NUM_FRAME_VERTICES);
+    for (std::size_t i = NUM_FRAME_VERTICES; i < vertices.size(); i++) {
+        uint64_t round = 0;
+        while (round < MAX_ROUND && (rng() & 1)) {
+            round++;
+        }
+        Envelope siteEnv(vertices[i], vertices[i]);
+        uint64_t code = encoder.encode(&siteEnv);
+        keys.emplace_back(((MAX_ROUND - round) << 32) | code, i);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<std::size_t> order;
+    order.reserve(keys.size());
+    for (const auto& key : keys) {
+        order.push_back(key.second);
+    }
+    return order;
+}
+
+/*public*/
+void
+BulkDelaunayTriangulator::triangulate()
+{
+    if (isTriangulated) {
+        return;
+    }
+    isTriangulated = true;
+
+    if (vertices.size() == NUM_FRAME_VERTICES) {
+        return;
+    }
+
+    Envelope env;
+    for (std::size_t i = NUM_FRAME_VERTICES; i < vertices.size(); i++) {
+        env.expandToInclude(vertices[i]);
+    }
+
+    // a triangulation of n sites has fewer than 2n + 1 triangles
+    std::size_t maxTriangles = 2 * vertices.size() + 1;
+    triangles.reserve(3 * maxTriangles);
+    halfedges.reserve(3 * maxTriangles);
+    vertexEdge.assign(vertices.size(), NONE);
+
+    if (frameEnv.isNull()) {
+        frameEnv = env;
+    }
+    createFrame(frameEnv);
+
+    std::vector<std::size_t> order = insertionOrder(env);
+    for (std::size_t i = 0; i < order.size(); i++) {
+        insertSite(order[i]);
+        if (i % 1024 == 0) {
+            GEOS_CHECK_FOR_INTERRUPTS();
+        }
+    }
+}
+
+/*private*/
+void
+BulkDelaunayTriangulator::insertSite(std::size_t v)
+{
+    std::size_t onEdge;
+    std::size_t atVertex;
+    std::size_t t = locate(vertices[v], onEdge, atVertex);
+
+    // site is already in the triangulation (within tolerance)
+    if (atVertex != NONE) {
+        return;
+    }
+
+    if (onEdge != NONE) {
+        splitEdge(onEdge, v);
+    }
+    else {
+        splitTriangle(t, v);
+    }
+    legalize();
+}
+
+/*private*/
+std::size_t
+BulkDelaunayTriangulator::locate(const Coordinate& p, std::size_t& onEdge, std::size_t& atVertex)
+{
+    onEdge = NONE;
+    atVertex = NONE;
+
+    /**
+    * Visibility walk: move to the neighbour across any edge which
+    * has the point strictly on its right.
+    * This terminates for a Delaunay triangulation.
+    */
+    std::size_t t = lastTriangle;
+    std::size_t maxSteps = triangles.size() + 1;
+    std::size_t steps = 0;
+    for (;;) {
+        if (++steps > maxSteps) {
+            throw LocateFailureException("Could not locate vertex.");
+        }
+        bool isMoved = false;
+        for (std::size_t k = 0; k < 3; k++) {
+            // vary the start edge, to avoid favouring one direction
+            std::size_t e = 3 * t + (k + steps) % 3;
+            const Coordinate& a = vertices[triangles[e]];
+            const Coordinate& b = vertices[triangles[nextHalfEdge(e)]];
+            if (Orientation::index(a, b, p) == Orientation::CLOCKWISE) {
+                std::size_t twin = halfedges[e];
+                if (twin == NONE) {
+                    throw LocateFailureException("Vertex is outside the triangulation frame.");
+                }
+                t = twin / 3;
+                isMoved = true;
+                break;
+            }
+        }
+        if (! isMoved) {
+            break;
+        }
+    }
+    lastTriangle = t;
+
+    for (std::size_t e = 3 * t; e < 3 * t + 3; e++) {
+        const Coordinate& a = vertices[triangles[e]];
+        if (a.equals2D(p) || (tolerance > 0.0 && a.distance(p) < tolerance)) {
+            atVertex = triangles[e];
+            return t;
+        }
+    }
+    for (std::size_t e = 3 * t; e < 3 * t + 3; e++) {
+        const Coordinate& a = vertices[triangles[e]];
+        const Coordinate& b = vertices[triangles[nextHalfEdge(e)]];
+        if (Orientation::index(a, b, p) == Orientation::COLLINEAR) {
+            onEdge = e;
+            break;
+        }
+    }
+    return t;
+}
+
+/*private*/
+std::size_t
+BulkDelaunayTriangulator::addTriangle()
+{
+    std::size_t t = triangles.size() / 3;
+    triangles.resize(triangles.size() + 3, NONE);
+    halfedges.resize(halfedges.size() + 3, NONE);
+    return t;
+}
+
+/*private*/
+void
+BulkDelaunayTriangulator::setTriangle(std::size_t t, std::size_t v0, std::size_t v1, std::size_t v2)
+{
+    std::size_t e = 3 * t;
+    triangles[e] = v0;
+    triangles[e + 1] = v1;
+    triangles[e + 2] = v2;
+    vertexEdge[v0] = e + 2;
+    vertexEdge[v1] = e;
+    vertexEdge[v2] = e + 1;
+}
+
+/*private*/
+void
+BulkDelaunayTriangulator::link(std::size_t e0, std::size_t e1)
+{
+    halfedges[e0] = e1;
+    if (e1 != NONE) {
+        halfedges[e1] = e0;
+    }
+}
+
+/*private*/
+void
+BulkDelaunayTriangulator::splitTriangle(std::size_t t, std::size_t v)
+{
+    std::size_t e = 3 * t;
+    std::size_t a = triangles[e];
+    std::size_t b = triangles[e + 1];
+    std::size_t c = triangles[e + 2];
+    std::size_t hab = halfedges[e];
+    std::size_t hbc = halfedges[e + 1];
+    std::size_t hca = halfedges[e + 2];
+
+    std::size_t t1 = addTriangle();
+    std::size_t t2 = addTriangle();
+    setTriangle(t, a, b, v);
+    setTriangle(t1, b, c, v);
+    setTriangle(t2, c, a, v);
+
+    link(3 * t, hab);
+    link(3 * t1, hbc);
+    link(3 * t2, hca);
+    link(3 * t + 1, 3 * t1 + 2);
+    link(3 * t1 + 1, 3 * t2 + 2);
+    link(3 * t2 + 1, 3 * t + 2);
+
+    legalizeStack.push_back(3 * t);
+    legalizeStack.push_back(3 * t1);
+    legalizeStack.push_back(3 * t2);
+}
+
+/*private*/
+void
+BulkDelaunayTriangulator::splitEdge(std::size_t e, std::size_t v)
+{
+    std::size_t f = halfedges[e];
+    if (f == NONE) {
+        throw LocateFailureException("Vertex lies on the triangulation frame.");
+    }
+    std::size_t t = e / 3;
+    std::size_t u = f / 3;
+    std::size_t a = triangles[e];
+    std::size_t b = triangles[nextHalfEdge(e)];
+    std::size_t c = triangles[prevHalfEdge(e)];
+    std::size_t d = triangles[prevHalfEdge(f)];
+    std::size_t hbc = halfedges[nextHalfEdge(e)];
+    std::size_t hca = halfedges[prevHalfEdge(e)];
+    std::size_t had = halfedges[nextHalfEdge(f)];
+    std::size_t hdb = halfedges[prevHalfEdge(f)];
+
+    std::size_t t1 = addTriangle();
+    std::size_t u1 = addTriangle();
+    setTriangle(t, c, a, v);
+    setTriangle(t1, b, c, v);
+    setTriangle(u, a, d, v);
+    setTriangle(u1, d, b, v);
+
+    link(3 * t, hca);
+    link(3 * t1, hbc);
+    link(3 * u, had);
+    link(3 * u1, hdb);
+    link(3 * t + 1, 3 * u + 2);
+    link(3 * t + 2, 3 * t1 + 1);
+    link(3 * t1 + 2, 3 * u1 + 1);
+    link(3 * u + 1, 3 * u1 + 2);
+
+    legalizeStack.push_back(3 * t);
+    legalizeStack.push_back(3 * t1);
+    legalizeStack.push_back(3 * u);
+    legalizeStack.push_back(3 * u1);
+}
+
+/*private*/
+void
+BulkDelaunayTriangulator::legalize()
+{
+    while (! legalizeStack.empty()) {
+        std::size_t e = legalizeStack.back();
+        legalizeStack.pop_back();
+
+        std::size_t f = halfedges[e];
+        if (f == NONE) {
+            continue;
+        }
+
+        std::size_t a = triangles[e];
+        std::size_t b = triangles[nextHalfEdge(e)];
+        std::size_t p = triangles[prevHalfEdge(e)];
+        std::size_t d = triangles[prevHalfEdge(f)];
+
+        // same test as IncrementalDelaunayTriangulator
+        if (! TrianglePredicate::isInCircleRobust(vertices[b], vertices[a], vertices[d], vertices[p])) {
+            continue;
+        }
+
+        std::size_t t = e / 3;
+        std::size_t u = f / 3;
+        std::size_t hbp = halfedges[nextHalfEdge(e)];
+        std::size_t hpa = halfedges[prevHalfEdge(e)];
+        std::size_t had = halfedges[nextHalfEdge(f)];
+        std::size_t hdb = halfedges[prevHalfEdge(f)];
+
+        // flip the edge ab to pd
+        setTriangle(t, p, a, d);
+        setTriangle(u, p, d, b);
+        link(3 * t, hpa);
+        link(3 * t + 1, had);
+        link(3 * u + 1, hdb);
+        link(3 * u + 2, hbp);
+        link(3 * t + 2, 3 * u);
+
+        legalizeStack.push_back(3 * t + 1);
+        legalizeStack.push_back(3 * u + 1);
+    }
+}
+
+/*private*/
+bool
+BulkDelaunayTriangulator::isFrameTriangle(std::size_t t) const
+{
+    return isFrameVertex(triangles[3 * t])
+        || isFrameVertex(triangles[3 * t + 1])
+        || isFrameVertex(triangles[3 * t + 2]);
+}
+
+/*public*/
+std::unique_ptr<MultiLineString>
+BulkDelaunayTriangulator::getEdges(const GeometryFactory& geomFact)
+{
+    triangulate();
+
+    std::vector<std::unique_ptr<Geometry>> edges;
+    for (std::size_t e = 0; e < triangles.size(); e++) {
+        std::size_t twin = halfedges[e];
+        // visit each edge once
+        if (twin != NONE && twin < e) {
+            continue;
+        }
+        std::size_t v0 = triangles[e];
+        std::size_t v1 = triangles[nextHalfEdge(e)];
+        if (isFrameVertex(v0) || isFrameVertex(v1)) {
+            continue;
+        }
+        auto coordSeq = geomFact.getCoordinateSequenceFactory()->create(2);
+        coordSeq->setAt(vertices[v0], 0);
+        coordSeq->setAt(vertices[v1], 1);
+        edges.emplace_back(geomFact.createLineString(coordSeq.release()));
+    }
+    return geomFact.createMultiLineString(std::move(edges));
+}
+
+/*public*/
+std::unique_ptr<GeometryCollection>
+BulkDelaunayTriangulator::getTriangles(const GeometryFactory& geomFact)
+{
+    triangulate();
+
+    std::vector<std::unique_ptr<Geometry>> tris;
+    for (std::size_t t = 0; t < getNumTriangles(); t++) {
+        if (isFrameTriangle(t)) {
+            continue;
+        }
+        std::vector<Coordinate> pts {
+            vertices[triangles[3 * t]],
+            vertices[triangles[3 * t + 1]],
+            vertices[triangles[3 * t + 2]],
+            vertices[triangles[3 * t]]
+        };
+        auto seq = geomFact.getCoordinateSequenceFactory()->create(std::move(pts));
+        tris.push_back(geomFact.createPolygon(geomFact.createLinearRing(std::move(seq))));
+    }
+    return geomFact.createGeometryCollection(std::move(tris));
+}
+
+/*private*/
+void
+BulkDelaunayTriangulator::computeCircumcentres()
+{
+    if (circumcentres.size() == getNumTriangles()) {
+        return;
+    }
+    circumcentres.resize(getNumTriangles());
+    for (std::size_t t = 0; t < getNumTriangles(); t++) {
+        Triangle triangle(vertices[triangles[3 * t]],
+                          vertices[triangles[3 * t + 1]],
+                          vertices[triangles[3 * t + 2]]);
+        triangle.circumcentreDD(circumcentres[t]);
+    }
+}
+
+/*private*/
+std::vector<Coordinate>
+BulkDelaunayTriangulator::voronoiCellPoints(std::size_t v) const
+{
+    std::vector<Coordinate> cellPts;
+
+    // circulate around the vertex, through the triangles incident on it
+    std::size_t start = vertexEdge[v];
+    std::size_t e = start;
+    do {
+        const Coordinate& cc = circumcentres[e / 3];
+        if (cellPts.empty() || cellPts.back() != cc) {  // no duplicates
+            cellPts.push_back(cc);
+        }
+        e = halfedges[nextHalfEdge(e)];
+    }
+    while (e != start && e != NONE);
+
+    // Close the ring
+    if (cellPts.front() != cellPts.back()) {
+        cellPts.push_back(cellPts.front());
+    }
+    return cellPts;
+}
+
+/*public*/
+std::vector<std::unique_ptr<Geometry>>
+BulkDelaunayTriangulator::getVoronoiCellPolygons(const GeometryFactory& geomFact)
+{
+    triangulate();
+    computeCircumcentres();
+
+    std::vector<std::unique_ptr<Geometry>> cells;
+    for (std::size_t v = NUM_FRAME_VERTICES; v < vertices.size(); v++) {
+        // skip sites which were not inserted
+        if (vertexEdge[v] == NONE) {
+            continue;
+        }
+        std::vector<Coordinate> cellPts = voronoiCellPoints(v);
+        if (cellPts.size() < 4) {
+            cellPts.push_back(cellPts.back());
+        }
+        auto seq = geomFact.getCoordinateSequenceFactory()->create(std::move(cellPts));
+        std::unique_ptr<Geometry> cell = geomFact.createPolygon(geomFact.createLinearRing(std::move(seq)));
+        cell->setUserData(static_cast<void*>(&vertices[v]));
+        cells.push_back(std::move(cell));
+    }
+    return cells;
+}
+
+/*public*/
+std::unique_ptr<MultiLineString>
+BulkDelaunayTriangulator::getVoronoiDiagramEdges(const GeometryFactory& geomFact)
+{
+    triangulate();
+    computeCircumcentres();
+
+    std::vector<std::unique_ptr<Geometry>> cells;
+    for (std::size_t v = NUM_FRAME_VERTICES; v < vertices.size(); v++) {
+        if (vertexEdge[v] == NONE) {
+            continue;
+        }
+        std::vector<Coordinate> cellPts = voronoiCellPoints(v);
+        cells.emplace_back(geomFact.createLineString(new CoordinateArraySequence(std::move(cellPts))));
+        cells.back()->setUserData(static_cast<void*>(&vertices[v]));
+    }
+    return geomFact.createMultiLineString(std::move(cells));
+}
+
+} //namespace geos.triangulate
+} //namespace geos
@@ -0,0 +1,307 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/ConstrainedDelaunayTriangulationBuilder.h>
+
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/noding/IteratedNoder.h>
+#include <geos/noding/NodedSegmentString.h>
+#include <geos/triangulate/ConstrainedDelaunayTriangulator.h>
+#include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/quadedge/QuadEdge.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/util/TopologyException.h>
+
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+using namespace geos::geom;
+using quadedge::QuadEdge;
+using quadedge::Vertex;
+
+ConstrainedDelaunayTriangulationBuilder::ConstrainedDelaunayTriangulationBuilder() :
+    isPolygonal(false)
+{
+}
+
+ConstrainedDelaunayTriangulationBuilder::~ConstrainedDelaunayTriangulationBuilder() = default;
+
+void
+ConstrainedDelaunayTriangulationBuilder::setSites(const Geometry& geom)
+{
+    std::unique_ptr<CoordinateSequence> coords = geom.getCoordinates();
+    coords->toVector(sites);
+}
+
+void
+ConstrainedDelaunayTriangulationBuilder::setConstraints(const Geometry& geom)
+{
+    addConstraints(geom);
+}
+
+/*private*/
+void
+ConstrainedDelaunayTriangulationBuilder::addConstraints(const Geometry& geom)
+{
+    if (geom.isEmpty()) {
+        return;
+    }
+    switch (geom.getGeometryTypeId()) {
+    case GEOS_POINT:
+        sites.push_back(*geom.getCoordinate());
+        break;
+    case GEOS_LINESTRING:
+    case GEOS_LINEARRING:
+        constraintLines.push_back(static_cast<const LineString&>(geom).getCoordinates());
+        isRingLine.push_back(false);
+        break;
+    case GEOS_POLYGON: {
+        isPolygonal = true;
+        const Polygon& poly = static_cast<const Polygon&>(geom);
+        constraintLines.push_back(poly.getExteriorRing()->getCoordinates());
+        isRingLine.push_back(true);
+        for (std::size_t i = 0; i < poly.getNumInteriorRing(); i++) {
+            constraintLines.push_back(poly.getInteriorRingN(i)->getCoordinates());
+            isRingLine.push_back(true);
+        }
+        break;
+    }
+    default:
+        for (std::size_t i = 0; i < geom.getNumGeometries(); i++) {
+            addConstraints(*geom.getGeometryN(i));
+        }
+    }
+}
+
+/*private*/
+void
+ConstrainedDelaunayTriangulationBuilder::create()
+{
+    if (subdiv != nullptr) {
+        return;
+    }
+
+    /**
+    * Most inputs (such as valid polygons) do not have crossing constraints,
+    * so noding is only done if the triangulation detects a crossing.
+    */
+    try {
+        triangulate(constraintLines, isRingLine);
+    }
+    catch (const util::TopologyException&) {
+        std::vector<std::unique_ptr<CoordinateSequence>> nodedLines;
+        std::vector<bool> isNodedRingLine;
+        node(nodedLines, isNodedRingLine);
+        triangulate(nodedLines, isNodedRingLine);
+    }
+}
+
+/*private*/
+void
+ConstrainedDelaunayTriangulationBuilder::node(std::vector<std::unique_ptr<CoordinateSequence>>& nodedLines,
+        std::vector<bool>& isNodedRingLine) const
+{
+    // the context of each segment string records whether it is from a polygon ring
+    static const bool IS_RING = true;
+    std::vector<noding::SegmentString*> segStrings;
+    for (std::size_t i = 0; i < constraintLines.size(); i++) {
+        const void* context = isRingLine[i] ? &IS_RING : nullptr;
+        segStrings.push_back(new noding::NodedSegmentString(constraintLines[i]->clone().release(), context));
+    }
+
+    std::vector<noding::SegmentString*>* nodedStrings = nullptr;
+    PrecisionModel pm;
+    noding::IteratedNoder noder(&pm);
+    try {
+        noder.computeNodes(&segStrings);
+        nodedStrings = noder.getNodedSubstrings();
+    }
+    catch (const std::exception&) {
+        for (auto ss : segStrings) {
+            delete ss;
+        }
+        throw;
+    }
+    for (auto ss : segStrings) {
+        delete ss;
+    }
+
+    for (auto ss : *nodedStrings) {
+        nodedLines.push_back(ss->getCoordinates()->clone());
+        isNodedRingLine.push_back(ss->getData() != nullptr);
+        delete ss;
+    }
+    delete nodedStrings;
+}
+
+/*private*/
+void
+ConstrainedDelaunayTriangulationBuilder::triangulate(const std::vector<std::unique_ptr<CoordinateSequence>>& lines,
+        const std::vector<bool>& isRing)
+{
+    subdiv.reset();
+    ringEdges.clear();
+
+    CoordinateArraySequence allSites(std::vector<Coordinate>(sites), 0);
+    for (const auto& line : lines) {
+        for (std::size_t i = 0; i < line->size(); i++) {
+            allSites.add(line->getAt(i));
+        }
+    }
+    if (allSites.isEmpty()) {
+        return;
+    }
+
+    auto uniqueSites = DelaunayTriangulationBuilder::unique(&allSites);
+    Envelope siteEnv = uniqueSites->getEnvelope();
+    auto vertices = DelaunayTriangulationBuilder::toVertices(*uniqueSites);
+    DelaunayTriangulationBuilder::sortVertices(vertices, true);
+
+    subdiv.reset(new quadedge::QuadEdgeSubdivision(siteEnv, 0.0));
+    DelaunayTriangulationBuilder::insertVertices(*subdiv, vertices, siteEnv, true);
+
+    ConstrainedDelaunayTriangulator triangulator(subdiv.get());
+    std::vector<QuadEdge*> constraintEdges;
+    for (std::size_t i = 0; i < lines.size(); i++) {
+        const CoordinateSequence& line = *lines[i];
+        for (std::size_t j = 1; j < line.size(); j++) {
+            constraintEdges.clear();
+            triangulator.insertConstraint(Vertex(line.getAt(j - 1)),
+                                          Vertex(line.getAt(j)),
+                                          constraintEdges);
+            if (isRing[i]) {
+                ringEdges.insert(ringEdges.end(), constraintEdges.begin(), constraintEdges.end());
+            }
+        }
+    }
+}
+
+quadedge::QuadEdgeSubdivision&
+ConstrainedDelaunayTriangulationBuilder::getSubdivision()
+{
+    create();
+    return *subdiv;
+}
+
+std::unique_ptr<MultiLineString>
+ConstrainedDelaunayTriangulationBuilder::getEdges(const GeometryFactory& geomFact)
+{
+    create();
+    if (!subdiv) {
+        return geomFact.createMultiLineString();
+    }
+    return subdiv->getEdges(geomFact);
+}
+
+std::unique_ptr<GeometryCollection>
+ConstrainedDelaunayTriangulationBuilder::getTriangles(const GeometryFactory& geomFact)
+{
+    create();
+    if (!subdiv) {
+        return geomFact.createGeometryCollection();
+    }
+    if (isPolygonal) {
+        return getPolygonTriangles(geomFact);
+    }
+    return subdiv->getTriangles(geomFact);
+}
+
+/*private*/
+std::unique_ptr<GeometryCollection>
+ConstrainedDelaunayTriangulationBuilder::getPolygonTriangles(const GeometryFactory& geomFact)
+{
+    /**
+    * Crossing a ring edge moves between the inside and outside of the polygons.
+    * An edge shared by two polygons occurs twice, and is not crossed.
+    */
+    std::unordered_map<const QuadEdge*, bool> isBoundary;
+    for (const QuadEdge* e : ringEdges) {
+        const QuadEdge* key = std::min(e, &e->sym(), std::less<const QuadEdge*>());
+        auto it = isBoundary.find(key);
+        if (it == isBoundary.end()) {
+            isBoundary.emplace(key, true);
+        }
+        else {
+            it->second = !it->second;
+        }
+    }
+    auto isBoundaryEdge = [&isBoundary](const QuadEdge& e) {
+        const QuadEdge* key = std::min(&e, &e.sym(), std::less<const QuadEdge*>());
+        auto it = isBoundary.find(key);
+        return it != isBoundary.end() && it->second;
+    };
+
+    auto& quadEdges = subdiv->getEdges();
+    for (auto& qe : quadEdges) {
+        qe.setVisited(false);
+    }
+
+    /**
+    * Flood fill the triangles from the triangle inside the frame,
+    * which is outside the polygons.
+    */
+    std::vector<std::unique_ptr<Geometry>> tris;
+    std::vector<std::pair<QuadEdge*, bool>> stack;
+    stack.emplace_back(&quadEdges[0].base(), false);
+    while (!stack.empty()) {
+        QuadEdge* e = stack.back().first;
+        bool isInside = stack.back().second;
+        stack.pop_back();
+        if (e->isVisited()) {
+            continue;
+        }
+
+        std::array<QuadEdge*, 3> triEdges {{ e, &e->lNext(), &e->lNext().lNext() }};
+        for (QuadEdge* t : triEdges) {
+            t->setVisited(true);
+        }
+        if (isInside) {
+            auto coords = geomFact.getCoordinateSequenceFactory()->create(4, 0);
+            for (std::size_t i = 0; i < 3; i++) {
+                coords->setAt(triEdges[i]->orig().getCoordinate(), i);
+            }
+            coords->setAt(triEdges[0]->orig().getCoordinate(), 3);
+            tris.emplace_back(geomFact.createPolygon(geomFact.createLinearRing(std::move(coords))));
+        }
+
+        for (QuadEdge* t : triEdges) {
+            // do not leave the frame
+            if (subdiv->isFrameVertex(t->orig()) && subdiv->isFrameVertex(t->dest())) {
+                continue;
+            }
+            QuadEdge& adj = t->sym();
+            if (!adj.isVisited()) {
+                stack.emplace_back(&adj, isInside != isBoundaryEdge(*t));
+            }
+        }
+    }
+
+    for (auto& qe : quadEdges) {
+        qe.setVisited(false);
+    }
+    return geomFact.createGeometryCollection(std::move(tris));
+}
+
+} //namespace geos.triangulate
+} //namespace geos
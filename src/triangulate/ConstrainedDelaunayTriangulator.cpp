@@ -0,0 +1,303 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/ConstrainedDelaunayTriangulator.h>
+
+#include <geos/algorithm/Orientation.h>
+#include <geos/triangulate/quadedge/LocateFailureException.h>
+#include <geos/triangulate/quadedge/QuadEdge.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/quadedge/TrianglePredicate.h>
+#include <geos/triangulate/quadedge/Vertex.h>
+#include <geos/util/TopologyException.h>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+
+using geos::algorithm::Orientation;
+using geos::geom::TrianglePredicate;
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+using namespace quadedge;
+
+namespace {
+
+// The maximum number of passes of restoreDelaunay, per new edge
+const std::size_t MAX_RESTORE_PASSES_PER_EDGE = 4;
+
+int
+orientation(const Vertex& p0, const Vertex& p1, const Vertex& q)
+{
+    return Orientation::index(p0.getCoordinate(), p1.getCoordinate(), q.getCoordinate());
+}
+
+}
+
+ConstrainedDelaunayTriangulator::ConstrainedDelaunayTriangulator(QuadEdgeSubdivision* p_subdiv) :
+    subdiv(p_subdiv)
+{
+}
+
+/*private static*/
+const QuadEdge*
+ConstrainedDelaunayTriangulator::edgeKey(const QuadEdge& e)
+{
+    // e and its sym are in the same quartet, so can be compared
+    return std::min(&e, &e.sym(), std::less<const QuadEdge*>());
+}
+
+/*public*/
+bool
+ConstrainedDelaunayTriangulator::isConstrained(const QuadEdge& e) const
+{
+    return constrainedEdges.count(edgeKey(e)) > 0;
+}
+
+/*private*/
+void
+ConstrainedDelaunayTriangulator::setConstrained(QuadEdge& e, std::vector<QuadEdge*>& constraintEdges)
+{
+    constrainedEdges.insert(edgeKey(e));
+    constraintEdges.push_back(&e);
+}
+
+/*private*/
+void
+ConstrainedDelaunayTriangulator::initVertexEdges()
+{
+    for (auto& qe : subdiv->getEdges()) {
+        QuadEdge& e = qe.base();
+        if (e.isLive()) {
+            vertexEdges[e.orig().getCoordinate()] = &e;
+            vertexEdges[e.dest().getCoordinate()] = &e.sym();
+        }
+    }
+}
+
+/*private*/
+QuadEdge&
+ConstrainedDelaunayTriangulator::findEdgeFrom(const Vertex& v)
+{
+    if (vertexEdges.empty()) {
+        initVertexEdges();
+    }
+    auto it = vertexEdges.find(v.getCoordinate());
+    if (it == vertexEdges.end()) {
+        throw LocateFailureException("Constraint vertex is not in subdivision.");
+    }
+    return *(it->second);
+}
+
+/*private*/
+void
+ConstrainedDelaunayTriangulator::swap(QuadEdge& e)
+{
+    // the edges to the left and right apexes are not changed by the swap
+    vertexEdges[e.orig().getCoordinate()] = &e.oNext();
+    vertexEdges[e.dest().getCoordinate()] = &e.sym().oNext();
+    QuadEdge::swap(e);
+}
+
+/*private static*/
+bool
+ConstrainedDelaunayTriangulator::isSwappable(const QuadEdge& e)
+{
+    const Vertex& left = e.lNext().dest();
+    const Vertex& right = e.oPrev().dest();
+    int orientOrig = orientation(right, left, e.orig());
+    int orientDest = orientation(right, left, e.dest());
+    return orientOrig != Orientation::COLLINEAR
+           && orientDest != Orientation::COLLINEAR
+           && orientOrig != orientDest;
+}
+
+/*private static*/
+bool
+ConstrainedDelaunayTriangulator::isCrossing(const QuadEdge& e, const Vertex& p0, const Vertex& p1)
+{
+    const Vertex& q0 = e.orig();
+    const Vertex& q1 = e.dest();
+    if (q0.equals(p0) || q0.equals(p1) || q1.equals(p0) || q1.equals(p1)) {
+        return false;
+    }
+    return orientation(p0, p1, q0) * orientation(p0, p1, q1) < 0
+           && orientation(q0, q1, p0) * orientation(q0, q1, p1) < 0;
+}
+
+/*public*/
+void
+ConstrainedDelaunayTriangulator::insertConstraint(const Vertex& a, const Vertex& b)
+{
+    std::vector<QuadEdge*> constraintEdges;
+    insertConstraint(a, b, constraintEdges);
+}
+
+/*public*/
+void
+ConstrainedDelaunayTriangulator::insertConstraint(const Vertex& a, const Vertex& b,
+        std::vector<QuadEdge*>& constraintEdges)
+{
+    if (a.equals(b)) {
+        return;
+    }
+
+    Vertex start = a;
+    for (;;) {
+        /**
+        * Find the edge from start along the constraint,
+        * or the triangle at start which the constraint enters
+        */
+        QuadEdge* first = &findEdgeFrom(start);
+        QuadEdge* e = first;
+        QuadEdge* entry = nullptr;
+        QuadEdge* along = nullptr;
+        do {
+            const Vertex& d1 = e->dest();
+            const Vertex& d2 = e->oNext().dest();
+            int orient1 = orientation(start, b, d1);
+            if (orient1 == Orientation::COLLINEAR
+                    && (d1.getX() - start.getX()) * (b.getX() - start.getX())
+                    + (d1.getY() - start.getY()) * (b.getY() - start.getY()) > 0) {
+                along = e;
+                break;
+            }
+            if (orient1 == Orientation::CLOCKWISE
+                    && orientation(start, b, d2) == Orientation::COUNTERCLOCKWISE) {
+                entry = e;
+                break;
+            }
+            e = &e->oNext();
+        }
+        while (e != first);
+
+        Vertex end;
+        if (along) {
+            // an existing edge lies along the constraint
+            setConstrained(*along, constraintEdges);
+            end = along->dest();
+        }
+        else if (entry) {
+            /**
+            * Walk along the constraint, collecting the crossed edges
+            * (oriented from their right to their left endpoint)
+            * until the end or a vertex on the constraint is reached
+            */
+            crossingEdges.clear();
+            QuadEdge* cross = &entry->lNext();
+            for (;;) {
+                if (isConstrained(*cross)) {
+                    throw util::TopologyException("Constraint segments cross",
+                                                  cross->orig().getCoordinate());
+                }
+                crossingEdges.push_back(cross);
+                QuadEdge& next = cross->sym();
+                const Vertex& apex = next.lNext().dest();
+                int orient = orientation(start, b, apex);
+                if (apex.equals(b) || orient == Orientation::COLLINEAR) {
+                    end = apex;
+                    break;
+                }
+                cross = (orient == Orientation::COUNTERCLOCKWISE)
+                        ? &next.lNext()
+                        : &next.lNext().lNext();
+            }
+            QuadEdge& constraint = removeCrossingEdges(start, end);
+            setConstrained(constraint, constraintEdges);
+            restoreDelaunay();
+        }
+        else {
+            throw LocateFailureException("Could not locate constraint.");
+        }
+
+        if (end.equals(b)) {
+            return;
+        }
+        start = end;
+    }
+}
+
+/*private*/
+QuadEdge&
+ConstrainedDelaunayTriangulator::removeCrossingEdges(const Vertex& start, const Vertex& end)
+{
+    newEdges.clear();
+    std::deque<QuadEdge*> queue(crossingEdges.begin(), crossingEdges.end());
+
+    // the number of edges which could not be swapped since the last swap
+    std::size_t numUnswappable = 0;
+    while (!queue.empty()) {
+        QuadEdge* e = queue.front();
+        queue.pop_front();
+
+        if (!isSwappable(*e)) {
+            queue.push_back(e);
+            if (++numUnswappable > queue.size()) {
+                throw util::TopologyException("Unable to insert constraint",
+                                              start.getCoordinate());
+            }
+            continue;
+        }
+        numUnswappable = 0;
+
+        swap(*e);
+        if (isCrossing(*e, start, end)) {
+            queue.push_back(e);
+        }
+        else {
+            newEdges.push_back(e);
+        }
+    }
+
+    // one of the new edges is the constraint
+    for (std::size_t i = 0; i < newEdges.size(); i++) {
+        QuadEdge* e = newEdges[i];
+        bool isForward = e->orig().equals(start) && e->dest().equals(end);
+        bool isReverse = e->orig().equals(end) && e->dest().equals(start);
+        if (isForward || isReverse) {
+            newEdges.erase(newEdges.begin() + static_cast<std::ptrdiff_t>(i));
+            return isForward ? *e : e->sym();
+        }
+    }
+    throw util::TopologyException("Unable to insert constraint", start.getCoordinate());
+}
+
+/*private*/
+void
+ConstrainedDelaunayTriangulator::restoreDelaunay()
+{
+    // The in-circle test is robust, so swapping terminates. The passes are
+    // bounded anyway, so that inconsistent tests on nearly cocircular
+    // vertices cannot swap a pair of diagonals back and forth forever.
+    std::size_t maxPasses = MAX_RESTORE_PASSES_PER_EDGE * newEdges.size() + 1;
+    for (std::size_t pass = 0; pass < maxPasses; pass++) {
+        bool isSwapped = false;
+        for (QuadEdge* e : newEdges) {
+            const Vertex& right = e->oPrev().dest();
+            if (TrianglePredicate::isInCircleRobust(e->orig().getCoordinate(), e->dest().getCoordinate(),
+                                                    e->lNext().dest().getCoordinate(), right.getCoordinate())
+                    && isSwappable(*e)) {
+                swap(*e);
+                isSwapped = true;
+            }
+        }
+        if (!isSwapped) {
+            return;
+        }
+    }
+    throw util::TopologyException("Unable to restore the Delaunay condition");
+}
+
+} //namespace geos.triangulate
+} //namespace geos
@@ -26,7 +26,10 @@
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/triangulate/quadedge/JumpAndWalkQuadEdgeLocator.h>
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/shape/fractal/HilbertCode.h>
+#include <geos/shape/fractal/HilbertEncoder.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/operation/valid/RepeatedPointTester.h>
 #include <geos/util.h>
@@ -75,8 +78,55 @@ DelaunayTriangulationBuilder::toVertices(
     return vertexList;
 }
 
+void
+DelaunayTriangulationBuilder::sortVertices(IncrementalDelaunayTriangulator::VertexList& vertices,
+        bool isHilbertOrder)
+{
+    if (!isHilbertOrder || vertices.size() < 2) {
+        std::sort(vertices.begin(), vertices.end());
+        return;
+    }
+
+    Envelope env;
+    for (const auto& v : vertices) {
+        env.expandToInclude(v.getCoordinate());
+    }
+    // the encoder requires a non-degenerate extent
+    env.expandBy(env.getWidth() > 0 ? 0 : 1, env.getHeight() > 0 ? 0 : 1);
+    shape::fractal::HilbertEncoder encoder(shape::fractal::HilbertCode::MAX_LEVEL, env);
+
+    std::vector<std::pair<uint32_t, std::size_t>> keys;
+    keys.reserve(vertices.size());
+    for (std::size_t i = 0; i < vertices.size(); i++) {
+        Envelope vertexEnv(vertices[i].getCoordinate());
+        keys.emplace_back(encoder.encode(&vertexEnv), i);
+    }
+    // ties are broken by input order, which is deterministic
+    std::sort(keys.begin(), keys.end());
+
+    IncrementalDelaunayTriangulator::VertexList sorted;
+    sorted.reserve(vertices.size());
+    for (const auto& key : keys) {
+        sorted.push_back(vertices[key.second]);
+    }
+    vertices.swap(sorted);
+}
+
+void
+DelaunayTriangulationBuilder::insertVertices(quadedge::QuadEdgeSubdivision& subdiv,
+        const IncrementalDelaunayTriangulator::VertexList& vertices,
+        const Envelope& siteEnv, bool isHilbertOrder)
+{
+    if (isHilbertOrder) {
+        subdiv.setLocator(std::unique_ptr<quadedge::QuadEdgeLocator>(
+            new quadedge::JumpAndWalkQuadEdgeLocator(&subdiv, siteEnv, vertices.size())));
+    }
+    IncrementalDelaunayTriangulator triangulator(&subdiv);
+    triangulator.insertSites(vertices);
+}
+
 DelaunayTriangulationBuilder::DelaunayTriangulationBuilder() :
-    siteCoords(nullptr), tolerance(0.0), subdiv(nullptr)
+    siteCoords(nullptr), tolerance(0.0), isBulk(false), isBulkSet(false), isHilbertOrder(false), subdiv(nullptr)
 {
 }
 
@@ -108,12 +158,30 @@ DelaunayTriangulationBuilder::create()
 
     Envelope siteEnv = siteCoords->getEnvelope();
     auto vertices = toVertices(*siteCoords);
-    std::sort(vertices.begin(),
-              vertices.end()); // Best performance from locator when inserting points near each other
+    sortVertices(vertices, isHilbertOrder);
 
     subdiv.reset(new quadedge::QuadEdgeSubdivision(siteEnv, tolerance));
-    IncrementalDelaunayTriangulator triangulator = IncrementalDelaunayTriangulator(subdiv.get());
-    triangulator.insertSites(vertices);
+    insertVertices(*subdiv, vertices, siteEnv, isHilbertOrder);
+}
+
+void
+DelaunayTriangulationBuilder::createBulk()
+{
+    if(bulkTriangulator != nullptr || siteCoords == nullptr) {
+        return;
+    }
+
+    bulkTriangulator.reset(new BulkDelaunayTriangulator(*siteCoords, tolerance));
+    bulkTriangulator->triangulate();
+}
+
+bool
+DelaunayTriangulationBuilder::useBulk() const
+{
+    if (isBulkSet) {
+        return isBulk;
+    }
+    return siteCoords != nullptr && siteCoords->size() >= BulkDelaunayTriangulator::DEFAULT_MIN_SITES;
 }
 
 quadedge::QuadEdgeSubdivision&
@@ -127,6 +195,14 @@ std::unique_ptr<MultiLineString>
 DelaunayTriangulationBuilder::getEdges(
     const GeometryFactory& geomFact)
 {
+    if (useBulk()) {
+        createBulk();
+        if (!bulkTriangulator) {
+            return geomFact.createMultiLineString();
+        }
+        return bulkTriangulator->getEdges(geomFact);
+    }
+
     create();
     if (!subdiv) {
         return geomFact.createMultiLineString();
@@ -139,6 +215,14 @@ std::unique_ptr<geom::GeometryCollection>
 DelaunayTriangulationBuilder::getTriangles(
     const geom::GeometryFactory& geomFact)
 {
+    if (useBulk()) {
+        createBulk();
+        if (!bulkTriangulator) {
+            return geomFact.createGeometryCollection();
+        }
+        return bulkTriangulator->getTriangles(geomFact);
+    }
+
     create();
     if (!subdiv) {
         return geomFact.createGeometryCollection();
@@ -42,7 +42,7 @@ using namespace geos::geom;
 
 
 VoronoiDiagramBuilder::VoronoiDiagramBuilder() :
-    tolerance(0.0), clipEnv(nullptr)
+    tolerance(0.0), isBulk(false), isBulkSet(false), isHilbertOrder(false), clipEnv(nullptr)
 {
 }
 
@@ -71,9 +71,31 @@ VoronoiDiagramBuilder::setTolerance(double nTolerance)
 }
 
 void
-VoronoiDiagramBuilder::create()
+VoronoiDiagramBuilder::setBulk(bool p_isBulk)
 {
-    if(subdiv) {
+    isBulk = p_isBulk;
+    isBulkSet = true;
+}
+
+bool
+VoronoiDiagramBuilder::useBulk() const
+{
+    if (isBulkSet) {
+        return isBulk;
+    }
+    return siteCoords != nullptr && siteCoords->size() >= BulkDelaunayTriangulator::DEFAULT_MIN_SITES;
+}
+
+void
+VoronoiDiagramBuilder::setHilbertOrder(bool p_isHilbertOrder)
+{
+    isHilbertOrder = p_isHilbertOrder;
+}
+
+void
+VoronoiDiagramBuilder::create(bool bulk)
+{
+    if(bulk ? bulkTriangulator != nullptr : subdiv != nullptr) {
         return;
     }
 
@@ -89,18 +111,24 @@ VoronoiDiagramBuilder::create()
         diagramEnv.expandToInclude(clipEnv);
     }
 
+    if (bulk) {
+        bulkTriangulator.reset(new BulkDelaunayTriangulator(*siteCoords, tolerance));
+        bulkTriangulator->setFrameEnvelope(diagramEnv);
+        bulkTriangulator->triangulate();
+        return;
+    }
+
     auto vertices = DelaunayTriangulationBuilder::toVertices(*siteCoords);
-    std::sort(vertices.begin(), vertices.end()); // Best performance from locator when inserting points near each other
+    DelaunayTriangulationBuilder::sortVertices(vertices, isHilbertOrder);
 
     subdiv.reset(new quadedge::QuadEdgeSubdivision(diagramEnv, tolerance));
-    IncrementalDelaunayTriangulator triangulator(subdiv.get());
-    triangulator.insertSites(vertices);
+    DelaunayTriangulationBuilder::insertVertices(*subdiv, vertices, siteCoords->getEnvelope(), isHilbertOrder);
 }
 
 std::unique_ptr<quadedge::QuadEdgeSubdivision>
 VoronoiDiagramBuilder::getSubdivision()
 {
-    create();
+    create(false);
     // NOTE: Apparently, this is 'source' method giving up the object resource.
     return std::move(subdiv);
 }
@@ -108,10 +136,14 @@ VoronoiDiagramBuilder::getSubdivision()
 std::unique_ptr<geom::GeometryCollection>
 VoronoiDiagramBuilder::getDiagram(const geom::GeometryFactory& geomFact)
 {
-    create();
+    create(useBulk());
 
     std::unique_ptr<GeometryCollection> ret;
-    if (subdiv) {
+    if (bulkTriangulator) {
+        auto polys = bulkTriangulator->getVoronoiCellPolygons(geomFact);
+        ret = clipGeometryCollection(polys, diagramEnv);
+    }
+    else if (subdiv) {
         auto polys = subdiv->getVoronoiCellPolygons(geomFact);
         ret = clipGeometryCollection(polys, diagramEnv);
     }
@@ -126,13 +158,19 @@ VoronoiDiagramBuilder::getDiagram(const geom::GeometryFactory& geomFact)
 std::unique_ptr<geom::Geometry>
 VoronoiDiagramBuilder::getDiagramEdges(const geom::GeometryFactory& geomFact)
 {
-    create();
+    create(useBulk());
 
-    if (!subdiv) {
+    std::unique_ptr<geom::MultiLineString> edges;
+    if (bulkTriangulator) {
+        edges = bulkTriangulator->getVoronoiDiagramEdges(geomFact);
+    }
+    else if (subdiv) {
+        edges = subdiv->getVoronoiDiagramEdges(geomFact);
+    }
+    else {
         return geomFact.createMultiLineString();
     }
 
-    std::unique_ptr<geom::MultiLineString> edges = subdiv->getVoronoiDiagramEdges(geomFact);
     if(edges->isEmpty()) {
         return std::unique_ptr<Geometry>(edges.release());
     }
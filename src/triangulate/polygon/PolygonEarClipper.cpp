@@ -0,0 +1,849 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/polygon/PolygonEarClipper.h>
+
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/shape/fractal/MortonCode.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using geos::algorithm::Orientation;
+using geos::shape::fractal::MortonCode;
+using namespace geos::geom;
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace polygon { //geos.triangulate.polygon
+
+constexpr std::size_t PolygonEarClipper::HASH_MIN_SIZE;
+constexpr std::size_t PolygonEarClipper::NONE;
+
+/* The maximum ordinate value of the z-order curve */
+static const double Z_ORDER_MAX = 32767.0;
+
+/* The bits of the x and y ordinates in a z-order value */
+static const uint32_t Z_MASK_X = 0x55555555;
+static const uint32_t Z_MASK_Y = 0xAAAAAAAA;
+
+/*
+ * Tests if a z-order value lies in the box
+ * with the given minimum and maximum corners.
+ */
+static bool
+isInZBox(uint32_t z, uint32_t minZ, uint32_t maxZ)
+{
+    return (z & Z_MASK_X) >= (minZ & Z_MASK_X) && (z & Z_MASK_X) <= (maxZ & Z_MASK_X)
+           && (z & Z_MASK_Y) >= (minZ & Z_MASK_Y) && (z & Z_MASK_Y) <= (maxZ & Z_MASK_Y);
+}
+
+/*
+ * Computes the smallest z-order value greater than z which lies in the box
+ * with the given minimum and maximum corners
+ * (the BIGMIN of Tropf and Herzog).
+ */
+static uint32_t
+nextZInBox(uint32_t z, uint32_t minZ, uint32_t maxZ)
+{
+    uint32_t bigMin = maxZ;
+    for (int bit = 31; bit >= 0; bit--) {
+        uint32_t mask = 1u << bit;
+        // the lower bits of the same ordinate
+        uint32_t lowerMask = ((bit % 2 == 0) ? Z_MASK_X : Z_MASK_Y) & (mask - 1);
+        bool zBit = (z & mask) != 0;
+        bool minBit = (minZ & mask) != 0;
+        bool maxBit = (maxZ & mask) != 0;
+        if (! zBit) {
+            if (minBit) {
+                return minZ;
+            }
+            if (maxBit) {
+                bigMin = (minZ | mask) & ~lowerMask;
+                maxZ = (maxZ & ~mask) | lowerMask;
+            }
+        }
+        else {
+            if (! maxBit) {
+                return bigMin;
+            }
+            if (! minBit) {
+                minZ = (minZ | mask) & ~lowerMask;
+            }
+        }
+    }
+    return bigMin;
+}
+
+/* public */
+PolygonEarClipper::PolygonEarClipper(const Polygon& poly)
+    : inputPoly(poly)
+    , triangles(nullptr)
+    , isHashed(false)
+    , minX(0.0)
+    , minY(0.0)
+    , invSize(0.0)
+{}
+
+/* public */
+void
+PolygonEarClipper::compute(std::vector<Triangle>& triList)
+{
+    triangles = &triList;
+    if (inputPoly.isEmpty()) {
+        return;
+    }
+
+    Node* outerNode = linkRing(*inputPoly.getExteriorRing()->getCoordinatesRO(), true);
+    if (outerNode == nullptr || outerNode->next == outerNode->prev) {
+        return;
+    }
+
+    std::size_t numVertices = inputPoly.getNumPoints();
+    if (inputPoly.getNumInteriorRing() > 0) {
+        outerNode = eliminateHoles(outerNode);
+    }
+
+    if (numVertices > HASH_MIN_SIZE) {
+        const Envelope* env = inputPoly.getEnvelopeInternal();
+        double size = std::max(env->getWidth(), env->getHeight());
+        if (size > 0.0) {
+            isHashed = true;
+            minX = env->getMinX();
+            minY = env->getMinY();
+            invSize = Z_ORDER_MAX / size;
+        }
+    }
+
+    clipEars(outerNode, 0);
+}
+
+/* private */
+PolygonEarClipper::Node*
+PolygonEarClipper::createNode(const Coordinate& p, Node* last)
+{
+    nodes.emplace_back();
+    Node* n = &nodes.back();
+    n->p = p;
+    n->zIndex = NONE;
+    n->isCand = false;
+    if (last == nullptr) {
+        n->prev = n;
+        n->next = n;
+    }
+    else {
+        n->next = last->next;
+        n->prev = last;
+        last->next->prev = n;
+        last->next = n;
+    }
+    return n;
+}
+
+/* private */
+PolygonEarClipper::Node*
+PolygonEarClipper::linkRing(const CoordinateSequence& ring, bool isCCW)
+{
+    std::size_t n = ring.size();
+    if (n < 4) {
+        return nullptr;
+    }
+    Node* last = nullptr;
+    // the closing point is omitted
+    if (Orientation::isCCW(&ring) == isCCW) {
+        for (std::size_t i = 0; i < n - 1; i++) {
+            last = createNode(ring.getAt(i), last);
+        }
+    }
+    else {
+        for (std::size_t i = n - 1; i > 0; i--) {
+            last = createNode(ring.getAt(i), last);
+        }
+    }
+    return filterPoints(last, nullptr, false);
+}
+
+/* private */
+void
+PolygonEarClipper::removeNode(Node* n)
+{
+    n->next->prev = n->prev;
+    n->prev->next = n->next;
+    unindex(n);
+}
+
+/* private */
+PolygonEarClipper::Node*
+PolygonEarClipper::filterPoints(Node* start, Node* end, bool isCollinearRemoved)
+{
+    if (start == nullptr) {
+        return start;
+    }
+    if (end == nullptr) {
+        end = start;
+    }
+    Node* p = start;
+    bool again;
+    do {
+        again = false;
+        bool isRemoved = p->p.equals2D(p->next->p);
+        if (! isRemoved && orientation(p->prev, p, p->next) == Orientation::COLLINEAR) {
+            // flat vertices are kept unless requested, but spikes are always removed
+            const Coordinate& c = p->p;
+            double dot = (p->prev->p.x - c.x) * (p->next->p.x - c.x)
+                         + (p->prev->p.y - c.y) * (p->next->p.y - c.y);
+            isRemoved = isCollinearRemoved || dot > 0;
+        }
+        if (isRemoved) {
+            removeNode(p);
+            p = end = p->prev;
+            if (p == p->next) {
+                break;
+            }
+            again = true;
+        }
+        else {
+            p = p->next;
+        }
+    }
+    while (again || p != end);
+    return end;
+}
+
+/* private */
+PolygonEarClipper::Node*
+PolygonEarClipper::eliminateHoles(Node* outerNode)
+{
+    std::vector<Node*> holeNodes;
+    for (std::size_t i = 0; i < inputPoly.getNumInteriorRing(); i++) {
+        Node* list = linkRing(*inputPoly.getInteriorRingN(i)->getCoordinatesRO(), false);
+        if (list == nullptr || list->next == list->prev) {
+            continue;
+        }
+        holeNodes.push_back(getLeftmost(list));
+    }
+
+    // holes are bridged from left to right, so each bridge
+    // only has to be tested against the holes already joined
+    std::sort(holeNodes.begin(), holeNodes.end(), [](const Node* a, const Node* b) {
+        return a->p.compareTo(b->p) < 0;
+    });
+
+    for (Node* hole : holeNodes) {
+        outerNode = eliminateHole(hole, outerNode);
+    }
+    return outerNode;
+}
+
+/* private */
+PolygonEarClipper::Node*
+PolygonEarClipper::eliminateHole(Node* hole, Node* outerNode)
+{
+    Node* bridge = findHoleBridge(hole, outerNode);
+    if (bridge == nullptr) {
+        return outerNode;
+    }
+    Node* bridgeReverse = splitPolygon(bridge, hole);
+    filterPoints(bridgeReverse, bridgeReverse->next, false);
+    return filterPoints(bridge, bridge->next, false);
+}
+
+/* private */
+PolygonEarClipper::Node*
+PolygonEarClipper::findHoleBridge(const Node* hole, Node* outerNode) const
+{
+    double hx = hole->p.x;
+    double hy = hole->p.y;
+    double qx = -std::numeric_limits<double>::infinity();
+    Node* m = nullptr;
+
+    /**
+    * Find the nearest segment crossed by a ray from the hole vertex to the left.
+    * The segment endpoint with lesser x is a candidate bridge vertex.
+    */
+    Node* p = outerNode;
+    if (hole->p.equals2D(p->p)) {
+        return p;
+    }
+    do {
+        if (hole->p.equals2D(p->next->p)) {
+            return p->next;
+        }
+        if (hy <= p->p.y && hy >= p->next->p.y && p->next->p.y != p->p.y) {
+            double x = p->p.x + (hy - p->p.y) * (p->next->p.x - p->p.x) / (p->next->p.y - p->p.y);
+            if (x <= hx && x > qx) {
+                qx = x;
+                m = p->p.x < p->next->p.x ? p : p->next;
+                if (x == hx) {
+                    // hole touches the segment
+                    return m;
+                }
+            }
+        }
+        p = p->next;
+    }
+    while (p != outerNode);
+
+    if (m == nullptr) {
+        return nullptr;
+    }
+
+    /**
+    * If vertices lie inside the triangle formed by the hole vertex,
+    * the ray intersection point and the candidate,
+    * the bridge is made to the one with minimum angle to the ray.
+    */
+    const Node* stop = m;
+    Coordinate h(hx, hy);
+    Coordinate q(qx, hy);
+    Coordinate mp = m->p;
+    double tanMin = std::numeric_limits<double>::infinity();
+    p = m;
+    do {
+        if (hx >= p->p.x && p->p.x >= mp.x && hx != p->p.x
+                && isInTriangle(h, mp, q, p->p)) {
+            double tan = std::fabs(hy - p->p.y) / (hx - p->p.x);
+            if (isLocallyInside(p, hole)
+                    && (tan < tanMin
+                        || (tan == tanMin
+                            && (p->p.x > m->p.x || (p->p.x == m->p.x && sectorContainsSector(m, p)))))) {
+                m = p;
+                tanMin = tan;
+            }
+        }
+        p = p->next;
+    }
+    while (p != stop);
+    return m;
+}
+
+/* private */
+PolygonEarClipper::Node*
+PolygonEarClipper::splitPolygon(Node* a, Node* b)
+{
+    nodes.emplace_back(*a);
+    Node* a2 = &nodes.back();
+    nodes.emplace_back(*b);
+    Node* b2 = &nodes.back();
+    a2->zIndex = NONE;
+    b2->zIndex = NONE;
+    Node* an = a->next;
+    Node* bp = b->prev;
+
+    a->next = b;
+    b->prev = a;
+
+    a2->next = an;
+    an->prev = a2;
+
+    b2->next = a2;
+    a2->prev = b2;
+
+    bp->next = b2;
+    b2->prev = bp;
+
+    return b2;
+}
+
+/* private */
+void
+PolygonEarClipper::clipEars(Node* start, int pass)
+{
+    if (start == nullptr) {
+        return;
+    }
+    /**
+    * The index is rebuilt for each pass,
+    * since the fallback passes can make convex vertices reflex.
+    */
+    if (isHashed) {
+        indexCurve(start);
+    }
+
+    // a vertex of the remaining ring
+    Node* ringNode = start;
+    Node* ear = linkCandidates(start);
+    Node* stop = ear;
+    while (ear != nullptr) {
+        if (ear->prev == ear->next) {
+            return;
+        }
+        if (isHashed ? isEarHashed(ear) : isEar(ear)) {
+            ringNode = ear->next;
+            ear = clipEar(ear);
+            stop = ear;
+            continue;
+        }
+        ear = ear->nextCand;
+        if (ear == stop) {
+            break;
+        }
+    }
+    if (ringNode->prev == ringNode->next) {
+        return;
+    }
+
+    /**
+    * No ear was found in a full traversal,
+    * so the ring is degenerate or self-intersecting.
+    */
+    if (pass == 0) {
+        clipEars(filterPoints(ringNode, nullptr, true), 1);
+    }
+    else if (pass == 1) {
+        Node* cured = cureLocalIntersections(filterPoints(ringNode, nullptr, true));
+        clipEars(cured, 2);
+    }
+    else if (pass == 2) {
+        splitClipEars(ringNode);
+    }
+}
+
+/* private */
+PolygonEarClipper::Node*
+PolygonEarClipper::linkCandidates(Node* start)
+{
+    Node* first = nullptr;
+    Node* last = nullptr;
+    Node* p = start;
+    do {
+        p->isCand = isConvex(p);
+        if (p->isCand) {
+            if (first == nullptr) {
+                first = p;
+            }
+            else {
+                last->nextCand = p;
+                p->prevCand = last;
+            }
+            last = p;
+        }
+        p = p->next;
+    }
+    while (p != start);
+
+    if (first != nullptr) {
+        last->nextCand = first;
+        first->prevCand = last;
+    }
+    return first;
+}
+
+/* private */
+PolygonEarClipper::Node*
+PolygonEarClipper::clipEar(Node* ear)
+{
+    Node* prev = ear->prev;
+    Node* next = ear->next;
+    addTriangle(prev, ear, next);
+    removeNode(ear);
+
+    // the neighbours may have become convex
+    if (! prev->isCand && isConvex(prev)) {
+        unindex(prev);
+        prev->isCand = true;
+        prev->prevCand = ear->prevCand;
+        prev->nextCand = ear;
+        ear->prevCand->nextCand = prev;
+        ear->prevCand = prev;
+    }
+    if (! next->isCand && isConvex(next)) {
+        unindex(next);
+        next->isCand = true;
+        next->nextCand = ear->nextCand;
+        next->prevCand = ear;
+        ear->nextCand->prevCand = next;
+        ear->nextCand = next;
+    }
+
+    // skipping the next vertex produces fewer sliver triangles
+    Node* following = ear->nextCand;
+    if (following == next) {
+        following = next->nextCand;
+    }
+
+    // remove the ear from the candidates
+    ear->isCand = false;
+    if (ear->nextCand == ear) {
+        return nullptr;
+    }
+    ear->prevCand->nextCand = ear->nextCand;
+    ear->nextCand->prevCand = ear->prevCand;
+    if (following == ear) {
+        following = ear->nextCand;
+    }
+    return following;
+}
+
+/* private */
+bool
+PolygonEarClipper::isEar(const Node* ear) const
+{
+    const Node* a = ear->prev;
+    const Node* c = ear->next;
+    if (! isConvex(ear)) {
+        return false;
+    }
+
+    // check that no reflex vertex lies inside the ear
+    Envelope triEnv(a->p, c->p);
+    triEnv.expandToInclude(ear->p);
+    const Node* p = c->next;
+    while (p != a) {
+        if (triEnv.contains(p->p)
+                && ! p->p.equals2D(a->p)
+                && isInTriangle(a->p, ear->p, c->p, p->p)
+                && ! isConvex(p)) {
+            return false;
+        }
+        p = p->next;
+    }
+    return true;
+}
+
+/* private */
+bool
+PolygonEarClipper::isEarHashed(const Node* ear)
+{
+    const Node* a = ear->prev;
+    const Node* c = ear->next;
+    if (! isConvex(ear)) {
+        return false;
+    }
+
+    Envelope triEnv(a->p, c->p);
+    triEnv.expandToInclude(ear->p);
+
+    // the z-order range of the ear envelope
+    uint32_t minZ = zOrder(triEnv.getMinX(), triEnv.getMinY());
+    uint32_t maxZ = zOrder(triEnv.getMaxX(), triEnv.getMaxY());
+
+    // scan the index entries in the z-order range, skipping those outside the envelope
+    auto it = std::lower_bound(zKeys.begin(), zKeys.end(), minZ);
+    std::size_t i = findIndexEntry(static_cast<std::size_t>(it - zKeys.begin()));
+    while (i < zKeys.size() && zKeys[i] <= maxZ) {
+        uint32_t z = zKeys[i];
+        if (! isInZBox(z, minZ, maxZ)) {
+            uint32_t zNext = nextZInBox(z, minZ, maxZ);
+            it = std::lower_bound(zKeys.begin() + static_cast<std::ptrdiff_t>(i) + 1, zKeys.end(), zNext);
+            i = findIndexEntry(static_cast<std::size_t>(it - zKeys.begin()));
+            continue;
+        }
+        const Node* n = zNodes[i];
+        if (n != a && n != c
+                && triEnv.contains(n->p)
+                && ! n->p.equals2D(a->p)
+                && isInTriangle(a->p, ear->p, c->p, n->p)
+                && ! isConvex(n)) {
+            return false;
+        }
+        i = findIndexEntry(i + 1);
+    }
+    return true;
+}
+
+/* private */
+PolygonEarClipper::Node*
+PolygonEarClipper::cureLocalIntersections(Node* start)
+{
+    if (start == nullptr) {
+        return start;
+    }
+    Node* p = start;
+    do {
+        Node* a = p->prev;
+        Node* b = p->next->next;
+
+        if (! a->p.equals2D(b->p) && intersects(a, p, p->next, b)
+                && isLocallyInside(a, b) && isLocallyInside(b, a)) {
+            addTriangle(a, p, b);
+            removeNode(p);
+            removeNode(p->next);
+            p = start = b;
+        }
+        p = p->next;
+    }
+    while (p != start);
+    return filterPoints(p, nullptr, true);
+}
+
+/* private */
+void
+PolygonEarClipper::splitClipEars(Node* start)
+{
+    if (start == nullptr) {
+        return;
+    }
+    // look for a valid diagonal that divides the polygon into two
+    Node* a = start;
+    do {
+        Node* b = a->next->next;
+        while (b != a->prev) {
+            if (! a->p.equals2D(b->p) && isValidDiagonal(a, b)) {
+                Node* c = splitPolygon(a, b);
+                a = filterPoints(a, a->next, true);
+                c = filterPoints(c, c->next, true);
+                clipEars(a, 0);
+                clipEars(c, 0);
+                return;
+            }
+            b = b->next;
+        }
+        a = a->next;
+    }
+    while (a != start);
+}
+
+/* private */
+void
+PolygonEarClipper::indexCurve(Node* start)
+{
+    std::vector<std::pair<uint32_t, Node*>> entries;
+    Node* p = start;
+    do {
+        p->zIndex = NONE;
+        if (! isConvex(p)) {
+            entries.emplace_back(zOrder(p->p.x, p->p.y), p);
+        }
+        p = p->next;
+    }
+    while (p != start);
+
+    std::sort(entries.begin(), entries.end(), [](const std::pair<uint32_t, Node*>& e1,
+              const std::pair<uint32_t, Node*>& e2) {
+        return e1.first < e2.first;
+    });
+
+    for (Node* n : zNodes) {
+        n->zIndex = NONE;
+    }
+    zKeys.clear();
+    zNodes.clear();
+    zNextEntry.clear();
+    for (const auto& e : entries) {
+        e.second->zIndex = zNodes.size();
+        zNextEntry.push_back(zNodes.size());
+        zKeys.push_back(e.first);
+        zNodes.push_back(e.second);
+    }
+    // a sentinel for the end of the index
+    zNextEntry.push_back(zNodes.size());
+}
+
+/* private */
+void
+PolygonEarClipper::unindex(Node* n)
+{
+    if (n->zIndex == NONE) {
+        return;
+    }
+    zNextEntry[n->zIndex] = n->zIndex + 1;
+    n->zIndex = NONE;
+}
+
+/* private */
+std::size_t
+PolygonEarClipper::findIndexEntry(std::size_t i)
+{
+    std::size_t entry = i;
+    while (zNextEntry[entry] != entry) {
+        entry = zNextEntry[entry];
+    }
+    // compress the path, so deleted runs are skipped quickly
+    while (i != entry) {
+        std::size_t next = zNextEntry[i];
+        zNextEntry[i] = entry;
+        i = next;
+    }
+    return entry;
+}
+
+/* private */
+uint32_t
+PolygonEarClipper::zOrder(double x, double y) const
+{
+    // clamping keeps the order monotonic for vertices outside the shell envelope
+    double zx = std::max(0.0, std::min(Z_ORDER_MAX, (x - minX) * invSize));
+    double zy = std::max(0.0, std::min(Z_ORDER_MAX, (y - minY) * invSize));
+    return MortonCode::encode(static_cast<int>(zx), static_cast<int>(zy));
+}
+
+/* private */
+void
+PolygonEarClipper::addTriangle(const Node* a, const Node* b, const Node* c)
+{
+    triangles->emplace_back(a->p, b->p, c->p);
+}
+
+/* private static */
+PolygonEarClipper::Node*
+PolygonEarClipper::getLeftmost(Node* start)
+{
+    Node* p = start;
+    Node* leftmost = start;
+    do {
+        if (p->p.x < leftmost->p.x || (p->p.x == leftmost->p.x && p->p.y < leftmost->p.y)) {
+            leftmost = p;
+        }
+        p = p->next;
+    }
+    while (p != start);
+    return leftmost;
+}
+
+/* private static */
+int
+PolygonEarClipper::orientation(const Node* a, const Node* b, const Node* c)
+{
+    return Orientation::index(a->p, b->p, c->p);
+}
+
+/* private static */
+bool
+PolygonEarClipper::isConvex(const Node* n)
+{
+    return orientation(n->prev, n, n->next) == Orientation::COUNTERCLOCKWISE;
+}
+
+/* private static */
+bool
+PolygonEarClipper::isInTriangle(const Coordinate& a, const Coordinate& b,
+                                const Coordinate& c, const Coordinate& p)
+{
+    int o1 = Orientation::index(a, b, p);
+    int o2 = Orientation::index(b, c, p);
+    int o3 = Orientation::index(c, a, p);
+    bool hasCW = o1 == Orientation::CLOCKWISE || o2 == Orientation::CLOCKWISE || o3 == Orientation::CLOCKWISE;
+    bool hasCCW = o1 == Orientation::COUNTERCLOCKWISE || o2 == Orientation::COUNTERCLOCKWISE
+                  || o3 == Orientation::COUNTERCLOCKWISE;
+    return ! (hasCW && hasCCW);
+}
+
+/* Tests if q lies in the envelope of the collinear points p and r */
+static bool
+isOnSegment(const Coordinate& p, const Coordinate& q, const Coordinate& r)
+{
+    return q.x <= std::max(p.x, r.x) && q.x >= std::min(p.x, r.x)
+           && q.y <= std::max(p.y, r.y) && q.y >= std::min(p.y, r.y);
+}
+
+/* private static */
+bool
+PolygonEarClipper::intersects(const Node* p1, const Node* q1, const Node* p2, const Node* q2)
+{
+    int o1 = orientation(p1, q1, p2);
+    int o2 = orientation(p1, q1, q2);
+    int o3 = orientation(p2, q2, p1);
+    int o4 = orientation(p2, q2, q1);
+
+    if (o1 != o2 && o3 != o4) {
+        return true;
+    }
+    if (o1 == Orientation::COLLINEAR && isOnSegment(p1->p, p2->p, q1->p)) {
+        return true;
+    }
+    if (o2 == Orientation::COLLINEAR && isOnSegment(p1->p, q2->p, q1->p)) {
+        return true;
+    }
+    if (o3 == Orientation::COLLINEAR && isOnSegment(p2->p, p1->p, q2->p)) {
+        return true;
+    }
+    if (o4 == Orientation::COLLINEAR && isOnSegment(p2->p, q1->p, q2->p)) {
+        return true;
+    }
+    return false;
+}
+
+/* private static */
+bool
+PolygonEarClipper::intersectsPolygon(const Node* a, const Node* b)
+{
+    const Node* p = a;
+    do {
+        if (! p->p.equals2D(a->p) && ! p->next->p.equals2D(a->p)
+                && ! p->p.equals2D(b->p) && ! p->next->p.equals2D(b->p)
+                && intersects(p, p->next, a, b)) {
+            return true;
+        }
+        p = p->next;
+    }
+    while (p != a);
+    return false;
+}
+
+/* private static */
+bool
+PolygonEarClipper::isLocallyInside(const Node* a, const Node* b)
+{
+    if (isConvex(a)) {
+        return orientation(a, b, a->next) != Orientation::COUNTERCLOCKWISE
+               && orientation(a, a->prev, b) != Orientation::COUNTERCLOCKWISE;
+    }
+    return orientation(a, b, a->prev) == Orientation::COUNTERCLOCKWISE
+           || orientation(a, a->next, b) == Orientation::COUNTERCLOCKWISE;
+}
+
+/* private static */
+bool
+PolygonEarClipper::isMiddleInside(const Node* a, const Node* b)
+{
+    const Node* p = a;
+    bool isInside = false;
+    double px = (a->p.x + b->p.x) / 2;
+    double py = (a->p.y + b->p.y) / 2;
+    do {
+        const Coordinate& p0 = p->p;
+        const Coordinate& p1 = p->next->p;
+        if (((p0.y > py) != (p1.y > py)) && p1.y != p0.y
+                && (px < (p1.x - p0.x) * (py - p0.y) / (p1.y - p0.y) + p0.x)) {
+            isInside = ! isInside;
+        }
+        p = p->next;
+    }
+    while (p != a);
+    return isInside;
+}
+
+/* private static */
+bool
+PolygonEarClipper::isValidDiagonal(const Node* a, const Node* b)
+{
+    if (a->next->p.equals2D(b->p) || a->prev->p.equals2D(b->p) || intersectsPolygon(a, b)) {
+        return false;
+    }
+    bool isVisible = isLocallyInside(a, b) && isLocallyInside(b, a) && isMiddleInside(a, b)
+                     // does not create opposite-facing sectors
+                     && (orientation(a->prev, a, b->prev) != Orientation::COLLINEAR
+                         || orientation(a, b->prev, b) != Orientation::COLLINEAR);
+    // a zero-length diagonal between two reflex vertices
+    bool isZeroLength = a->p.equals2D(b->p)
+                        && orientation(a->prev, a, a->next) == Orientation::CLOCKWISE
+                        && orientation(b->prev, b, b->next) == Orientation::CLOCKWISE;
+    return isVisible || isZeroLength;
+}
+
+/* private static */
+bool
+PolygonEarClipper::sectorContainsSector(const Node* m, const Node* p)
+{
+    return orientation(m->prev, m, p->prev) == Orientation::COUNTERCLOCKWISE
+           && orientation(p->next, m, m->next) == Orientation::COUNTERCLOCKWISE;
+}
+
+} //namespace geos.triangulate.polygon
+} //namespace geos.triangulate
+} //namespace geos
@@ -0,0 +1,76 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/polygon/PolygonTriangulator.h>
+#include <geos/triangulate/polygon/PolygonEarClipper.h>
+
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/Triangle.h>
+#include <geos/geom/util/PolygonExtracter.h>
+#include <geos/util.h>
+
+#include <vector>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace polygon { //geos.triangulate.polygon
+
+/* public static */
+std::unique_ptr<Geometry>
+PolygonTriangulator::triangulate(const Geometry* geom)
+{
+    PolygonTriangulator triangulator(geom);
+    return triangulator.getResult();
+}
+
+/* public */
+PolygonTriangulator::PolygonTriangulator(const Geometry* p_inputGeom)
+    : inputGeom(p_inputGeom)
+    , geomFact(p_inputGeom->getFactory())
+{}
+
+/* public */
+std::unique_ptr<Geometry>
+PolygonTriangulator::getResult()
+{
+    std::vector<const Polygon*> polys;
+    geom::util::PolygonExtracter::getPolygons(*inputGeom, polys);
+
+    std::vector<Triangle> triList;
+    for (const Polygon* poly : polys) {
+        PolygonEarClipper clipper(*poly);
+        clipper.compute(triList);
+    }
+
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    geoms.reserve(triList.size());
+    for (const Triangle& tri : triList) {
+        auto coords = detail::make_unique<CoordinateArraySequence>(4u);
+        coords->setAt(tri.p0, 0);
+        coords->setAt(tri.p1, 1);
+        coords->setAt(tri.p2, 2);
+        coords->setAt(tri.p0, 3);
+        geoms.emplace_back(geomFact->createPolygon(geomFact->createLinearRing(std::move(coords))));
+    }
+    return geomFact->createGeometryCollection(std::move(geoms));
+}
+
+} //namespace geos.triangulate.polygon
+} //namespace geos.triangulate
+} //namespace geos
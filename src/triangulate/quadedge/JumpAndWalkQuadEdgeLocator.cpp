@@ -0,0 +1,155 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/quadedge/JumpAndWalkQuadEdgeLocator.h>
+#include <geos/triangulate/quadedge/QuadEdge.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace quadedge { //geos.triangulate.quadedge
+
+constexpr std::size_t JumpAndWalkQuadEdgeLocator::MAX_WALK_STEPS;
+constexpr std::size_t JumpAndWalkQuadEdgeLocator::VERTICES_PER_CELL;
+
+JumpAndWalkQuadEdgeLocator::JumpAndWalkQuadEdgeLocator(QuadEdgeSubdivision* p_subdiv,
+        const geom::Envelope& env, std::size_t numVertices) :
+    subdiv(p_subdiv),
+    lastEdge(nullptr),
+    gridEnv(env),
+    numCols(1),
+    numRows(1),
+    cellWidth(0.0),
+    cellHeight(0.0),
+    locateCount(0),
+    stepCount(0),
+    restartCount(0)
+{
+    std::size_t numCells = numVertices / VERTICES_PER_CELL;
+
+    // choose roughly square cells
+    if (!gridEnv.isNull() && numCells > 1) {
+        double width = gridEnv.getWidth();
+        double height = gridEnv.getHeight();
+        if (width > 0 && height > 0) {
+            double cellSize = std::sqrt(width * height / static_cast<double>(numCells));
+            // clamp for very narrow extents
+            numCols = std::min(numCells, static_cast<std::size_t>(std::ceil(width / cellSize)));
+            numRows = std::min(numCells, static_cast<std::size_t>(std::ceil(height / cellSize)));
+        }
+        else if (width > 0) {
+            numCols = numCells;
+        }
+        else if (height > 0) {
+            numRows = numCells;
+        }
+        cellWidth = width / static_cast<double>(numCols);
+        cellHeight = height / static_cast<double>(numRows);
+    }
+    cellEdge.assign(numCols * numRows, nullptr);
+}
+
+void
+JumpAndWalkQuadEdgeLocator::resetCounts()
+{
+    locateCount = 0;
+    stepCount = 0;
+    restartCount = 0;
+}
+
+std::size_t
+JumpAndWalkQuadEdgeLocator::cellIndex(const Vertex& v) const
+{
+    std::size_t col = 0;
+    std::size_t row = 0;
+    if (cellWidth > 0) {
+        double x = std::floor((v.getX() - gridEnv.getMinX()) / cellWidth);
+        col = static_cast<std::size_t>(std::min(std::max(x, 0.0), static_cast<double>(numCols - 1)));
+    }
+    if (cellHeight > 0) {
+        double y = std::floor((v.getY() - gridEnv.getMinY()) / cellHeight);
+        row = static_cast<std::size_t>(std::min(std::max(y, 0.0), static_cast<double>(numRows - 1)));
+    }
+    return row * numCols + col;
+}
+
+QuadEdge*
+JumpAndWalkQuadEdgeLocator::startEdge(std::size_t cell)
+{
+    QuadEdge* e = cellEdge[cell];
+    if (e && e->isLive()) {
+        return e;
+    }
+    if (lastEdge && lastEdge->isLive()) {
+        return lastEdge;
+    }
+    return frameEdge();
+}
+
+QuadEdge*
+JumpAndWalkQuadEdgeLocator::frameEdge() const
+{
+    // The first edge of the subdivision is an edge of its frame,
+    // which is never deleted
+    return &(subdiv->getEdges()[0].base());
+}
+
+QuadEdge*
+JumpAndWalkQuadEdgeLocator::walk(const Vertex& v, QuadEdge* e)
+{
+    for (std::size_t steps = 0; steps < MAX_WALK_STEPS; steps++) {
+        if ((v.equals(e->orig())) || (v.equals(e->dest()))) {
+            return e;
+        }
+        else if (v.rightOf(*e)) {
+            e = &e->sym();
+        }
+        else if (!v.rightOf(e->oNext())) {
+            e = &e->oNext();
+        }
+        else if (!v.rightOf(e->dPrev())) {
+            e = &e->dPrev();
+        }
+        else {
+            // on edge or in triangle containing edge
+            return e;
+        }
+        stepCount++;
+    }
+    return nullptr;
+}
+
+QuadEdge*
+JumpAndWalkQuadEdgeLocator::locate(const Vertex& v)
+{
+    locateCount++;
+    std::size_t cell = cellIndex(v);
+
+    QuadEdge* start = startEdge(cell);
+    QuadEdge* e = walk(v, start);
+    if (!e) {
+        // the walk from the cached edge cycled, so restart from the frame
+        restartCount++;
+        e = subdiv->locateFromEdge(v, *frameEdge());
+    }
+
+    lastEdge = e;
+    cellEdge[cell] = e;
+    return e;
+}
+
+} //namespace geos.triangulate.quadedge
+} //namespace geos.triangulate
+} //namespace goes
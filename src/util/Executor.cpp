@@ -0,0 +1,227 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/Executor.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace geos {
+namespace util { // geos::util
+
+namespace {
+
+/*
+ * The state of a parallelFor loop, shared by the calling thread
+ * and the helper tasks. It lives on the stack of the calling thread,
+ * which waits for all helper tasks to finish before returning.
+ */
+struct LoopState {
+    std::size_t n;
+    std::size_t chunkSize;
+    std::size_t numChunks;
+    const Executor::RangeFunction& f;
+
+    std::atomic<std::size_t> nextChunk;
+    std::atomic<bool> failed;
+
+    std::mutex mutex;
+    std::condition_variable helpersDone;
+    std::size_t activeHelpers;      // guarded by mutex
+    std::exception_ptr error;       // guarded by mutex
+
+    LoopState(std::size_t p_n, std::size_t p_chunkSize, const Executor::RangeFunction& p_f)
+        : n(p_n)
+        , chunkSize(p_chunkSize)
+        , numChunks((p_n + p_chunkSize - 1) / p_chunkSize)
+        , f(p_f)
+        , nextChunk(0)
+        , failed(false)
+        , activeHelpers(0)
+    {}
+
+    void
+    run()
+    {
+        while(!failed) {
+            std::size_t chunk = nextChunk.fetch_add(1);
+            if(chunk >= numChunks) {
+                return;
+            }
+            std::size_t begin = chunk * chunkSize;
+            std::size_t end = std::min(n, begin + chunkSize);
+            try {
+                f(begin, end);
+            }
+            catch(...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(!error) {
+                    error = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+    }
+};
+
+} // anonymous namespace
+
+Executor::Executor(std::size_t numThreads)
+    : stopping(false)
+{
+    if(numThreads == 0) {
+        numThreads = getHardwareConcurrency();
+    }
+    try {
+        for(std::size_t i = 1; i < numThreads; i++) {
+            workers.emplace_back(&Executor::workerLoop, this);
+        }
+    }
+    catch(...) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        taskAvailable.notify_all();
+        for(std::thread& worker : workers) {
+            worker.join();
+        }
+        throw;
+    }
+}
+
+Executor::~Executor()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+    for(std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+/* public static */
+std::size_t
+Executor::getHardwareConcurrency()
+{
+    unsigned int n = std::thread::hardware_concurrency();
+    return n > 0 ? n : 1;
+}
+
+/* public */
+void
+Executor::parallelFor(std::size_t n, std::size_t grainSize, const RangeFunction& f,
+                      std::size_t maxThreads)
+{
+    if(n == 0) {
+        return;
+    }
+    grainSize = std::max<std::size_t>(grainSize, 1);
+
+    std::size_t numThreads = getNumThreads();
+    if(maxThreads > 0) {
+        numThreads = std::min(numThreads, maxThreads);
+    }
+    if(numThreads <= 1 || n < 2 * grainSize) {
+        f(0, n);
+        return;
+    }
+
+    // A few ranges per thread balance the load when items have uneven costs
+    std::size_t chunkSize = std::max(grainSize, (n + 4 * numThreads - 1) / (4 * numThreads));
+    LoopState state(n, chunkSize, f);
+    std::size_t numHelpers = std::min(numThreads, state.numChunks) - 1;
+
+    state.activeHelpers = numHelpers;
+    for(std::size_t i = 0; i < numHelpers; i++) {
+        submit([&state]() {
+            state.run();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if(--state.activeHelpers == 0) {
+                state.helpersDone.notify_all();
+            }
+        });
+    }
+
+    state.run();
+
+    // Helpers still in the queue are run here, so that a loop nested
+    // in a worker thread cannot wait for tasks that no thread will run.
+    std::unique_lock<std::mutex> lock(state.mutex);
+    while(state.activeHelpers > 0) {
+        lock.unlock();
+        bool ranTask = runPendingTask();
+        lock.lock();
+        if(!ranTask && state.activeHelpers > 0) {
+            state.helpersDone.wait(lock);
+        }
+    }
+
+    if(state.error) {
+        std::rethrow_exception(state.error);
+    }
+}
+
+/* private */
+void
+Executor::submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    taskAvailable.notify_one();
+}
+
+/* private */
+bool
+Executor::runPendingTask()
+{
+    std::function<void()> task;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(tasks.empty()) {
+            return false;
+        }
+        task = std::move(tasks.front());
+        tasks.pop_front();
+    }
+    task();
+    return true;
+}
+
+/* private */
+void
+Executor::workerLoop()
+{
+    for(;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            taskAvailable.wait(lock, [this]() {
+                return stopping || !tasks.empty();
+            });
+            if(tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+} // namespace geos::util
+} // namespace geos
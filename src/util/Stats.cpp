@@ -0,0 +1,174 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/Stats.h>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace geos {
+namespace util { // geos::util
+
+std::atomic<bool> Stats::enabled(false);
+
+namespace {
+
+/*
+ * The counters of one thread. They are written only by their thread,
+ * with relaxed loads and stores, and read by any thread.
+ */
+struct ThreadCounters {
+    std::atomic<uint64_t> counts[Stats::NUM_STAGES];
+    std::atomic<uint64_t> nanoseconds[Stats::NUM_STAGES];
+
+    ThreadCounters();
+    ~ThreadCounters();
+
+    void
+    add(Stats::Stage stage, uint64_t ns)
+    {
+        std::size_t i = static_cast<std::size_t>(stage);
+        counts[i].store(counts[i].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        nanoseconds[i].store(nanoseconds[i].load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+    }
+};
+
+/*
+ * The counters of all live threads, and the totals of finished threads.
+ * A reset records the current totals as a baseline, so that threads
+ * never have their counters written by another thread.
+ */
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadCounters*> threads;
+    Stats::Snapshot finished;
+    Stats::Snapshot baseline;
+
+    Registry()
+        : finished()
+        , baseline()
+    {}
+
+    // Sums the counters of all threads; the mutex must be held
+    Stats::Snapshot
+    total() const
+    {
+        Stats::Snapshot sum = finished;
+        for(const ThreadCounters* tc : threads) {
+            for(std::size_t i = 0; i < Stats::NUM_STAGES; i++) {
+                sum.counts[i] += tc->counts[i].load(std::memory_order_relaxed);
+                sum.nanoseconds[i] += tc->nanoseconds[i].load(std::memory_order_relaxed);
+            }
+        }
+        return sum;
+    }
+};
+
+// Never destroyed, since threads may finish during static destruction
+Registry&
+registry()
+{
+    static Registry* reg = new Registry();
+    return *reg;
+}
+
+ThreadCounters::ThreadCounters()
+{
+    for(std::size_t i = 0; i < Stats::NUM_STAGES; i++) {
+        counts[i].store(0, std::memory_order_relaxed);
+        nanoseconds[i].store(0, std::memory_order_relaxed);
+    }
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.threads.push_back(this);
+}
+
+ThreadCounters::~ThreadCounters()
+{
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for(std::size_t i = 0; i < Stats::NUM_STAGES; i++) {
+        reg.finished.counts[i] += counts[i].load(std::memory_order_relaxed);
+        reg.finished.nanoseconds[i] += nanoseconds[i].load(std::memory_order_relaxed);
+    }
+    reg.threads.erase(std::find(reg.threads.begin(), reg.threads.end(), this));
+}
+
+} // anonymous namespace
+
+/* public static */
+bool
+Stats::setEnabled(bool isEnabled)
+{
+    return enabled.exchange(isEnabled);
+}
+
+/* private static */
+void
+Stats::record(Stage stage, uint64_t nanoseconds)
+{
+    static thread_local ThreadCounters counters;
+    counters.add(stage, nanoseconds);
+}
+
+/* public static */
+Stats::Snapshot
+Stats::getSnapshot()
+{
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    Snapshot snapshot = reg.total();
+    for(std::size_t i = 0; i < NUM_STAGES; i++) {
+        snapshot.counts[i] -= reg.baseline.counts[i];
+        snapshot.nanoseconds[i] -= reg.baseline.nanoseconds[i];
+    }
+    return snapshot;
+}
+
+/* public static */
+void
+Stats::reset()
+{
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.baseline = reg.total();
+}
+
+/* public static */
+const char*
+Stats::getStageName(Stage stage)
+{
+    switch(stage) {
+    case NODING:
+        return "noding";
+    case SNAP_ROUNDING:
+        return "snap-rounding";
+    case GRAPH_BUILD:
+        return "graph build";
+    case LABELLING:
+        return "labelling";
+    case RING_BUILDING:
+        return "ring building";
+    case INDEX_BUILD:
+        return "index build";
+    case INDEX_QUERY:
+        return "index query";
+    case ROBUSTNESS_RETRY:
+        return "robustness retry";
+    default:
+        return "unknown";
+    }
+}
+
+} // namespace geos::util
+} // namespace geos
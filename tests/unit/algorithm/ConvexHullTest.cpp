@@ -6,7 +6,9 @@
 #include <utility.h>
 // geos
 #include <geos/algorithm/ConvexHull.h>
+#include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 #include <geos/geom/LineString.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateArraySequence.h>
 #include <geos/geom/Dimension.h>
@@ -15,9 +17,13 @@
 #include <geos/geom/PrecisionModel.h>
 #include <geos/io/WKBReader.h>
 #include <geos/io/WKTReader.h>
+#include <geos/util/Executor.h>
 // std
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <memory>
+#include <random>
 #include <cassert>
 
 namespace geos {
@@ -218,5 +224,67 @@ void object::test<8>
     ensure(result != nullptr); // No crash!
 }
 
+// 9 - Test order of the points of linear hulls
+template<>
+template<>
+void object::test<9>
+()
+{
+    // two distinct points are kept in input order
+    Geometry::Ptr geom(reader_.read("MULTIPOINT (10 0, 0 0, 10 0)"));
+    ensure_equals_geometry(geom->convexHull().get(), "LINESTRING (10 0, 0 0)");
+
+    // otherwise the lowest point comes first
+    geom = reader_.read("MULTIPOINT (0 10, 5 5, 10 0, 2 8)");
+    ensure_equals_geometry(geom->convexHull().get(), "LINESTRING (10 0, 0 10)");
+
+    geom = reader_.read("MULTIPOINT (0 10, 0 5, 0 0, 0 0)");
+    ensure_equals_geometry(geom->convexHull().get(), "LINESTRING (0 0, 0 10)");
+}
+
+// 10 - Test hull of a large point cloud, computed in parallel
+template<>
+template<>
+void object::test<10>
+()
+{
+    std::vector<Coordinate> coords;
+    for(int i = 0; i < 400; i++) {
+        for(int j = 0; j < 400; j++) {
+            coords.emplace_back(i, j);
+        }
+    }
+    std::mt19937 rng(7);
+    std::shuffle(coords.begin(), coords.end(), rng);
+    auto cs = factory_->getCoordinateSequenceFactory()->create(std::move(coords));
+    auto geom = factory_->createLineString(std::move(cs));
+
+    geos::util::Executor executor(4);
+    geos::algorithm::ConvexHull parallelHull(geom.get(), &executor);
+    auto hull = parallelHull.getConvexHull();
+    ensure_equals_geometry(hull.get(), "POLYGON ((0 0, 0 399, 399 399, 399 0, 0 0))");
+
+    // cloud with a curved hull, where few points are inside the octagon
+    std::uniform_real_distribution<double> angle(0, 6.283185307179586);
+    std::vector<Coordinate> circle;
+    for(int i = 0; i < 200000; i++) {
+        double a = angle(rng);
+        circle.emplace_back(std::round(1e6 * std::cos(a)), std::round(1e6 * std::sin(a)));
+    }
+    cs = factory_->getCoordinateSequenceFactory()->create(std::move(circle));
+    geom = factory_->createLineString(std::move(cs));
+
+    geos::algorithm::ConvexHull serialHull(geom.get());
+    auto expected = serialHull.getConvexHull();
+    geos::algorithm::ConvexHull parallelCircleHull(geom.get(), &executor);
+    hull = parallelCircleHull.getConvexHull();
+    ensure(hull->equalsExact(expected.get()));
+    ensure(hull->isValid());
+    geos::algorithm::locate::IndexedPointInAreaLocator locator(*hull);
+    for(std::size_t i = 0; i < geom->getNumPoints(); i++) {
+        ensure(locator.locate(&geom->getCoordinateN(i)) != Location::EXTERIOR);
+    }
+}
+
 } // namespace tut
 
@@ -156,4 +156,55 @@ void object::test<4>
     runTest("LINESTRING (0 0, 100 0)", "LINESTRING (0 0, 50 50, 100 0)", 0.5, 50.0);
 }
 
+// 5 - testStartPoints
+//
+// The distance between the start points is included
+//
+template<>
+template<>
+void object::test<5>
+()
+{
+    runTest("LINESTRING (0 0, 10 0)", "LINESTRING (0 5, 10 0)", 5.0);
+    runTest("LINESTRING (0 5, 10 0)", "LINESTRING (0 0, 10 0)", 5.0);
+}
+
+// 6 - testLongLines
+//
+// Long lines are handled without deep recursion or a quadratic table
+//
+template<>
+template<>
+void object::test<6>
+()
+{
+    std::ostringstream wkt1, wkt2;
+    wkt1 << "LINESTRING (";
+    wkt2 << "LINESTRING (";
+    for(int i = 0; i < 3000; i++) {
+        wkt1 << (i ? ", " : "") << i << " 0";
+        wkt2 << (i ? ", " : "") << i << " " << (i == 1501 ? 4 : 1);
+    }
+    wkt1 << ")";
+    wkt2 << ", 3000 1)";
+    runTest(wkt1.str(), wkt2.str(), 4.0);
+    runTest(wkt2.str(), wkt1.str(), 4.0);
+    runTest(wkt1.str(), wkt2.str(), 0.5, 4.0);
+}
+
+// 7 - testEmpty
+template<>
+template<>
+void object::test<7>
+()
+{
+    try {
+        runTest("LINESTRING (0 0, 2 1)", "LINESTRING EMPTY", 0.0);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException& ) {
+        // We do expect an exception
+    }
+}
+
 } // namespace tut
@@ -12,6 +12,7 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h> // required for use in unique_ptr
 #include <geos/geom/Coordinate.h>
+#include <geos/util/Executor.h>
 // std
 #include <cmath>
 #include <sstream>
@@ -157,5 +158,73 @@ void object::test<4>
     runTest("LINESTRING (130 0, 0 0, 0 150)", "LINESTRING (10 10, 10 150, 130 10)", 0.5, 70.0);
 }
 
-} // namespace tut
+// 5 - testPolygonWithHole
+//
+// Distances are measured to the polygon boundary, including holes
+//
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::string poly("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 3 2, 3 3, 2 2))");
+    runTest("MULTIPOINT ((0 0), (5 5))", poly, 7.0710678118654755);
+}
+
+// 6 - testLongLines
+//
+// Many vertices close to the other line do not hide a single distant one
+//
+template<>
+template<>
+void object::test<6>
+()
+{
+    std::ostringstream wkt1, wkt2;
+    wkt1 << "LINESTRING (";
+    wkt2 << "LINESTRING (";
+    for(int i = 0; i < 5000; i++) {
+        wkt1 << (i ? ", " : "") << i << " " << (i == 3001 ? 7 : 0);
+        wkt2 << (i ? ", " : "") << i << " 1";
+    }
+    wkt1 << ")";
+    wkt2 << ")";
+    runTest(wkt1.str(), wkt2.str(), 6.0);
+    runTest(wkt2.str(), wkt1.str(), 6.0);
+}
 
+// Searching the points in several threads gives the serial result
+template<>
+template<>
+void object::test<7>
+()
+{
+    std::ostringstream wkt1, wkt2;
+    wkt1 << "LINESTRING (";
+    wkt2 << "LINESTRING (";
+    for(std::size_t i = 0; i < 20000; i++) {
+        wkt1 << (i ? ", " : "") << i << " " << (i % 7 == 0 ? 3 : 0) + (i == 15001 ? 4 : 0);
+        wkt2 << (i ? ", " : "") << i << " " << (i % 5 == 0 ? -2 : 1);
+    }
+    wkt1 << ")";
+    wkt2 << ")";
+    GeomPtr g1(reader.read(wkt1.str()));
+    GeomPtr g2(reader.read(wkt2.str()));
+
+    geos::util::Executor executor(4);
+    for(double densifyFrac : { 0.0, 0.25 }) {
+        DiscreteHausdorffDistance serial(*g1, *g2);
+        DiscreteHausdorffDistance parallel(*g1, *g2);
+        if(densifyFrac > 0) {
+            serial.setDensifyFraction(densifyFrac);
+            parallel.setDensifyFraction(densifyFrac);
+        }
+        parallel.setExecutor(&executor);
+
+        ensure_equals(parallel.distance(), serial.distance());
+        ensure_equals(parallel.getCoordinates()[0], serial.getCoordinates()[0]);
+        ensure_equals(parallel.getCoordinates()[1], serial.getCoordinates()[1]);
+    }
+}
+
+} // namespace tut
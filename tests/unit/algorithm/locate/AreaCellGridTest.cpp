@@ -0,0 +1,168 @@
+//
+// Test Suite for geos::algorithm::locate::AreaCellGrid
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/algorithm/locate/AreaCellGrid.h>
+#include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Location.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <limits>
+#include <memory>
+#include <string>
+
+using geos::algorithm::locate::AreaCellGrid;
+using geos::algorithm::locate::IndexedPointInAreaLocator;
+using geos::geom::Coordinate;
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::Location;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_areacellgrid_data {
+    geos::geom::GeometryFactory::Ptr factory_;
+    geos::io::WKTReader reader_;
+
+    test_areacellgrid_data()
+        : factory_(geos::geom::GeometryFactory::create())
+        , reader_(factory_.get())
+    {}
+
+    // Checks the location of envelopes of a given size over the area,
+    // and returns the number of envelopes located by the grid.
+    std::size_t
+    checkEnvelopes(const Geometry& area, const AreaCellGrid& grid, double size, double step)
+    {
+        std::unique_ptr<Geometry> boundary = area.getBoundary();
+        const Envelope* areaEnv = area.getEnvelopeInternal();
+        std::size_t numLocated = 0;
+        for(double x = areaEnv->getMinX() - 1; x <= areaEnv->getMaxX() + 1; x += step) {
+            for(double y = areaEnv->getMinY() - 1; y <= areaEnv->getMaxY() + 1; y += step) {
+                Envelope env(x, x + size, y, y + size);
+                std::unique_ptr<Geometry> envGeom = factory_->toGeometry(&env);
+                Location loc = grid.locate(env);
+                if(loc == Location::INTERIOR) {
+                    ensure(area.covers(envGeom.get()));
+                    ensure(!boundary->intersects(envGeom.get()));
+                    numLocated++;
+                }
+                else if(loc == Location::EXTERIOR) {
+                    ensure(!area.intersects(envGeom.get()));
+                    numLocated++;
+                }
+                else {
+                    ensure_equals(loc, Location::BOUNDARY);
+                }
+            }
+        }
+        return numLocated;
+    }
+};
+
+typedef test_group<test_areacellgrid_data> group;
+typedef group::object object;
+
+group test_areacellgrid_group("geos::algorithm::locate::AreaCellGrid");
+
+//
+// Test Cases
+//
+
+// Polygon with a hole, small and large envelopes
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::unique_ptr<Geometry> g = reader_.read(
+        "POLYGON ((0 0, 0 10, 4 5, 6 10, 7 5, 9 10, 10 5, 13 5, 15 10, 16 3, 17 10, 18 3, 25 10, 30 10, 30 0, 0 0),"
+        " (20 2, 20 4, 24 4, 24 2, 20 2))");
+    IndexedPointInAreaLocator locator(*g);
+    AreaCellGrid grid(*g, locator, 64, 1 << 20);
+    ensure_equals(grid.getResolution(), 64u);
+
+    ensure(checkEnvelopes(*g, grid, 0, 0.25) > 0);
+    ensure(checkEnvelopes(*g, grid, 0.3, 0.5) > 0);
+    ensure(checkEnvelopes(*g, grid, 3, 0.7) > 0);
+}
+
+// MultiPolygon with long diagonal edges
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::unique_ptr<Geometry> g = reader_.read(
+        "MULTIPOLYGON (((0 0, 100 90, 100 0, 0 0)), ((0 10, 0 100, 90 100, 0 10)))");
+    IndexedPointInAreaLocator locator(*g);
+    AreaCellGrid grid(*g, locator, 100, 1 << 20);
+    ensure_equals(grid.getResolution(), 128u);
+
+    ensure(checkEnvelopes(*g, grid, 0, 1.5) > 0);
+    ensure(checkEnvelopes(*g, grid, 2, 3.5) > 0);
+
+    // cells along the diagonals are not all marked as crossed
+    ensure_equals(grid.locate(Coordinate(90, 10)), Location::INTERIOR);
+    ensure_equals(grid.locate(Coordinate(50, 50)), Location::EXTERIOR);
+    ensure_equals(grid.locate(Coordinate(200, 50)), Location::EXTERIOR);
+}
+
+// The resolution is reduced to fit the memory budget
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::unique_ptr<Geometry> g = reader_.read("POLYGON ((0 0, 10 0, 5 10, 0 0))");
+    IndexedPointInAreaLocator locator(*g);
+    AreaCellGrid grid(*g, locator, 1000, 100000);
+    ensure_equals(grid.getResolution(), 256u);
+    ensure(grid.getMemorySize() <= 100000u);
+
+    ensure(checkEnvelopes(*g, grid, 0.1, 0.3) > 0);
+}
+
+// Degenerate areas and empty envelopes are never located
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::unique_ptr<Geometry> g = reader_.read("POLYGON ((0 0, 10 0, 0 0))");
+    IndexedPointInAreaLocator locator(*g);
+    AreaCellGrid grid(*g, locator, 16, 1 << 20);
+    ensure_equals(grid.locate(Coordinate(5, 0)), Location::BOUNDARY);
+    ensure_equals(grid.locate(Coordinate(5, 1)), Location::EXTERIOR);
+    ensure_equals(grid.locate(Envelope()), Location::BOUNDARY);
+}
+
+// Huge resolutions are clamped before the memory budget is applied
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::unique_ptr<Geometry> g = reader_.read("POLYGON ((0 0, 10 0, 5 10, 0 0))");
+    IndexedPointInAreaLocator locator(*g);
+    AreaCellGrid grid(*g, locator, std::numeric_limits<std::size_t>::max(), 100000);
+    ensure_equals(grid.getResolution(), 256u);
+    ensure(grid.getMemorySize() <= 100000u);
+
+    // the default grid budget of the locator bounds a huge grid size
+    IndexedPointInAreaLocator gridLocator(*g, std::numeric_limits<std::size_t>::max());
+    Coordinate inside(5, 1);
+    Coordinate outside(1, 9);
+    ensure_equals(gridLocator.locate(&inside), Location::INTERIOR);
+    ensure_equals(gridLocator.locate(&outside), Location::EXTERIOR);
+}
+
+} // namespace tut
@@ -0,0 +1,140 @@
+//
+// Test Suite for geos::algorithm::locate::IndexedPointInAreaLocator
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/algorithm/locate/SimplePointInAreaLocator.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Location.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <limits>
+#include <memory>
+#include <string>
+
+using geos::algorithm::locate::IndexedPointInAreaLocator;
+using geos::algorithm::locate::SimplePointInAreaLocator;
+using geos::geom::Coordinate;
+using geos::geom::Geometry;
+using geos::geom::Location;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_indexedpointinarealocator_data {
+    geos::geom::GeometryFactory::Ptr factory_;
+    geos::io::WKTReader reader_;
+
+    test_indexedpointinarealocator_data()
+        : factory_(geos::geom::GeometryFactory::create())
+        , reader_(factory_.get())
+    {}
+
+    // Compares the locations of the points of a lattice, many of which
+    // are on the boundary, with and without a cell grid.
+    void
+    checkLattice(const std::string& wkt, double minX, double maxX, double minY, double maxY, double step)
+    {
+        std::unique_ptr<Geometry> g = reader_.read(wkt);
+        IndexedPointInAreaLocator locator(*g);
+        IndexedPointInAreaLocator gridLocator(*g, 16);
+        for(double x = minX; x <= maxX; x += step) {
+            for(double y = minY; y <= maxY; y += step) {
+                Coordinate p(x, y);
+                Location expected = SimplePointInAreaLocator::locate(p, g.get());
+                ensure_equals(locator.locate(&p), expected);
+                ensure_equals(gridLocator.locate(&p), expected);
+            }
+        }
+    }
+};
+
+typedef test_group<test_indexedpointinarealocator_data> group;
+typedef group::object object;
+
+group test_indexedpointinarealocator_group("geos::algorithm::locate::IndexedPointInAreaLocator");
+
+//
+// Test Cases
+//
+
+// Polygon with a hole
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkLattice("POLYGON ((0 0, 0 10, 4 5, 6 10, 7 5, 9 10, 10 5, 13 5, 15 10, 16 3, 17 10, 18 3, 25 10, 30 10, 30 0, 0 0),"
+                 " (20 2, 20 4, 24 4, 24 2, 20 2))",
+                 -2, 32, -2, 12, 0.5);
+}
+
+// MultiPolygon with repeated points and a diagonal edge crossing many cells
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkLattice("MULTIPOLYGON (((0 0, 0 10, 2 5, 2 5, 2 5, 3 10, 6 10, 8 5, 8 5, 10 10, 10 0, 0 0)),"
+                 " ((12 0, 40 40, 40 0, 12 0)))",
+                 -1, 41, -1, 41, 0.5);
+}
+
+// LinearRing
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::unique_ptr<Geometry> g = reader_.read("LINEARRING (0 0, 10 0, 10 10, 0 10, 0 0)");
+    IndexedPointInAreaLocator locator(*g, 8);
+    Coordinate inside(5, 5);
+    Coordinate onBoundary(10, 3);
+    Coordinate outside(11, 5);
+    ensure_equals(locator.locate(&inside), Location::INTERIOR);
+    ensure_equals(locator.locate(&onBoundary), Location::BOUNDARY);
+    ensure_equals(locator.locate(&outside), Location::EXTERIOR);
+}
+
+// Empty and degenerate geometries, and points with NaN ordinates
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::unique_ptr<Geometry> empty = reader_.read("POLYGON EMPTY");
+    std::unique_ptr<Geometry> flat = reader_.read("POLYGON ((0 0, 10 0, 0 0))");
+    Coordinate p(0, 0);
+    Coordinate mid(5, 0);
+    Coordinate nan(std::numeric_limits<double>::quiet_NaN(), 0);
+
+    IndexedPointInAreaLocator emptyLocator(*empty, 8);
+    ensure_equals(emptyLocator.locate(&p), Location::EXTERIOR);
+
+    IndexedPointInAreaLocator flatLocator(*flat, 8);
+    ensure_equals(flatLocator.locate(&mid), Location::BOUNDARY);
+    ensure_equals(flatLocator.locate(&nan), Location::EXTERIOR);
+}
+
+// Non-areal geometries are rejected
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::unique_ptr<Geometry> g = reader_.read("LINESTRING (0 0, 10 10)");
+    try {
+        IndexedPointInAreaLocator locator(*g);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
+} // namespace tut
@@ -0,0 +1,229 @@
+//
+// Test Suite for C-API batch functions
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cmath>
+#include <vector>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeosbatch_data : public capitest::utility {
+    std::vector<GEOSGeometry*> geoms_;
+    std::vector<GEOSGeometry*> results_;
+
+    ~test_capigeosbatch_data()
+    {
+        for(GEOSGeometry* g : geoms_) {
+            GEOSGeom_destroy(g);
+        }
+        for(GEOSGeometry* g : results_) {
+            GEOSGeom_destroy(g);
+        }
+    }
+
+    void
+    add(const char* wkt)
+    {
+        geoms_.push_back(wkt ? GEOSGeomFromWKT(wkt) : nullptr);
+    }
+};
+
+typedef test_group<test_capigeosbatch_data> group;
+typedef group::object object;
+
+group test_capigeosbatch_group("capi::GEOSBatch");
+
+//
+// Test Cases
+//
+
+// Measures match the single geometry functions
+template<>
+template<>
+void object::test<1>
+()
+{
+    add("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    add("LINESTRING (0 0, 3 4)");
+    add(nullptr);
+    add("POINT EMPTY");
+
+    std::vector<double> areas(geoms_.size());
+    std::vector<double> lengths(geoms_.size());
+    ensure_equals(GEOSArea_batch(geoms_.data(), geoms_.size(), areas.data(), 0), 1);
+    ensure_equals(GEOSLength_batch(geoms_.data(), geoms_.size(), lengths.data(), 4), 1);
+
+    for(std::size_t i = 0; i < geoms_.size(); i++) {
+        if(geoms_[i] == nullptr) {
+            ensure(std::isnan(areas[i]));
+            ensure(std::isnan(lengths[i]));
+            continue;
+        }
+        double area, length;
+        GEOSArea(geoms_[i], &area);
+        GEOSLength(geoms_[i], &length);
+        ensure_equals(areas[i], area);
+        ensure_equals(lengths[i], length);
+    }
+}
+
+// Predicates
+template<>
+template<>
+void object::test<2>
+()
+{
+    add("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    add("POLYGON ((0 0, 10 10, 10 0, 0 10, 0 0))");
+    add("LINESTRING (0 0, 10 10, 10 0, 0 10)");
+    add("POINT EMPTY");
+    add(nullptr);
+
+    std::vector<char> empty(geoms_.size());
+    std::vector<char> simple(geoms_.size());
+    std::vector<char> valid(geoms_.size());
+    ensure_equals(GEOSisEmpty_batch(geoms_.data(), geoms_.size(), empty.data(), 1), 1);
+    ensure_equals(GEOSisSimple_batch(geoms_.data(), geoms_.size(), simple.data(), 1), 1);
+    ensure_equals(GEOSisValid_batch(geoms_.data(), geoms_.size(), valid.data(), 1), 1);
+
+    const char expectedEmpty[] = { 0, 0, 0, 1, 2 };
+    const char expectedSimple[] = { 1, 0, 0, 1, 2 };
+    const char expectedValid[] = { 1, 0, 1, 1, 2 };
+    for(std::size_t i = 0; i < geoms_.size(); i++) {
+        ensure_equals(int(empty[i]), int(expectedEmpty[i]));
+        ensure_equals(int(simple[i]), int(expectedSimple[i]));
+        ensure_equals(int(valid[i]), int(expectedValid[i]));
+    }
+}
+
+// Constructive functions
+template<>
+template<>
+void object::test<3>
+()
+{
+    add("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    add("LINESTRING (0 0, 4 2)");
+    add(nullptr);
+    add("POLYGON EMPTY");
+    GEOSSetSRID(geoms_[0], 4326);
+
+    results_.resize(geoms_.size());
+    ensure_equals(GEOSGetCentroid_batch(geoms_.data(), geoms_.size(), results_.data(), 0), 1);
+    ensure(results_[2] == nullptr);
+    ensure_equals(GEOSGetSRID(results_[0]), 4326);
+    ensure(GEOSisEmpty(results_[3]));
+    for(std::size_t i = 0; i < geoms_.size(); i++) {
+        if(geoms_[i] == nullptr) {
+            continue;
+        }
+        GEOSGeometry* expected = GEOSGetCentroid(geoms_[i]);
+        ensure(GEOSEqualsExact(results_[i], expected, 0));
+        GEOSGeom_destroy(expected);
+        GEOSGeom_destroy(results_[i]);
+    }
+
+    ensure_equals(GEOSEnvelope_batch(geoms_.data(), geoms_.size(), results_.data(), 0), 1);
+    ensure_geometry_equals(results_[0], geoms_[0]);
+    expected_ = fromWKT("POLYGON ((0 0, 4 0, 4 2, 0 2, 0 0))");
+    ensure_geometry_equals(results_[1], expected_);
+    ensure(results_[2] == nullptr);
+    for(GEOSGeometry*& g : results_) {
+        GEOSGeom_destroy(g);
+        g = nullptr;
+    }
+
+    ensure_equals(GEOSPointOnSurface_batch(geoms_.data(), geoms_.size(), results_.data(), 0), 1);
+    ensure_equals(GEOSIntersects(results_[0], geoms_[0]), 1);
+}
+
+// Batches run on the threads of the context
+template<>
+template<>
+void object::test<4>
+()
+{
+    GEOSContextHandle_t ctx = GEOS_init_r();
+    GEOSContextHandle_t other = GEOS_init_r();
+
+    ensure_equals(GEOSContext_setThreads_r(ctx, 4), 4);
+    ensure_equals(GEOSContext_setThreads_r(ctx, -1), 0);
+    ensure(GEOSContext_setThreads_r(ctx, 0) > 0);
+    ensure_equals(GEOSContext_setThreads_r(ctx, 3), 3);
+    ensure_equals(GEOSContext_setGrainSize_r(ctx, 16), 1024u);
+    ensure_equals(GEOSContext_shareThreads_r(other, ctx), 1);
+
+    for(int i = 0; i < 1000; i++) {
+        GEOSGeometry* pt = GEOSGeom_createPointFromXY_r(ctx, i, i);
+        geoms_.push_back(GEOSBuffer_r(ctx, pt, 1 + i % 10, 8));
+        GEOSGeom_destroy_r(ctx, pt);
+    }
+    GEOSGeom_destroy_r(ctx, geoms_[10]);
+    geoms_[10] = nullptr;
+
+    std::vector<double> serial(geoms_.size());
+    std::vector<double> threaded(geoms_.size());
+    ensure_equals(GEOSArea_batch_r(ctx, geoms_.data(), geoms_.size(), serial.data(), 1), 1);
+    ensure_equals(GEOSArea_batch_r(ctx, geoms_.data(), geoms_.size(), threaded.data(), 0), 1);
+    for(std::size_t i = 0; i < geoms_.size(); i++) {
+        if(i == 10) {
+            ensure(std::isnan(threaded[i]));
+            continue;
+        }
+        ensure_equals(threaded[i], serial[i]);
+    }
+
+    results_.resize(geoms_.size());
+    ensure_equals(GEOSGetCentroid_batch_r(other, geoms_.data(), geoms_.size(), results_.data(), 2), 1);
+    for(std::size_t i = 0; i < geoms_.size(); i++) {
+        if(i == 10) {
+            ensure(results_[i] == nullptr);
+            continue;
+        }
+        double x;
+        GEOSGeomGetX_r(ctx, results_[i], &x);
+        ensure_equals("centroid", x, double(i), 1e-9);
+    }
+
+    GEOS_finish_r(ctx);
+    GEOS_finish_r(other);
+}
+
+// The same geometry may appear several times in a threaded batch
+template<>
+template<>
+void object::test<5>
+()
+{
+    GEOSContextHandle_t ctx = GEOS_init_r();
+    ensure_equals(GEOSContext_setThreads_r(ctx, 4), 4);
+    ensure_equals(GEOSContext_setGrainSize_r(ctx, 16), 1024u);
+
+    geom1_ = GEOSGeomFromWKT("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1)), ((20 20, 30 20, 30 30, 20 20)))");
+    std::vector<const GEOSGeometry*> input(5000, geom1_);
+
+    std::vector<char> valid(input.size());
+    ensure_equals(GEOSisValid_batch_r(ctx, input.data(), input.size(), valid.data(), 0), 1);
+    for(char v : valid) {
+        ensure_equals(v, 1);
+    }
+
+    results_.resize(input.size());
+    ensure_equals(GEOSEnvelope_batch_r(ctx, input.data(), input.size(), results_.data(), 0), 1);
+    for(GEOSGeometry* env : results_) {
+        ensure_geometry_equals(env, "POLYGON ((0 0, 30 0, 30 30, 0 30, 0 0))");
+    }
+
+    GEOS_finish_r(ctx);
+}
+
+} // namespace tut
@@ -0,0 +1,84 @@
+//
+// Test Suite for C-API GEOSClipByGrid
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <utility>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeosclipbygrid_data : public capitest::utility {
+    std::map<std::pair<int, int>, GEOSGeometry*> tiles_;
+
+    static void
+    collect(int col, int row, GEOSGeometry* clipped, void* userdata)
+    {
+        auto tiles = static_cast<std::map<std::pair<int, int>, GEOSGeometry*>*>(userdata);
+        (*tiles)[std::make_pair(col, row)] = clipped;
+    }
+
+    ~test_capigeosclipbygrid_data()
+    {
+        for(auto& tile : tiles_) {
+            GEOSGeom_destroy(tile.second);
+        }
+    }
+};
+
+typedef test_group<test_capigeosclipbygrid_data> group;
+typedef group::object object;
+
+group test_capigeosclipbygrid_group("capi::GEOSClipByGrid");
+
+//
+// Test Cases
+//
+
+// Tiles are the same as clipping to each rectangle
+template<>
+template<>
+void object::test<1>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON ((-5 -5, 25 -5, 25 15, -5 15, -5 -5), (2 2, 8 2, 8 8, 2 8, 2 2))");
+    GEOSSetSRID(geom1_, 4326);
+
+    ensure_equals(GEOSClipByGrid(geom1_, 0, 0, 10, 10, 1, collect, &tiles_), 1);
+    ensure_equals(tiles_.size(), 12u);
+
+    for(int col = -1; col <= 2; col++) {
+        for(int row = -1; row <= 1; row++) {
+            GEOSGeometry* tile = tiles_[std::make_pair(col, row)];
+            ensure(tile != nullptr);
+            ensure_equals(GEOSGetSRID(tile), 4326);
+            GEOSGeometry* expected = GEOSClipByRect(geom1_, col * 10 - 1, row * 10 - 1, col * 10 + 11, row * 10 + 11);
+            ensure_geometry_equals(tile, expected);
+            GEOSGeom_destroy(expected);
+        }
+    }
+}
+
+// Invalid cell size
+template<>
+template<>
+void object::test<2>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POINT (1 1)");
+    ensure_equals(GEOSClipByGrid(geom1_, 0, 0, -10, 10, 0, collect, &tiles_), 0);
+    ensure(tiles_.empty());
+}
+
+} // namespace tut
@@ -0,0 +1,89 @@
+//
+// Test Suite for C-API GEOSConstrainedDelaunayTriangulation
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeosconstraineddelaunaytriangulation_data : public capitest::utility {
+    test_capigeosconstraineddelaunaytriangulation_data() {
+        GEOSWKTWriter_setTrim(wktw_, 1);
+    }
+};
+
+typedef test_group<test_capigeosconstraineddelaunaytriangulation_data> group;
+typedef group::object object;
+
+group test_capigeosconstraineddelaunaytriangulation_group("capi::GEOSConstrainedDelaunayTriangulation");
+
+//
+// Test Cases
+//
+
+// Empty polygon
+template<>
+template<>
+void object::test<1>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON EMPTY");
+
+    geom2_ = GEOSConstrainedDelaunayTriangulation(geom1_, 0);
+    ensure(geom2_ != nullptr);
+    ensure_equals(GEOSisEmpty(geom2_), 1);
+    ensure_equals(GEOSGeomTypeId(geom2_), GEOS_GEOMETRYCOLLECTION);
+
+    GEOSGeom_destroy(geom2_);
+    geom2_ = GEOSConstrainedDelaunayTriangulation(geom1_, 1);
+    ensure(geom2_ != nullptr);
+    ensure_equals(GEOSisEmpty(geom2_), 1);
+    ensure_equals(GEOSGeomTypeId(geom2_), GEOS_MULTILINESTRING);
+}
+
+// Concave polygon with a hole
+template<>
+template<>
+void object::test<2>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 5 2, 0 10, 0 0), (4 1, 5 1.5, 6 1, 4 1))");
+    GEOSSetSRID(geom1_, 4326);
+
+    geom2_ = GEOSConstrainedDelaunayTriangulation(geom1_, 0);
+    ensure(geom2_ != nullptr);
+    ensure_equals(GEOSGetNumGeometries(geom2_), 8);
+    ensure_equals(GEOSGetSRID(geom2_), 4326);
+
+    geom3_ = GEOSUnaryUnion(geom2_);
+    ensure(GEOSEquals(geom3_, geom1_) == 1);
+}
+
+// Breakline
+template<>
+template<>
+void object::test<3>
+()
+{
+    geom1_ = GEOSGeomFromWKT("GEOMETRYCOLLECTION (MULTIPOINT ((0 0), (10 1), (20 0), (10 -1)), LINESTRING (0 0, 20 0))");
+
+    geom2_ = GEOSConstrainedDelaunayTriangulation(geom1_, 1);
+    ensure(geom2_ != nullptr);
+    ensure_equals(GEOSGeomTypeId(geom2_), GEOS_MULTILINESTRING);
+    ensure_equals(GEOSGetNumGeometries(geom2_), 5);
+    ensure(GEOSCovers(geom2_, GEOSGetGeometryN(geom1_, 1)) == 1);
+}
+
+} // namespace tut
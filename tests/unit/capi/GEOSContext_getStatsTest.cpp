@@ -0,0 +1,70 @@
+//
+// Test Suite for C-API GEOSContext_getStats_r
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <vector>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeoscontextgetstats_data : public capitest::utility {
+    GEOSContextHandle_t ctx_;
+
+    test_capigeoscontextgetstats_data()
+        : ctx_(GEOS_init_r())
+    {
+        GEOSContext_resetStats_r(ctx_);
+    }
+
+    ~test_capigeoscontextgetstats_data()
+    {
+        GEOSContext_setStatsEnabled_r(ctx_, 0);
+        GEOS_finish_r(ctx_);
+    }
+};
+
+typedef test_group<test_capigeoscontextgetstats_data> group;
+typedef group::object object;
+
+group test_capigeoscontextgetstats_group("capi::GEOSContext_getStats");
+
+//
+// Test Cases
+//
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    ensure_equals(GEOSContext_setStatsEnabled_r(ctx_, 1), 0);
+    ensure_equals(GEOSContext_setStatsEnabled_r(ctx_, 1), 1);
+
+    geom1_ = GEOSGeomFromWKT_r(ctx_, "POLYGON ((0 0, 10 0, 10 10, 5 5, 0 10, 0 0))");
+    geom2_ = GEOSBuffer_r(ctx_, geom1_, 1, 8);
+    ensure(geom2_ != nullptr);
+
+    int n = GEOSContext_getStats_r(ctx_, nullptr, nullptr, 0);
+    ensure(n > GEOS_STATS_ROBUSTNESS_RETRY);
+
+    std::vector<size_t> counts(n);
+    std::vector<double> seconds(n);
+    ensure_equals(GEOSContext_getStats_r(ctx_, counts.data(), seconds.data(), n), n);
+    ensure_equals(counts[GEOS_STATS_NODING], 1u);
+    ensure_equals(counts[GEOS_STATS_RING_BUILDING], 1u);
+    ensure(seconds[GEOS_STATS_NODING] >= 0);
+
+    GEOSContext_resetStats_r(ctx_);
+    GEOSContext_getStats_r(ctx_, counts.data(), nullptr, n);
+    ensure_equals(counts[GEOS_STATS_NODING], 0u);
+}
+
+} // namespace tut
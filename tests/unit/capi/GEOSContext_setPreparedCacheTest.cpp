@@ -0,0 +1,91 @@
+//
+// Test Suite for C-API GEOSContext_setPreparedCache_r
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeoscontextsetpreparedcache_data : public capitest::utility {
+    GEOSContextHandle_t ctx_;
+
+    test_capigeoscontextsetpreparedcache_data()
+        : ctx_(GEOS_init_r())
+    {}
+
+    ~test_capigeoscontextsetpreparedcache_data()
+    {
+        GEOS_finish_r(ctx_);
+    }
+};
+
+typedef test_group<test_capigeoscontextsetpreparedcache_data> group;
+typedef group::object object;
+
+group test_capigeoscontextsetpreparedcache_group("capi::GEOSContext_setPreparedCache");
+
+//
+// Test Cases
+//
+
+// Cached prepared geometries do not refer to the input geometry
+template<>
+template<>
+void object::test<1>
+()
+{
+    ensure_equals(GEOSContext_setPreparedCache_r(ctx_, 16, 0), 1);
+
+    geom1_ = GEOSGeomFromWKT_r(ctx_, "POLYGON ((0 0, 10 0, 10 10, 5 5, 0 10, 0 0))");
+    geom2_ = GEOSGeomFromWKT_r(ctx_, "POINT (5 2)");
+    geom3_ = GEOSGeomFromWKT_r(ctx_, "POLYGON ((0 0, 10 0, 10 10, 5 5, 0 10, 0 0))");
+
+    const GEOSPreparedGeometry* pg1 = GEOSPrepare_r(ctx_, geom1_);
+    GEOSGeom_destroy_r(ctx_, geom1_);
+    geom1_ = nullptr;
+    const GEOSPreparedGeometry* pg2 = GEOSPrepare_r(ctx_, geom3_);
+    ensure(pg1 != nullptr);
+    ensure(pg2 != nullptr);
+
+    ensure_equals(GEOSPreparedContains_r(ctx_, pg1, geom2_), 1);
+    ensure_equals(GEOSPreparedContains_r(ctx_, pg2, geom2_), 1);
+
+    GEOSPreparedGeom_destroy_r(ctx_, pg1);
+    GEOSPreparedGeom_destroy_r(ctx_, pg2);
+}
+
+// Contexts can share a cache, and a cache can be disabled
+template<>
+template<>
+void object::test<2>
+()
+{
+    GEOSContextHandle_t ctx2 = GEOS_init_r();
+    ensure_equals(GEOSContext_setPreparedCache_r(ctx_, 4, 2), 1);
+    ensure_equals(GEOSContext_sharePreparedCache_r(ctx2, ctx_), 1);
+
+    geom1_ = GEOSGeomFromWKT_r(ctx_, "LINESTRING (0 0, 10 10)");
+    geom2_ = GEOSGeomFromWKT_r(ctx_, "POINT (5 5)");
+
+    const GEOSPreparedGeometry* pg1 = GEOSPrepare_r(ctx2, geom1_);
+    ensure(pg1 != nullptr);
+    ensure_equals(GEOSPreparedIntersects_r(ctx2, pg1, geom2_), 1);
+    GEOSPreparedGeom_destroy_r(ctx2, pg1);
+
+    ensure_equals(GEOSContext_setPreparedCache_r(ctx_, 0, 0), 1);
+    const GEOSPreparedGeometry* pg2 = GEOSPrepare_r(ctx_, geom1_);
+    ensure(pg2 != nullptr);
+    ensure_equals(GEOSPreparedCovers_r(ctx_, pg2, geom2_), 1);
+    GEOSPreparedGeom_destroy_r(ctx_, pg2);
+
+    GEOS_finish_r(ctx2);
+}
+
+} // namespace tut
@@ -0,0 +1,95 @@
+//
+// Test Suite for C-API GEOSEncodeTile
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeosencodetile_data : public capitest::utility {
+    int type_ = -1;
+    int* coords_ = nullptr;
+    unsigned int ncoords_ = 0;
+    unsigned int* parts_ = nullptr;
+    unsigned int nparts_ = 0;
+
+    ~test_capigeosencodetile_data()
+    {
+        GEOSFree(coords_);
+        GEOSFree(parts_);
+    }
+};
+
+typedef test_group<test_capigeosencodetile_data> group;
+typedef group::object object;
+
+group test_capigeosencodetile_group("capi::GEOSEncodeTile");
+
+//
+// Test Cases
+//
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    geom1_ = GEOSGeomFromWKT("LINESTRING (900 2100, 1100 2100, 1100 2300)");
+
+    int ret = GEOSEncodeTile(geom1_, 1000, 2000, 1200, 2200, 4096, 0, 0,
+                             &type_, &coords_, &ncoords_, &parts_, &nparts_);
+    ensure_equals(ret, 1);
+    ensure_equals(type_, 2);
+    ensure_equals(ncoords_, 3u);
+    ensure_equals(nparts_, 1u);
+    ensure_equals(parts_[0], 3u);
+
+    const int expected[] = { 0, 2048, 2048, 2048, 2048, 0 };
+    for(unsigned int i = 0; i < 2 * ncoords_; i++) {
+        ensure_equals(coords_[i], expected[i]);
+    }
+}
+
+// Empty results
+template<>
+template<>
+void object::test<2>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON ((5000 5000, 5001 5000, 5001 5001, 5000 5000))");
+
+    int ret = GEOSEncodeTile(geom1_, 0, 0, 100, 100, 4096, 64, 0,
+                             &type_, &coords_, &ncoords_, &parts_, &nparts_);
+    ensure_equals(ret, 1);
+    ensure_equals(type_, 0);
+    ensure(coords_ == nullptr);
+    ensure(parts_ == nullptr);
+    ensure_equals(ncoords_, 0u);
+    ensure_equals(nparts_, 0u);
+}
+
+// Invalid tile
+template<>
+template<>
+void object::test<3>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POINT (1 1)");
+
+    int ret = GEOSEncodeTile(geom1_, 0, 0, 0, 100, 4096, 64, 0,
+                             &type_, &coords_, &ncoords_, &parts_, &nparts_);
+    ensure_equals(ret, 0);
+}
+
+} // namespace tut
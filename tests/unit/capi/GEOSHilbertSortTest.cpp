@@ -0,0 +1,83 @@
+//
+// Test Suite for C-API GEOSHilbertSort
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <vector>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeoshilbertsort_data : public capitest::utility {
+};
+
+typedef test_group<test_capigeoshilbertsort_data> group;
+typedef group::object object;
+
+group test_capigeoshilbertsort_group("capi::GEOSHilbertSort");
+
+//
+// Test Cases
+//
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POINT (10 0)");
+    geom2_ = GEOSGeomFromWKT("POINT (0 0)");
+    geom3_ = GEOSGeomFromWKT("POINT (10 10)");
+    GEOSGeometry* geoms[4] = { geom1_, geom2_, nullptr, geom3_ };
+    size_t order[4];
+
+    ensure_equals(GEOSHilbertSort(geoms, 4, nullptr, order, 0), 1);
+    ensure(geoms[0] == nullptr);
+    ensure(geoms[1] == geom2_);
+    ensure(geoms[2] == geom3_);
+    ensure(geoms[3] == geom1_);
+    ensure_equals(order[0], 2u);
+    ensure_equals(order[1], 1u);
+    ensure_equals(order[2], 3u);
+    ensure_equals(order[3], 0u);
+}
+
+// Coordinates, with an extent and the threads of a context
+template<>
+template<>
+void object::test<2>
+()
+{
+    GEOSContextHandle_t ctx = GEOS_init_r();
+    ensure_equals(GEOSContext_setThreads_r(ctx, 2), 2);
+
+    std::vector<double> x;
+    std::vector<double> y;
+    for (size_t i = 0; i < 100000; i++) {
+        x.push_back(static_cast<double>((i * 7919) % 1000));
+        y.push_back(static_cast<double>((i * 104729) % 1000));
+    }
+    std::vector<double> x2 = x;
+    std::vector<double> y2 = y;
+    const double extent[4] = { 0, 0, 1000, 1000 };
+
+    ensure_equals(GEOSHilbertSortCoords_r(ctx, x.data(), y.data(), x.size(), extent, nullptr, 0), 1);
+    std::vector<size_t> order(x2.size());
+    ensure_equals(GEOSHilbertSortCoords_r(ctx, x2.data(), y2.data(), x2.size(), extent, order.data(), 1), 1);
+    ensure(x == x2);
+    ensure(y == y2);
+    ensure_equals(x[0], 0.0);
+    ensure_equals(y[0], 0.0);
+    ensure_equals(order[0], 0u);
+
+    GEOS_finish_r(ctx);
+}
+
+} // namespace tut
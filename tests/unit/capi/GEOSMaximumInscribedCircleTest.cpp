@@ -10,6 +10,8 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <cmath>
+#include <vector>
 
 #include "capi_test_utils.h"
 
@@ -77,6 +79,79 @@ void object::test<2>
     ensure_equals(std::string(wkt_), std::string("LINESTRING (150 150, 100 100)"));
 }
 
+// Batch computation of centers
+template<>
+template<>
+void object::test<3>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON ((100 200, 200 200, 200 100, 100 100, 100 200))");
+    geom2_ = GEOSGeomFromWKT("POLYGON EMPTY");
+    geom3_ = GEOSGeomFromWKT("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((20 0, 60 0, 60 40, 20 40, 20 0)))");
+    const GEOSGeometry* geoms[] = { geom1_, geom2_, geom3_ };
+
+    double centers[6];
+    double radii[3];
+    ensure_equals(GEOSMaximumInscribedCircle_batch(geoms, 3, 0.001, centers, radii, 0), 1);
+
+    ensure_equals("centers[0]", centers[0], 150.0, 0.001);
+    ensure_equals("centers[1]", centers[1], 150.0, 0.001);
+    ensure_equals("radii[0]", radii[0], 50.0, 0.001);
+    ensure(std::isnan(centers[2]));
+    ensure(std::isnan(centers[3]));
+    ensure(std::isnan(radii[1]));
+    ensure_equals("centers[4]", centers[4], 40.0, 0.001);
+    ensure_equals("centers[5]", centers[5], 20.0, 0.001);
+    ensure_equals("radii[2]", radii[2], 20.0, 0.001);
+
+    // radii are optional
+    ensure_equals(GEOSMaximumInscribedCircle_batch(geoms, 1, 0.001, centers, nullptr, 0), 1);
+    ensure_equals("centers[0]", centers[0], 150.0, 0.001);
+}
+
+// Batch computation fails on non-polygonal input
+template<>
+template<>
+void object::test<4>
+()
+{
+    geom1_ = GEOSGeomFromWKT("LINESTRING (0 0, 1 1)");
+    const GEOSGeometry* geoms[] = { geom1_ };
+
+    double centers[2];
+    ensure_equals(GEOSMaximumInscribedCircle_batch(geoms, 1, 0.001, centers, nullptr, 0), 0);
+}
+
+
+// Batch computation with NULL inputs, on the threads of a context
+template<>
+template<>
+void object::test<5>
+()
+{
+    GEOSContextHandle_t ctx = GEOS_init_r();
+    ensure_equals(GEOSContext_setThreads_r(ctx, 2), 2);
+
+    geom1_ = GEOSGeomFromWKT("POLYGON ((100 200, 200 200, 200 100, 100 100, 100 200))");
+    std::vector<const GEOSGeometry*> geoms(3000, geom1_);
+    geoms[1] = nullptr;
+
+    std::vector<double> centers(2 * geoms.size());
+    std::vector<double> radii(geoms.size());
+    ensure_equals(GEOSMaximumInscribedCircle_batch_r(ctx, geoms.data(), geoms.size(), 1,
+                  centers.data(), radii.data(), 0), 1);
+    ensure(std::isnan(centers[2]));
+    ensure(std::isnan(centers[3]));
+    ensure(std::isnan(radii[1]));
+    for(std::size_t i = 0; i < geoms.size(); i++) {
+        if(i != 1) {
+            ensure_equals("radii", radii[i], 50.0, 1.0);
+            ensure_equals(centers[2 * i], centers[0]);
+        }
+    }
+
+    GEOS_finish_r(ctx);
+}
 
 } // namespace tut
 
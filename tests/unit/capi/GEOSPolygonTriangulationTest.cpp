@@ -0,0 +1,69 @@
+//
+// Test Suite for C-API GEOSPolygonTriangulation
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeospolygontriangulation_data : public capitest::utility {
+    test_capigeospolygontriangulation_data() {
+        GEOSWKTWriter_setTrim(wktw_, 1);
+    }
+};
+
+typedef test_group<test_capigeospolygontriangulation_data> group;
+typedef group::object object;
+
+group test_capigeospolygontriangulation_group("capi::GEOSPolygonTriangulation");
+
+//
+// Test Cases
+//
+
+// Empty polygon
+template<>
+template<>
+void object::test<1>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON EMPTY");
+
+    geom2_ = GEOSPolygonTriangulation(geom1_);
+    ensure(geom2_ != nullptr);
+    ensure_equals(GEOSisEmpty(geom2_), 1);
+    ensure_equals(GEOSGeomTypeId(geom2_), GEOS_GEOMETRYCOLLECTION);
+}
+
+// Polygon with a hole
+template<>
+template<>
+void object::test<2>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 5 2, 0 10, 0 0), (4 1, 5 1.5, 6 1, 4 1))");
+    GEOSSetSRID(geom1_, 4326);
+
+    geom2_ = GEOSPolygonTriangulation(geom1_);
+    ensure(geom2_ != nullptr);
+    ensure_equals(GEOSGeomTypeId(geom2_), GEOS_GEOMETRYCOLLECTION);
+    ensure_equals(GEOSGetNumGeometries(geom2_), 8);
+    ensure_equals(GEOSGetSRID(geom2_), 4326);
+
+    geom3_ = GEOSUnaryUnion(geom2_);
+    ensure(GEOSEquals(geom3_, geom1_) == 1);
+}
+
+} // namespace tut
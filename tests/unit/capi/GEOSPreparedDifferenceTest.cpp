@@ -0,0 +1,117 @@
+//
+// Test Suite for C-API GEOSPreparedDifference
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeospreparedddifference_data : public capitest::utility {
+    const GEOSPreparedGeometry* pgeom1_;
+
+    test_capigeospreparedddifference_data()
+        : pgeom1_(nullptr)
+    {}
+
+    ~test_capigeospreparedddifference_data()
+    {
+        GEOSPreparedGeom_destroy(pgeom1_);
+    }
+
+    void checkDifference(const char* wkt1, const char* wkt2, const char* wktExpected)
+    {
+        geom1_ = GEOSGeomFromWKT(wkt1);
+        ensure(nullptr != geom1_);
+        pgeom1_ = GEOSPrepare(geom1_);
+        ensure(nullptr != pgeom1_);
+        geom2_ = GEOSGeomFromWKT(wkt2);
+        ensure(nullptr != geom2_);
+
+        geom3_ = GEOSPreparedDifference(pgeom1_, geom2_);
+        ensure(nullptr != geom3_);
+        ensure_geometry_equals(geom3_, wktExpected);
+    }
+};
+
+typedef test_group<test_capigeospreparedddifference_data> group;
+typedef group::object object;
+
+group test_capigeospreparedddifference_group("capi::GEOSPreparedDifference");
+
+//
+// Test Cases
+//
+
+// The prepared geometry is subtracted from the other geometry
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkDifference(
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))",
+        "POLYGON ((10 5, 15 5, 15 15, 5 15, 5 10, 10 10, 10 5))"
+    );
+}
+
+// Geometry inside the prepared geometry
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkDifference(
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "MULTIPOINT ((1 1), (5 5))",
+        "POINT EMPTY"
+    );
+}
+
+// Geometry in a hole of the prepared geometry
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkDifference(
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 8 2, 8 8, 2 8, 2 2))",
+        "LINESTRING (3 3, 7 7)",
+        "LINESTRING (3 3, 7 7)"
+    );
+}
+
+// Geometry containing the prepared geometry
+template<>
+template<>
+void object::test<4>
+()
+{
+    checkDifference(
+        "POLYGON ((3 3, 7 3, 7 7, 3 7, 3 3))",
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (3 3, 7 3, 7 7, 3 7, 3 3))"
+    );
+}
+
+// Geometry inside the prepared geometry and containing one of its holes
+template<>
+template<>
+void object::test<5>
+()
+{
+    checkDifference(
+        "POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (40 40, 60 40, 60 60, 40 60, 40 40))",
+        "POLYGON ((10 10, 90 10, 90 90, 10 90, 10 10))",
+        "POLYGON ((40 40, 60 40, 60 60, 40 60, 40 40))"
+    );
+}
+
+} // namespace tut
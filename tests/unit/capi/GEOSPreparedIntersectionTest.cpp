@@ -0,0 +1,130 @@
+//
+// Test Suite for C-API GEOSPreparedIntersection
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeospreparedintersection_data : public capitest::utility {
+    const GEOSPreparedGeometry* pgeom1_;
+
+    test_capigeospreparedintersection_data()
+        : pgeom1_(nullptr)
+    {}
+
+    ~test_capigeospreparedintersection_data()
+    {
+        GEOSPreparedGeom_destroy(pgeom1_);
+    }
+
+    void checkIntersection(const char* wkt1, const char* wkt2, const char* wktExpected)
+    {
+        geom1_ = GEOSGeomFromWKT(wkt1);
+        ensure(nullptr != geom1_);
+        pgeom1_ = GEOSPrepare(geom1_);
+        ensure(nullptr != pgeom1_);
+        geom2_ = GEOSGeomFromWKT(wkt2);
+        ensure(nullptr != geom2_);
+
+        geom3_ = GEOSPreparedIntersection(pgeom1_, geom2_);
+        ensure(nullptr != geom3_);
+        ensure_geometry_equals(geom3_, wktExpected);
+    }
+};
+
+typedef test_group<test_capigeospreparedintersection_data> group;
+typedef group::object object;
+
+group test_capigeospreparedintersection_group("capi::GEOSPreparedIntersection");
+
+//
+// Test Cases
+//
+
+// Geometry crossing the prepared boundary
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkIntersection(
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))",
+        "POLYGON ((5 10, 10 10, 10 5, 5 5, 5 10))"
+    );
+}
+
+// Geometry inside the prepared geometry
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkIntersection(
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "LINESTRING (1 1, 2 5, 3 3)",
+        "LINESTRING (1 1, 2 5, 3 3)"
+    );
+}
+
+// Geometry outside the prepared geometry
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkIntersection(
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 8 2, 8 8, 2 8, 2 2))",
+        "POLYGON ((3 3, 7 3, 7 7, 3 7, 3 3))",
+        "POLYGON EMPTY"
+    );
+}
+
+// Geometry containing the prepared geometry
+template<>
+template<>
+void object::test<4>
+()
+{
+    checkIntersection(
+        "POLYGON ((3 3, 7 3, 7 7, 3 7, 3 3))",
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "POLYGON ((3 3, 7 3, 7 7, 3 7, 3 3))"
+    );
+}
+
+// Non-polygonal prepared geometry
+template<>
+template<>
+void object::test<5>
+()
+{
+    checkIntersection(
+        "LINESTRING (0 0, 10 10)",
+        "POLYGON ((0 0, 5 0, 5 5, 0 5, 0 0))",
+        "LINESTRING (0 0, 5 5)"
+    );
+}
+
+// Geometry inside the prepared geometry and containing one of its holes
+template<>
+template<>
+void object::test<6>
+()
+{
+    checkIntersection(
+        "POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (40 40, 60 40, 60 60, 40 60, 40 40))",
+        "POLYGON ((10 10, 90 10, 90 90, 10 90, 10 10))",
+        "POLYGON ((10 10, 90 10, 90 90, 10 90, 10 10), (40 40, 60 40, 60 60, 40 60, 40 40))"
+    );
+}
+
+} // namespace tut
@@ -382,6 +382,103 @@ void object::test<11>()
 }
 
 
+// k nearest neighbours of several geometries
+template<>
+template<>
+void object::test<12>()
+{
+    GEOSSTRtree* tree = GEOSSTRtree_create(10);
+
+    std::vector<GEOSGeometry*> geoms;
+    for (size_t i = 0; i < 100; i++) {
+        geoms.push_back(GEOSGeom_createPointFromXY((double) i, 0));
+        GEOSSTRtree_insert(tree, geoms.back(), geoms.back());
+    }
+
+    GEOSGeometry* q[2];
+    q[0] = GEOSGeomFromWKT("LINESTRING (10.2 1, 12.2 1)");
+    q[1] = GEOSGeom_createPointFromXY(-10, 0);
+
+    const GEOSGeometry* results[6];
+    double distances[6];
+    size_t numResults[2];
+    ensure_equals(GEOSSTRtree_nearest_k(tree, q, 2, 3, 5.0, results, distances, numResults), 1);
+
+    ensure_equals(numResults[0], 3u);
+    ensure(results[0] == geoms[11] || results[0] == geoms[12]);
+    ensure_equals(distances[0], 1.0);
+    ensure_equals(distances[2], std::sqrt(1.04));
+
+    // no points within the maximum distance
+    ensure_equals(numResults[1], 0u);
+
+    ensure_equals(GEOSSTRtree_nearest_k(tree, q + 1, 1, 3, -1, results, nullptr, numResults), 1);
+    ensure_equals(numResults[0], 3u);
+    ensure(results[0] == geoms[0]);
+    ensure(results[1] == geoms[1]);
+    ensure(results[2] == geoms[2]);
+
+    GEOSGeom_destroy(q[0]);
+    GEOSGeom_destroy(q[1]);
+    for (auto& geom : geoms) {
+        GEOSGeom_destroy(geom);
+    }
+    GEOSSTRtree_destroy(tree);
+}
+
+// join two trees
+template<>
+template<>
+void object::test<13>()
+{
+    GEOSSTRtree* tree1 = GEOSSTRtree_create(10);
+    GEOSSTRtree* tree2 = GEOSSTRtree_create(10);
+
+    std::vector<GEOSGeometry*> geoms;
+    for (size_t i = 0; i < 20; i++) {
+        geoms.push_back(GEOSGeom_createPointFromXY((double) i, 0));
+        GEOSSTRtree_insert(tree1, geoms.back(), geoms.back());
+    }
+    // a triangle whose envelope contains points 1 to 4,
+    // but which only intersects point 1
+    geoms.push_back(GEOSGeomFromWKT("POLYGON ((1 0, 4 1, 1 1, 1 0))"));
+    GEOSSTRtree_insert(tree2, geoms.back(), geoms.back());
+    geoms.push_back(GEOSGeomFromWKT("LINESTRING (10 2, 12 2)"));
+    GEOSSTRtree_insert(tree2, geoms.back(), geoms.back());
+
+    typedef std::vector<std::pair<void*, void*>> PairList;
+    auto collect = [](void* item1, void* item2, void* userdata) {
+        static_cast<PairList*>(userdata)->emplace_back(item1, item2);
+    };
+
+    PairList pairs;
+    ensure_equals(GEOSSTRtree_join(tree1, tree2, collect, &pairs), 1);
+    ensure_equals(pairs.size(), 4u);
+
+    pairs.clear();
+    ensure_equals(GEOSSTRtree_joinWithinDistance(tree1, tree2, 0, collect, &pairs), 1);
+    ensure_equals(pairs.size(), 1u);
+    ensure(pairs[0].first == geoms[1]);
+
+    pairs.clear();
+    ensure_equals(GEOSSTRtree_joinWithinDistance(tree1, tree2, 2, collect, &pairs), 1);
+    // points 0 to 5 near the triangle, and points 10 to 12 near the line
+    ensure_equals(pairs.size(), 9u);
+
+    // self join
+    pairs.clear();
+    ensure_equals(GEOSSTRtree_joinWithinDistance(tree1, nullptr, 1, collect, &pairs), 1);
+    ensure_equals(pairs.size(), 19u);
+
+    ensure_equals(GEOSSTRtree_joinWithinDistance(tree1, tree2, -1, collect, &pairs), 0);
+
+    GEOSSTRtree_destroy(tree1);
+    GEOSSTRtree_destroy(tree2);
+    for (auto& geom : geoms) {
+        GEOSGeom_destroy(geom);
+    }
+}
+
 } // namespace tut
 
 
@@ -0,0 +1,63 @@
+//
+// Test Suite for C-API GEOSSimplifyVW
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeossimplifyvw_data : public capitest::utility {};
+
+typedef test_group<test_capigeossimplifyvw_data> group;
+typedef group::object object;
+
+group test_capigeossimplifyvw_group("capi::GEOSSimplifyVW");
+
+//
+// Test Cases
+//
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON EMPTY");
+
+    ensure(0 != GEOSisEmpty(geom1_));
+
+    geom2_ = GEOSSimplifyVW(geom1_, 43.2, 0);
+
+    ensure(0 != GEOSisEmpty(geom2_));
+}
+
+template<>
+template<>
+void object::test<2>
+()
+{
+    geom1_ = GEOSGeomFromWKT("MULTILINESTRING ((0 0, 50 5, 100 0), (50 -2, 50 2))");
+    GEOSSetSRID(geom1_, 4326);
+
+    geom2_ = GEOSSimplifyVW(geom1_, 20, 0);
+    expected_ = GEOSGeomFromWKT("MULTILINESTRING ((0 0, 100 0), (50 -2, 50 2))");
+    ensure_geometry_equals(geom2_, expected_);
+    ensure_equals(GEOSGetSRID(geom2_), 4326);
+
+    geom3_ = GEOSSimplifyVW(geom1_, 20, 1);
+    ensure_geometry_equals(geom3_, geom1_);
+}
+
+} // namespace tut
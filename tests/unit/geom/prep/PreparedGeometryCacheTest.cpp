@@ -0,0 +1,242 @@
+//
+// Test Suite for geos::geom::prep::PreparedGeometryCache class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/geom/prep/PreparedGeometryCache.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <memory>
+#include <thread>
+#include <vector>
+
+using geos::geom::Geometry;
+using geos::geom::prep::PreparedGeometry;
+using geos::geom::prep::PreparedGeometryCache;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_preparedgeometrycache_data {
+    geos::geom::GeometryFactory::Ptr factory_;
+    geos::io::WKTReader reader_;
+
+    test_preparedgeometrycache_data()
+        : factory_(geos::geom::GeometryFactory::create())
+        , reader_(factory_.get())
+    {}
+
+    std::unique_ptr<Geometry>
+    read(const std::string& wkt)
+    {
+        return reader_.read(wkt);
+    }
+};
+
+typedef test_group<test_preparedgeometrycache_data> group;
+typedef group::object object;
+
+group test_preparedgeometrycache_group("geos::geom::prep::PreparedGeometryCache");
+
+//
+// Test Cases
+//
+
+// Equal geometries share an entry
+template<>
+template<>
+void object::test<1>
+()
+{
+    PreparedGeometryCache cache(4);
+    auto a = read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    auto b = read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+
+    auto pa = cache.prepare(*a);
+    auto pb = cache.prepare(*b);
+    ensure_equals(cache.size(), 1u);
+    ensure_equals(cache.getNumMisses(), 1u);
+    ensure_equals(cache.getNumHits(), 1u);
+    ensure(&pa->getGeometry() == &pb->getGeometry());
+    ensure(pa->getGeometry().equalsExact(a.get()));
+}
+
+// Geometries with the same coordinates but different types are distinct
+template<>
+template<>
+void object::test<2>
+()
+{
+    PreparedGeometryCache cache(4);
+    auto ring = read("LINESTRING (0 0, 10 0, 10 10, 0 10, 0 0)");
+    auto poly = read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    auto pt = read("POINT (5 5)");
+
+    auto pring = cache.prepare(*ring);
+    auto ppoly = cache.prepare(*poly);
+    ensure_equals(cache.size(), 2u);
+    ensure(!pring->contains(pt.get()));
+    ensure(ppoly->contains(pt.get()));
+}
+
+// The least recently used entry is dropped
+template<>
+template<>
+void object::test<3>
+()
+{
+    PreparedGeometryCache cache(2);
+    auto a = read("POINT (1 1)");
+    auto b = read("POINT (2 2)");
+    auto c = read("POINT (3 3)");
+
+    cache.prepare(*a);
+    cache.prepare(*b);
+    cache.prepare(*a);  // a is now the most recently used
+    cache.prepare(*c);  // drops b
+    ensure_equals(cache.size(), 2u);
+    ensure_equals(cache.getNumHits(), 1u);
+
+    cache.prepare(*a);
+    ensure_equals(cache.getNumHits(), 2u);
+    cache.prepare(*b);
+    ensure_equals(cache.getNumMisses(), 4u);
+
+    cache.setMaxEntries(1);
+    ensure_equals(cache.size(), 1u);
+    cache.clear();
+    ensure_equals(cache.size(), 0u);
+}
+
+// Small geometries are not cached
+template<>
+template<>
+void object::test<4>
+()
+{
+    PreparedGeometryCache cache(4, 5);
+    auto small = read("LINESTRING (0 0, 1 1)");
+    auto large = read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+
+    auto psmall = cache.prepare(*small);
+    cache.prepare(*large);
+    ensure_equals(cache.size(), 1u);
+    ensure_equals(cache.getNumMisses(), 1u);
+    // small geometries are prepared without a copy
+    ensure(&psmall->getGeometry() == small.get());
+}
+
+// Prepared geometries outlive the cache and the argument
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::unique_ptr<PreparedGeometry> pg;
+    {
+        PreparedGeometryCache cache(1);
+        auto g = read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+        pg = cache.prepare(*g);
+        auto other = read("POINT (20 20)");
+        cache.prepare(*other);
+        ensure_equals(cache.size(), 1u);
+    }
+    auto inside = read("POINT (5 5)");
+    auto line = read("LINESTRING (5 5, 20 5)");
+    ensure(pg->contains(inside.get()));
+    ensure(pg->intersects(line.get()));
+    ensure(!pg->covers(line.get()));
+    ensure_equals(pg->distance(read("POINT (13 14)").get()), 5.0);
+}
+
+// Entries can be used by several threads
+template<>
+template<>
+void object::test<6>
+()
+{
+    PreparedGeometryCache cache(8);
+    auto g = read("POLYGON ((0 0, 100 0, 100 100, 50 50, 0 100, 0 0))");
+    std::vector<std::unique_ptr<Geometry>> points;
+    for(int i = 0; i < 100; i++) {
+        points.emplace_back(factory_->createPoint(geos::geom::Coordinate(i + 0.5, 60)));
+    }
+
+    auto line = read("LINESTRING (-10 60, 110 60)");
+    auto farLine = read("LINESTRING (-10 120, 110 120)");
+
+    std::vector<int> counts(4, 0);
+    std::vector<int> lineCounts(4, 0);
+    std::vector<double> distances(4, 0.0);
+    std::vector<std::thread> threads;
+    for(std::size_t t = 0; t < counts.size(); t++) {
+        threads.emplace_back([&, t]() {
+            for(int r = 0; r < 10; r++) {
+                auto pg = cache.prepare(*g);
+                for(const auto& p : points) {
+                    counts[t] += pg->contains(p.get());
+                }
+                lineCounts[t] += pg->intersects(line.get());
+                lineCounts[t] += pg->intersects(farLine.get());
+                distances[t] += pg->distance(farLine.get());
+            }
+        });
+    }
+    for(auto& thread : threads) {
+        thread.join();
+    }
+
+    ensure_equals(cache.size(), 1u);
+    ensure_equals(cache.getNumHits() + cache.getNumMisses(), 40u);
+    for(std::size_t t = 0; t < counts.size(); t++) {
+        ensure_equals(counts[t], 10 * 80);
+        ensure_equals(lineCounts[t], 10);
+        ensure_equals(distances[t], 10 * 20.0);
+    }
+}
+
+// Geometries equal in XY but with different SRIDs or Z are distinct
+template<>
+template<>
+void object::test<7>
+()
+{
+    PreparedGeometryCache cache(4);
+    auto a = read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    auto b = read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    a->setSRID(4326);
+    b->setSRID(3857);
+
+    auto pa = cache.prepare(*a);
+    auto pb = cache.prepare(*b);
+    ensure_equals(cache.size(), 2u);
+    ensure_equals(pa->getGeometry().getSRID(), 4326);
+    ensure_equals(pb->getGeometry().getSRID(), 3857);
+
+    auto z1 = read("LINESTRING Z (0 0 1, 10 10 2)");
+    auto z2 = read("LINESTRING Z (0 0 1, 10 10 3)");
+    auto xy = read("LINESTRING (0 0, 10 10)");
+    auto pz1 = cache.prepare(*z1);
+    auto pz2 = cache.prepare(*z2);
+    auto pxy = cache.prepare(*xy);
+    ensure_equals(cache.getNumHits(), 0u);
+    ensure_equals(pz2->getGeometry().getCoordinates()->getAt(1).z, 3.0);
+    ensure(pz2->getGeometry().equalsExact(z2.get()));
+    ensure_equals(pxy->getGeometry().getCoordinateDimension(), 2);
+
+    // an equal 3D geometry is found
+    auto z1copy = read("LINESTRING Z (0 0 1, 10 10 2)");
+    auto pz1copy = cache.prepare(*z1copy);
+    ensure_equals(cache.getNumHits(), 1u);
+    ensure(&pz1copy->getGeometry() == &pz1->getGeometry());
+}
+
+} // namespace tut
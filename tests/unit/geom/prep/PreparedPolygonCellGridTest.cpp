@@ -0,0 +1,103 @@
+//
+// Test Suite for the cell grid of geos::geom::prep::PreparedPolygon
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/algorithm/locate/AreaCellGrid.h>
+#include <geos/geom/prep/PreparedPolygon.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <memory>
+#include <string>
+
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::prep::PreparedPolygon;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_preparedpolygoncellgrid_data {
+    geos::geom::GeometryFactory::Ptr factory_;
+    geos::io::WKTReader reader_;
+
+    test_preparedpolygoncellgrid_data()
+        : factory_(geos::geom::GeometryFactory::create())
+        , reader_(factory_.get())
+    {}
+
+    void
+    checkPredicates(const PreparedPolygon& pg, const Geometry& g)
+    {
+        const Geometry& poly = pg.getGeometry();
+        ensure_equals(pg.contains(&g), poly.contains(&g));
+        ensure_equals(pg.covers(&g), poly.covers(&g));
+        ensure_equals(pg.intersects(&g), poly.intersects(&g));
+        ensure_equals(pg.containsProperly(&g), poly.relate(&g, "T**FF*FF*"));
+    }
+};
+
+typedef test_group<test_preparedpolygoncellgrid_data> group;
+typedef group::object object;
+
+group test_preparedpolygoncellgrid_group("geos::geom::prep::PreparedPolygonCellGrid");
+
+//
+// Test Cases
+//
+
+// Predicates agree with the unprepared ones for points, lines and polygons
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::unique_ptr<Geometry> poly = reader_.read(
+        "POLYGON ((0 0, 0 10, 4 5, 6 10, 7 5, 9 10, 10 5, 13 5, 15 10, 16 3, 17 10, 18 3, 25 10, 30 10, 30 0, 0 0),"
+        " (20 2, 20 4, 24 4, 24 2, 20 2))");
+    PreparedPolygon pg(poly.get());
+    pg.setCellGrid(32);
+    ensure(pg.getCellGrid() != nullptr);
+
+    for(double x = -1; x <= 31; x += 0.75) {
+        for(double y = -1; y <= 11; y += 0.75) {
+            std::unique_ptr<Geometry> pt(factory_->createPoint(geos::geom::Coordinate(x, y)));
+            checkPredicates(pg, *pt);
+
+            Envelope env(x, x + 0.6, y, y + 0.4);
+            std::unique_ptr<Geometry> box = factory_->toGeometry(&env);
+            checkPredicates(pg, *box);
+            std::unique_ptr<Geometry> line = box->getBoundary();
+            checkPredicates(pg, *line);
+        }
+    }
+}
+
+// The grid can be disabled
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::unique_ptr<Geometry> poly = reader_.read("POLYGON ((0 0, 10 0, 5 10, 0 0))");
+    std::unique_ptr<Geometry> pt = reader_.read("POINT (5 2)");
+    PreparedPolygon pg(poly.get());
+    ensure(pg.getCellGrid() == nullptr);
+
+    pg.setCellGrid(16, 1000);
+    ensure(pg.getCellGrid() != nullptr);
+    ensure(pg.getCellGrid()->getMemorySize() <= 1000u);
+    ensure(pg.contains(pt.get()));
+
+    pg.setCellGrid(0);
+    ensure(pg.getCellGrid() == nullptr);
+    ensure(pg.contains(pt.get()));
+}
+
+} // namespace tut
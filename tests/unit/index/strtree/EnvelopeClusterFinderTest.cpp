@@ -0,0 +1,63 @@
+//
+// Test Suite for geos::index::strtree::EnvelopeClusterFinder class.
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/geom/Envelope.h>
+#include <geos/index/strtree/EnvelopeClusterFinder.h>
+
+#include <vector>
+
+using geos::geom::Envelope;
+using geos::index::strtree::EnvelopeClusterFinder;
+
+namespace tut {
+// dummy data, not used
+struct test_envelopeclusterfinder_data {};
+
+using group = test_group<test_envelopeclusterfinder_data>;
+using object = group::object;
+group test_envelopeclusterfinder_group("geos::index::strtree::EnvelopeClusterFinder");
+
+//
+// Test Cases
+//
+
+// Clusters are transitive and ordered by their first item
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::vector<Envelope> env = {
+        Envelope(0, 1, 0, 1),
+        Envelope(10, 11, 0, 1),
+        Envelope(1, 2, 0, 1),     // touches 0
+        Envelope(20, 21, 0, 1),
+        Envelope(2, 3, 0, 1),     // touches 2 only
+        Envelope(10.5, 12, 0, 1)  // overlaps 1
+    };
+    std::vector<const Envelope*> envelopes;
+    for (const Envelope& e : env) {
+        envelopes.push_back(&e);
+    }
+
+    auto clusters = EnvelopeClusterFinder::cluster(envelopes);
+
+    ensure_equals(clusters.size(), 3u);
+    ensure(clusters[0] == std::vector<std::size_t>({0, 2, 4}));
+    ensure(clusters[1] == std::vector<std::size_t>({1, 5}));
+    ensure(clusters[2] == std::vector<std::size_t>({3}));
+}
+
+// No items
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::vector<const Envelope*> envelopes;
+    ensure(EnvelopeClusterFinder::cluster(envelopes).empty());
+}
+
+} // namespace tut
@@ -8,7 +8,9 @@
 #include <geos/index/ItemVisitor.h>
 #include <geos/io/WKTReader.h>
 
+#include <algorithm>
 #include <iostream>
+#include <set>
 
 using namespace geos;
 using geos::index::strtree::TemplateSTRtree;
@@ -383,6 +385,219 @@ void object::test<9>() {
 }
 #endif
 
+// Test querying a tree with removed items
+template<>
+template<>
+void object::test<10>() {
+    Grid grid;
+    grid.x0 = grid.y0 = 0;
+    grid.dx = grid.dy = 1;
+    grid.nx = grid.ny = 20;
+
+    auto geoms = pointGrid(grid);
+    auto tree = makeTree<const geom::Point*>(geoms);
+    tree.build();
+
+    for (std::size_t i = 0; i < geoms.size(); i += 2) {
+        ensure(tree.remove(*geoms[i]->getEnvelopeInternal(), geoms[i].get()));
+    }
+
+    std::vector<const geom::Point*> hits;
+    tree.query(grid.getEnvelope(), hits);
+    ensure_equals(hits.size(), geoms.size() / 2);
+}
+
+// Test visitor short-circuiting across tree nodes
+template<>
+template<>
+void object::test<11>() {
+    Grid grid;
+    grid.x0 = grid.y0 = 0;
+    grid.dx = grid.dy = 1;
+    grid.nx = grid.ny = 20;
+
+    auto geoms = pointGrid(grid);
+    auto tree = makeTree<const geom::Point*>(geoms);
+
+    std::size_t numVisited = 0;
+    tree.query(grid.getEnvelope(), [&numVisited](const geom::Point*) {
+        numVisited++;
+        return false;
+    });
+    ensure_equals(numVisited, 1u);
+}
+
+// Test k-nearest neighbour queries
+template<>
+template<>
+void object::test<12>() {
+    Grid grid;
+    grid.x0 = grid.y0 = 0;
+    grid.dx = grid.dy = 1;
+    grid.nx = grid.ny = 20;
+
+    auto geoms = pointGrid(grid);
+    auto tree = makeTree<const geom::Point*>(geoms);
+    tree.build();
+
+    // remove a row of points, which must not be found
+    for (std::size_t i = 0; i < geoms.size(); i++) {
+        if (geoms[i]->getY() == 10) {
+            ensure(tree.remove(*geoms[i]->getEnvelopeInternal(), geoms[i].get()));
+        }
+    }
+
+    struct PointDistance {
+        double operator()(const geom::Point* a, const geom::Point* b) {
+            return a->distance(b);
+        }
+    } dist;
+
+    auto gf = geom::GeometryFactory::create();
+    std::unique_ptr<geom::Point> q(gf->createPoint(geom::Coordinate(7.2, 10.4)));
+
+    auto nearest = tree.nearestNeighbours(*q->getEnvelopeInternal(), q.get(), dist, 5);
+    ensure_equals(nearest.size(), 5u);
+    ensure_equals(nearest[0].first->getX(), 7);
+    ensure_equals(nearest[0].first->getY(), 11);
+    ensure_equals(nearest[1].first->getX(), 8);
+    ensure_equals(nearest[1].first->getY(), 11);
+    for (std::size_t i = 0; i < nearest.size(); i++) {
+        ensure(nearest[i].first->getY() != 10);
+        ensure_equals(nearest[i].second, q->distance(nearest[i].first));
+        if (i > 0) {
+            ensure(nearest[i - 1].second <= nearest[i].second);
+        }
+    }
+
+    // the maximum distance limits the results
+    nearest = tree.nearestNeighbours(*q->getEnvelopeInternal(), q.get(), dist, 5, 1.0);
+    ensure_equals(nearest.size(), 2u);
+    nearest = tree.nearestNeighbours(*q->getEnvelopeInternal(), q.get(), dist, 0);
+    ensure(nearest.empty());
+}
+
+// Test batched k-nearest neighbour queries
+template<>
+template<>
+void object::test<13>() {
+    Grid grid;
+    grid.x0 = grid.y0 = 0;
+    grid.dx = grid.dy = 1;
+    grid.nx = grid.ny = 20;
+
+    auto geoms = pointGrid(grid);
+    auto tree = makeTree<const geom::Point*>(geoms);
+
+    struct PointDistance {
+        double operator()(const geom::Point* a, const geom::Point* b) {
+            return a->distance(b);
+        }
+    } dist;
+
+    grid.x0 = grid.y0 = -5.3;
+    grid.dx = grid.dy = 3.7;
+    grid.nx = grid.ny = 10;
+    auto queryGeoms = pointGrid(grid);
+
+    std::vector<std::pair<geom::Envelope, const geom::Point*>> queries;
+    for (const auto& g : queryGeoms) {
+        queries.emplace_back(*g->getEnvelopeInternal(), g.get());
+    }
+
+    std::vector<bool> isVisited(queries.size());
+    tree.nearestNeighbours(queries, dist, 3, 4.0,
+    [&](std::size_t i, const std::vector<std::pair<const geom::Point*, double>>& nearest) {
+        ensure(!isVisited[i]);
+        isVisited[i] = true;
+
+        auto expected = tree.nearestNeighbours(queries[i].first, queries[i].second, dist, 3, 4.0);
+        ensure_equals(nearest.size(), expected.size());
+        for (std::size_t j = 0; j < nearest.size(); j++) {
+            ensure_equals(nearest[j].second, expected[j].second);
+        }
+    });
+    ensure(std::find(isVisited.begin(), isVisited.end(), false) == isVisited.end());
+}
+
+// Test joining two trees
+template<>
+template<>
+void object::test<14>() {
+    Grid grid;
+    grid.x0 = grid.y0 = 0;
+    grid.dx = grid.dy = 1;
+    grid.nx = grid.ny = 20;
+    auto geoms1 = pointGrid(grid);
+    auto tree1 = makeTree<const geom::Point*>(geoms1);
+
+    grid.x0 = grid.y0 = 0.3;
+    grid.dx = grid.dy = 2.5;
+    grid.nx = grid.ny = 8;
+    auto geoms2 = pointGrid(grid);
+    auto tree2 = makeTree<const geom::Point*>(geoms2);
+
+    for (double maxDistance : {0.0, 0.5, 1.2}) {
+        std::size_t expected = 0;
+        for (const auto& g1 : geoms1) {
+            for (const auto& g2 : geoms2) {
+                if (g1->getEnvelopeInternal()->distance(*g2->getEnvelopeInternal()) <= maxDistance) {
+                    expected++;
+                }
+            }
+        }
+
+        std::size_t numPairs = 0;
+        tree1.join(tree2, maxDistance, [&](const geom::Point* a, const geom::Point* b) {
+            ensure(a->getEnvelopeInternal()->distance(*b->getEnvelopeInternal()) <= maxDistance);
+            numPairs++;
+        });
+        ensure_equals(numPairs, expected);
+    }
+
+    // points with equal coordinates
+    std::size_t numPairs = 0;
+    tree1.join(tree1, [&](const geom::Point* a, const geom::Point* b) {
+        ensure(a == b);
+        numPairs++;
+    });
+    ensure_equals(numPairs, geoms1.size());
+
+    // the join can be stopped by the visitor
+    numPairs = 0;
+    tree1.join(tree2, 1.2, [&](const geom::Point*, const geom::Point*) {
+        numPairs++;
+        return false;
+    });
+    ensure_equals(numPairs, 1u);
+}
+
+// Test joining a tree with itself
+template<>
+template<>
+void object::test<15>() {
+    Grid grid;
+    grid.x0 = grid.y0 = 0;
+    grid.dx = grid.dy = 1;
+    grid.nx = grid.ny = 20;
+    auto geoms = pointGrid(grid);
+    auto tree = makeTree<const geom::Point*>(geoms);
+
+    std::set<std::pair<const geom::Point*, const geom::Point*>> pairs;
+    tree.selfJoin(1.0, [&](const geom::Point* a, const geom::Point* b) {
+        ensure(a != b);
+        ensure(a->distance(b) <= 1.0);
+        ensure(pairs.emplace(std::min(a, b), std::max(a, b)).second);
+    });
+    // horizontal and vertical neighbours
+    ensure_equals(pairs.size(), 2u * 19u * 20u);
+
+    pairs.clear();
+    tree.selfJoin([&](const geom::Point* a, const geom::Point* b) {
+        pairs.emplace(a, b);
+    });
+    ensure(pairs.empty());
+}
 
 } // namespace tut
 
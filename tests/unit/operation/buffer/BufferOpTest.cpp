@@ -13,10 +13,12 @@
 #include <geos/geom/Geometry.h>
 #include <geos/geom/Polygon.h>
 #include <geos/algorithm/PointLocator.h>
+#include <geos/algorithm/Orientation.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
 #include <geos/geom/CoordinateSequence.h>
 // std
+#include <cmath>
 #include <memory>
 #include <string>
 #include <vector>
@@ -532,4 +534,91 @@ void object::test<19>
     ensure( 1 == GeomPtr(g0->buffer( -18 ))->getNumGeometries() );
 }
 
+// Buffers of disjoint points are computed without noding
+template<>
+template<>
+void object::test<20>
+()
+{
+    using geos::operation::buffer::BufferOp;
+    using geos::operation::buffer::BufferParameters;
+
+    GeomPtr g0(wktreader.read("MULTIPOINT ((0 0), (10 0), (0 10))"));
+    GeomPtr result(g0->buffer(1.0));
+
+    ensure(result->isValid());
+    ensure_equals(result->getGeometryTypeId(), geos::geom::GEOS_MULTIPOLYGON);
+    ensure_equals(result->getNumGeometries(), std::size_t(3));
+
+    GeomPtr single(GeomPtr(wktreader.read("POINT (0 0)"))->buffer(1.0));
+    ensure_equals_geometry(result->getGeometryN(0), single.get());
+
+    // overlapping point buffers still go through the full noding path
+    GeomPtr g1(wktreader.read("MULTIPOINT ((0 0), (1.5 0), (0 10))"));
+    GeomPtr result1(g1->buffer(1.0));
+    ensure(result1->isValid());
+    ensure_equals(result1->getNumGeometries(), std::size_t(2));
+
+    // square caps interact when their envelopes do
+    BufferParameters params;
+    params.setEndCapStyle(BufferParameters::CAP_SQUARE);
+    GeomPtr g2(wktreader.read("MULTIPOINT ((0 0), (1.9 1.9))"));
+    GeomPtr result2(BufferOp(g2.get(), params).getResultGeometry(1.0));
+    ensure(result2->isValid());
+    ensure_equals(result2->getGeometryTypeId(), geos::geom::GEOS_POLYGON);
+    ensure(std::fabs(result2->getArea() - 7.99) < 1e-9);
+}
+
+// Positive buffer of a convex polygon is computed without noding
+template<>
+template<>
+void object::test<21>
+()
+{
+    using geos::operation::buffer::BufferOp;
+    using geos::operation::buffer::BufferParameters;
+
+    GeomPtr g0(wktreader.read("POLYGON ((0 0, 0 10, 5 10, 10 10, 10 0, 0 0))"));
+    BufferParameters params;
+    params.setJoinStyle(BufferParameters::JOIN_MITRE);
+    GeomPtr result(BufferOp(g0.get(), params).getResultGeometry(1.0));
+
+    ensure(result->isValid());
+    ensure(std::fabs(result->getArea() - 144.0) < 1e-9);
+    ensure_equals(result->getEnvelopeInternal()->getWidth(), 12.0);
+    ensure(result->contains(g0.get()));
+
+    // a star polygon turns consistently but is not convex
+    GeomPtr g1(wktreader.read("POLYGON ((0 0, 10 30, 20 0, -5 20, 25 20, 0 0))"));
+    GeomPtr result1(g1->buffer(1.0));
+    ensure(result1->isValid());
+    ensure(result1->contains(g1.get()));
+}
+
+// Buffer of a two-point line is computed without noding
+template<>
+template<>
+void object::test<22>
+()
+{
+    using geos::operation::buffer::BufferOp;
+    using geos::operation::buffer::BufferParameters;
+
+    GeomPtr g0(wktreader.read("LINESTRING (0 0, 10 0)"));
+    BufferParameters params;
+    params.setEndCapStyle(BufferParameters::CAP_FLAT);
+    GeomPtr result(BufferOp(g0.get(), params).getResultGeometry(1.0));
+
+    ensure(result->isValid());
+    ensure(std::fabs(result->getArea() - 20.0) < 1e-9);
+    ensure(result->contains(g0.get()));
+
+    // buffer shells are oriented clockwise, as from the noded path
+    GeomPtr g1(wktreader.read("POLYGON ((0 0, 10 0, 10 10, 0 0))"));
+    GeomPtr result1(g1->buffer(1.0));
+    const auto* poly = dynamic_cast<const geos::geom::Polygon*>(result1.get());
+    ensure(poly != nullptr);
+    ensure_not(geos::algorithm::Orientation::isCCW(poly->getExteriorRing()->getCoordinatesRO()));
+}
+
 } // namespace tut
@@ -379,7 +379,36 @@ void object::test<11>
     catch (const GEOSException&) { }
 }
 
+// Distance to a point matches the distance to a Point geometry
+template<>
+template<>
+void object::test<12>
+()
+{
+    using geos::geom::Coordinate;
+    using geos::operation::distance::IndexedFacetDistance;
+    using geos::util::GEOSException;
+
+    std::string wkt("GEOMETRYCOLLECTION (LINESTRING (0 0, 100 0, 100 13, 11 10, 10 100, 0 97, 0 0), LINESTRING (3 3, 5 3, 5 5, 3 3), LINESTRING (50 50, 90 80, 60 95), POINT (80 30))");
+    GeomPtr g(_wktreader.read(wkt));
+    IndexedFacetDistance ifd(g.get());
 
+    for (int i = -20; i <= 120; i += 7) {
+        for (int j = -20; j <= 120; j += 7) {
+            Coordinate c(i + 0.5, j + 0.25);
+            GeomPtr pt(_factory->createPoint(c));
+            ensure_equals("distance", ifd.distance(c), g->distance(pt.get()), 1e-12);
+        }
+    }
+
+    GeomPtr empty(_wktreader.read("POLYGON EMPTY"));
+    IndexedFacetDistance ifdEmpty(empty.get());
+    try {
+        ifdEmpty.distance(Coordinate(1, 1));
+        fail("IndexedFacedDistance::distance did not throw on empty input");
+    }
+    catch (const GEOSException&) { }
+}
 
 // TODO: finish the tests by adding:
 // 	LINESTRING - *all*
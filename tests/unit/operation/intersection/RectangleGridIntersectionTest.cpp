@@ -0,0 +1,192 @@
+//
+// Test Suite for geos::operation::intersection::RectangleGridIntersection class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/operation/intersection/Rectangle.h>
+#include <geos/operation/intersection/RectangleGridIntersection.h>
+#include <geos/operation/intersection/RectangleIntersection.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/util/SineStarFactory.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_rectanglegridintersection_data {
+    geos::io::WKTReader wktreader;
+
+    typedef geos::geom::Geometry::Ptr GeomPtr;
+    typedef geos::operation::intersection::Rectangle Rectangle;
+    typedef geos::operation::intersection::RectangleIntersection RectangleIntersection;
+    typedef geos::operation::intersection::RectangleGridIntersection RectangleGridIntersection;
+
+    /*
+     * Checks that the tiles are the same as clipping
+     * to the rectangle of each tile separately.
+     */
+    void
+    checkGridClip(const geos::geom::Geometry& g, double originX, double originY,
+                  double cellSize, double buffer, int minCol, int maxCol, int minRow, int maxRow)
+    {
+        auto tiles = RectangleGridIntersection::clip(g, originX, originY, cellSize, cellSize, buffer);
+
+        std::map<std::pair<int, int>, const geos::geom::Geometry*> tileMap;
+        for(const auto& tile : tiles) {
+            ensure("duplicate tile", tileMap.emplace(std::make_pair(tile.col, tile.row), tile.geom.get()).second);
+        }
+
+        std::size_t numExpected = 0;
+        for(int col = minCol; col <= maxCol; col++) {
+            for(int row = minRow; row <= maxRow; row++) {
+                Rectangle rect(originX + col * cellSize - buffer, originY + row * cellSize - buffer,
+                               originX + (col + 1) * cellSize + buffer, originY + (row + 1) * cellSize + buffer);
+                GeomPtr expected = RectangleIntersection::clip(g, rect);
+                auto it = tileMap.find(std::make_pair(col, row));
+                if(expected->isEmpty()) {
+                    ensure("unexpected tile", it == tileMap.end());
+                    continue;
+                }
+                numExpected++;
+                ensure("missing tile", it != tileMap.end());
+                const geos::geom::Geometry* actual = it->second;
+                ensure_equals(actual->getDimension(), expected->getDimension());
+                ensure_equals("area", actual->getArea(), expected->getArea(), 1e-9);
+                ensure_equals("length", actual->getLength(), expected->getLength(), 1e-9);
+                if(expected->getDimension() == 2) {
+                    ensure_equals("symdifference", expected->symDifference(actual)->getArea(), 0.0, 1e-9);
+                }
+            }
+        }
+        ensure_equals(tiles.size(), numExpected);
+    }
+};
+
+typedef test_group<test_rectanglegridintersection_data> group;
+typedef group::object object;
+
+group test_rectanglegridintersection_group("geos::operation::intersection::RectangleGridIntersection");
+
+//
+// Test Cases
+//
+
+// Empty geometry has no tiles
+template<>
+template<>
+void object::test<1>
+()
+{
+    GeomPtr g(wktreader.read("POLYGON EMPTY"));
+    ensure(RectangleGridIntersection::clip(*g, 0, 0, 10, 10).empty());
+}
+
+// Geometry inside a single tile
+template<>
+template<>
+void object::test<2>
+()
+{
+    GeomPtr g(wktreader.read("POLYGON ((12 12, 18 12, 18 18, 12 12))"));
+    auto tiles = RectangleGridIntersection::clip(*g, 0, 0, 10, 10);
+    ensure_equals(tiles.size(), 1u);
+    ensure_equals(tiles[0].col, 1);
+    ensure_equals(tiles[0].row, 1);
+    ensure(tiles[0].geom->equalsExact(g.get()));
+}
+
+// Square covering whole tiles, with a hole
+template<>
+template<>
+void object::test<3>
+()
+{
+    GeomPtr g(wktreader.read("POLYGON ((-5 -5, 35 -5, 35 35, -5 35, -5 -5), (12 12, 18 12, 18 18, 12 18, 12 12))"));
+    auto tiles = RectangleGridIntersection::clip(*g, 0, 0, 10, 10);
+    ensure_equals(tiles.size(), 25u);
+    double area = 0;
+    for(const auto& tile : tiles) {
+        area += tile.geom->getArea();
+        if(tile.col >= 0 && tile.col <= 2 && tile.row >= 0 && tile.row <= 2 && !(tile.col == 1 && tile.row == 1)) {
+            ensure_equals("interior tile", tile.geom->getArea(), 100.0);
+        }
+    }
+    ensure_equals(area, g->getArea());
+    checkGridClip(*g, 0, 0, 10, 0, -3, 4, -3, 4);
+}
+
+// Mixed geometry types, with and without a buffer
+template<>
+template<>
+void object::test<4>
+()
+{
+    GeomPtr g(wktreader.read("GEOMETRYCOLLECTION (POINT (5 5), LINESTRING (0 0, 100 100, 100 0), POLYGON ((0 0, 10 0, 10 100, 0 0)), MULTIPOINT ((20 20), (10 10)))"));
+    checkGridClip(*g, 0, 0, 10, 0, -3, 13, -3, 13);
+    checkGridClip(*g, 0, 0, 10, 1, -3, 13, -3, 13);
+    checkGridClip(*g, 2.5, -1.5, 7, 0.5, -3, 16, -3, 16);
+}
+
+// Complex polygon matches clipping each tile separately
+template<>
+template<>
+void object::test<5>
+()
+{
+    auto gf = geos::geom::GeometryFactory::create();
+    geos::geom::util::SineStarFactory ssf(gf.get());
+    ssf.setCentre(geos::geom::Coordinate(0, 0));
+    ssf.setSize(200);
+    ssf.setNumPoints(2000);
+    ssf.setArmLengthRatio(0.5);
+    ssf.setNumArms(7);
+    auto star = ssf.createSineStar();
+    GeomPtr hole(wktreader.read("POLYGON ((-20 -20, 20 -20, 25 30, -20 20, -20 -20))"));
+    GeomPtr g = star->difference(hole.get());
+
+    checkGridClip(*g, 0, 0, 16, 0, -15, 15, -15, 15);
+    checkGridClip(*g, 3.3, -7.1, 23, 4, -11, 11, -11, 11);
+    checkGridClip(*star->getBoundary(), 0, 0, 16, 2, -15, 15, -15, 15);
+}
+
+// Invalid grids
+template<>
+template<>
+void object::test<6>
+()
+{
+    GeomPtr g(wktreader.read("POINT (1 1)"));
+    try {
+        RectangleGridIntersection::clip(*g, 0, 0, 0, 10);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+    try {
+        RectangleGridIntersection::clip(*g, 0, 0, 10, 10, -1);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+    GeomPtr large(wktreader.read("LINESTRING (0 0, 1e12 0)"));
+    try {
+        RectangleGridIntersection::clip(*large, 0, 0, 1, 1);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
+} // namespace tut
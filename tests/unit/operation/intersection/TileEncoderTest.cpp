@@ -0,0 +1,279 @@
+//
+// Test Suite for geos::operation::intersection::TileEncoder class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/operation/intersection/TileEncoder.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_tileencoder_data {
+    geos::io::WKTReader wktreader;
+
+    typedef geos::geom::Geometry::Ptr GeomPtr;
+    typedef geos::operation::intersection::TileEncoder TileEncoder;
+
+    // A tile in which the grid coordinates equal the input coordinates, with Y flipped
+    geos::geom::Envelope tileEnv;
+
+    test_tileencoder_data()
+        : tileEnv(0, 100, 0, 100)
+    {}
+
+    TileEncoder::Result
+    encode(const TileEncoder& encoder, const std::string& wkt)
+    {
+        GeomPtr g(wktreader.read(wkt));
+        TileEncoder::Result result;
+        encoder.encode(*g, result);
+        return result;
+    }
+
+    void
+    checkCoords(const TileEncoder::Result& result, const std::vector<int32_t>& expected)
+    {
+        ensure_equals(result.coords.size(), expected.size());
+        for(std::size_t i = 0; i < expected.size(); i++) {
+            ensure_equals(result.coords[i], expected[i]);
+        }
+    }
+
+    // Twice the signed area of each ring of a polygon result
+    static std::vector<int64_t>
+    ringAreas(const TileEncoder::Result& result)
+    {
+        std::vector<int64_t> areas;
+        std::size_t start = 0;
+        for(uint32_t n : result.parts) {
+            int64_t sum = 0;
+            for(std::size_t i = 0; i < n; i++) {
+                std::size_t j = (i + 1) % n;
+                sum += int64_t(result.coords[2 * (start + i)]) * result.coords[2 * (start + j) + 1]
+                       - int64_t(result.coords[2 * (start + j)]) * result.coords[2 * (start + i) + 1];
+            }
+            areas.push_back(sum);
+            start += n;
+        }
+        return areas;
+    }
+};
+
+typedef test_group<test_tileencoder_data> group;
+typedef group::object object;
+
+group test_tileencoder_group("geos::operation::intersection::TileEncoder");
+
+//
+// Test Cases
+//
+
+// Points are transformed to the tile grid, and clipped to the buffer
+template<>
+template<>
+void object::test<1>
+()
+{
+    TileEncoder encoder(tileEnv, 100, 10);
+
+    TileEncoder::Result result = encode(encoder, "POINT (10.4 19.6)");
+    ensure_equals(result.type, TileEncoder::POINT);
+    ensure_equals(result.parts.size(), 1u);
+    ensure_equals(result.parts[0], 1u);
+    checkCoords(result, {10, 80});
+
+    result = encode(encoder, "MULTIPOINT ((10 20), (105 50), (150 50))");
+    ensure_equals(result.type, TileEncoder::POINT);
+    ensure_equals(result.parts.size(), 1u);
+    ensure_equals(result.parts[0], 2u);
+    checkCoords(result, {10, 80, 105, 50});
+
+    result = encode(encoder, "POINT (150 50)");
+    ensure(result.isEmpty());
+    ensure_equals(result.type, TileEncoder::UNKNOWN);
+}
+
+// Lines are clipped and scaled
+template<>
+template<>
+void object::test<2>
+()
+{
+    TileEncoder encoder(geos::geom::Envelope(1000, 1200, 2000, 2200), 4096, 0);
+
+    TileEncoder::Result result = encode(encoder, "LINESTRING (900 2100, 1100 2100, 1100 2300)");
+    ensure_equals(result.type, TileEncoder::LINESTRING);
+    ensure_equals(result.parts.size(), 1u);
+    checkCoords(result, {0, 2048, 2048, 2048, 2048, 0});
+}
+
+// Repeated points are removed, collapsed lines are dropped, and lines are simplified
+template<>
+template<>
+void object::test<3>
+()
+{
+    TileEncoder encoder(tileEnv, 100, 0);
+
+    TileEncoder::Result result = encode(encoder, "MULTILINESTRING ((10 10, 10.2 10.2, 20 10), (50 50, 50.3 50.1))");
+    ensure_equals(result.parts.size(), 1u);
+    checkCoords(result, {10, 90, 20, 90});
+
+    result = encode(encoder, "LINESTRING (0 50, 25 52, 50 50)");
+    checkCoords(result, {0, 50, 25, 48, 50, 50});
+
+    encoder.setSimplifyTolerance(3);
+    result = encode(encoder, "LINESTRING (0 50, 25 52, 50 50)");
+    checkCoords(result, {0, 50, 50, 50});
+}
+
+// Polygon rings are oriented and not closed
+template<>
+template<>
+void object::test<4>
+()
+{
+    TileEncoder encoder(tileEnv, 100, 0);
+
+    for(const char* wkt : {
+                "POLYGON ((10 10, 90 10, 90 90, 10 90, 10 10), (20 20, 20 30, 30 30, 30 20, 20 20))",
+                "POLYGON ((10 10, 10 90, 90 90, 90 10, 10 10), (20 20, 30 20, 30 30, 20 30, 20 20))"
+            }) {
+        TileEncoder::Result result = encode(encoder, wkt);
+        ensure_equals(result.type, TileEncoder::POLYGON);
+        ensure_equals(result.parts.size(), 2u);
+        ensure_equals(result.parts[0], 4u);
+        ensure_equals(result.parts[1], 4u);
+        std::vector<int64_t> areas = ringAreas(result);
+        ensure_equals(areas[0], 2 * 6400);
+        ensure_equals(areas[1], -2 * 100);
+    }
+}
+
+// Collapsed rings are dropped, with the holes of collapsed shells
+template<>
+template<>
+void object::test<5>
+()
+{
+    TileEncoder encoder(tileEnv, 100, 0);
+
+    TileEncoder::Result result = encode(encoder, "POLYGON ((10 10, 10.2 10, 10.2 10.2, 10 10))");
+    ensure(result.isEmpty());
+    ensure_equals(result.type, TileEncoder::UNKNOWN);
+
+    result = encode(encoder, "MULTIPOLYGON (((10 10, 90 10, 90 90, 10 90, 10 10), (20 20, 20.2 20, 20.2 20.2, 20 20)), ((95 95, 95.2 95, 95.2 95.2, 95 95)))");
+    ensure_equals(result.parts.size(), 1u);
+    ensure_equals(ringAreas(result)[0], 2 * 6400);
+}
+
+// Polygons made invalid by rounding are repaired
+template<>
+template<>
+void object::test<6>
+()
+{
+    TileEncoder encoder(tileEnv, 100, 0);
+    // after rounding the hole touches the shell along an edge
+    std::string wkt("POLYGON ((10 10, 90 10, 90 90, 10 90, 10 10), (20 10.3, 30 20, 40 10.3, 20 10.3))");
+
+    TileEncoder::Result result = encode(encoder, wkt);
+    ensure_equals(result.type, TileEncoder::POLYGON);
+    int64_t area = 0;
+    for(int64_t ringArea : ringAreas(result)) {
+        area += ringArea;
+    }
+    ensure_equals(area, 2 * (6400 - 100));
+    ensure(ringAreas(result)[0] > 0);
+
+    encoder.setFixValidity(false);
+    result = encode(encoder, wkt);
+    ensure_equals(result.parts.size(), 2u);
+}
+
+// Components of lower dimension are dropped
+template<>
+template<>
+void object::test<7>
+()
+{
+    TileEncoder encoder(tileEnv, 100, 0);
+
+    TileEncoder::Result result = encode(encoder, "GEOMETRYCOLLECTION (POINT (5 5), LINESTRING (0 0, 10 10), POLYGON ((10 10, 90 10, 90 90, 10 90, 10 10)))");
+    ensure_equals(result.type, TileEncoder::POLYGON);
+    ensure_equals(result.parts.size(), 1u);
+    ensure_equals(result.coords.size(), 8u);
+}
+
+// Invalid arguments
+template<>
+template<>
+void object::test<8>
+()
+{
+    try {
+        TileEncoder encoder(geos::geom::Envelope(0, 0, 0, 10));
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+    try {
+        TileEncoder encoder(tileEnv, 0);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+    try {
+        TileEncoder encoder(tileEnv);
+        encoder.setSimplifyTolerance(-1);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+    try {
+        TileEncoder encoder(tileEnv, 0x7fffffff, 1);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+    // the largest extent which fits
+    TileEncoder encoder(tileEnv, 0x7ffffffe, 1);
+}
+
+// Components of nested collections are encoded
+template<>
+template<>
+void object::test<9>
+()
+{
+    TileEncoder encoder(tileEnv, 100, 0);
+
+    TileEncoder::Result result = encode(encoder, "GEOMETRYCOLLECTION (GEOMETRYCOLLECTION (POLYGON ((10 10, 90 10, 90 90, 10 90, 10 10))), MULTIPOLYGON (((0 0, 5 0, 5 5, 0 5, 0 0))))");
+    ensure_equals(result.type, TileEncoder::POLYGON);
+    ensure_equals(result.parts.size(), 2u);
+
+    result = encode(encoder, "GEOMETRYCOLLECTION (GEOMETRYCOLLECTION (LINESTRING (10 10, 20 10)), MULTILINESTRING ((30 30, 40 30)))");
+    ensure_equals(result.type, TileEncoder::LINESTRING);
+    ensure_equals(result.parts.size(), 2u);
+    checkCoords(result, {10, 90, 20, 90, 30, 70, 40, 70});
+
+    result = encode(encoder, "GEOMETRYCOLLECTION (GEOMETRYCOLLECTION (POINT (10 10)), MULTIPOINT ((20 20)))");
+    ensure_equals(result.type, TileEncoder::POINT);
+    ensure_equals(result.parts.size(), 1u);
+    ensure_equals(result.parts[0], 2u);
+}
+
+} // namespace tut
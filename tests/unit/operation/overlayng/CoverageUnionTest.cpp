@@ -0,0 +1,158 @@
+//
+// Test Suite for geos::operation::overlayng::CoverageUnion class.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/operation/overlayng/CoverageUnion.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+
+// std
+#include <memory>
+
+using namespace geos::geom;
+using namespace geos::operation::overlayng;
+using geos::io::WKTReader;
+using geos::io::WKTWriter;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_coverageunionng_data {
+
+    WKTReader r;
+    WKTWriter w;
+
+    void
+    checkUnion(const std::string& wkt, const std::string& wktExpected, bool isFallback = false)
+    {
+        std::unique_ptr<Geometry> geom = r.read(wkt);
+        std::unique_ptr<Geometry> expected = r.read(wktExpected);
+        OverlayNGRobust::resetStrategyCounts();
+        std::unique_ptr<Geometry> result = CoverageUnion::geomunion(geom.get());
+        // std::cout << std::endl << w.write(result.get()) << std::endl;
+        ensure(result->isValid());
+        ensure_equals(result->getGeometryTypeId(), expected->getGeometryTypeId());
+        ensure(result->equals(expected.get()));
+        // the fallback is a full robust union
+        std::size_t robustCount = OverlayNGRobust::getStrategyCount(OverlayNGRobust::STRATEGY_FLOATING);
+        ensure_equals(robustCount > 0, isFallback);
+    }
+
+};
+
+typedef test_group<test_coverageunionng_data> group;
+typedef group::object object;
+
+group test_coverageunionng_group("geos::operation::overlayng::CoverageUnion");
+
+//
+// Test Cases
+//
+
+// adjacent polygons
+template<>
+template<>
+void object::test<1> ()
+{
+    checkUnion(
+        "MULTIPOLYGON (((0 0, 0 1, 1 1, 1 0, 0 0)), ((1 0, 1 1, 2 1, 2 0, 1 0)))",
+        "POLYGON ((0 0, 0 1, 2 1, 2 0, 0 0))"
+        );
+}
+
+// grid of polygons with an interior node
+template<>
+template<>
+void object::test<2> ()
+{
+    checkUnion(
+        "GEOMETRYCOLLECTION (POLYGON ((0 0, 0 1, 1 1, 1 0, 0 0)), POLYGON ((1 0, 1 1, 2 1, 2 0, 1 0)), POLYGON ((0 1, 0 2, 1 2, 1 1, 0 1)), POLYGON ((1 1, 1 2, 2 2, 2 1, 1 1)))",
+        "POLYGON ((0 0, 0 2, 2 2, 2 0, 0 0))"
+        );
+}
+
+// polygons touching at a vertex are noded there
+template<>
+template<>
+void object::test<3> ()
+{
+    checkUnion(
+        "MULTIPOLYGON (((0 0, 0 1, 1 1, 1 0, 0 0)), ((1 1, 1 2, 2 2, 2 1, 1 1)), ((1 0, 1 1, 2 1, 3 1, 3 0, 1 0)))",
+        "POLYGON ((0 0, 0 1, 1 1, 1 2, 2 2, 2 1, 3 1, 3 0, 0 0))"
+        );
+}
+
+// hole filled by another polygon
+template<>
+template<>
+void object::test<4> ()
+{
+    checkUnion(
+        "MULTIPOLYGON (((0 0, 0 3, 3 3, 3 0, 0 0), (1 1, 2 1, 2 2, 1 2, 1 1)), ((1 1, 1 2, 2 2, 2 1, 1 1)))",
+        "POLYGON ((0 0, 0 3, 3 3, 3 0, 0 0))"
+        );
+}
+
+// gap between polygons is preserved as a hole
+template<>
+template<>
+void object::test<5> ()
+{
+    checkUnion(
+        "MULTIPOLYGON (((0 0, 0 3, 1 3, 1 2, 1 1, 2 1, 2 0, 0 0)), ((2 0, 2 1, 2 2, 1 2, 1 3, 3 3, 3 0, 2 0)))",
+        "POLYGON ((0 0, 0 3, 3 3, 3 0, 0 0), (1 1, 2 1, 2 2, 1 2, 1 1))"
+        );
+}
+
+// overlapping polygons are unioned by the fallback
+template<>
+template<>
+void object::test<6> ()
+{
+    checkUnion(
+        "MULTIPOLYGON (((0 0, 0 1, 1 1, 1 0, 0 0)), ((0.5 0, 0.5 1, 2 1, 2 0, 0.5 0)))",
+        "POLYGON ((0 0, 0 1, 2 1, 2 0, 0 0))",
+        true
+        );
+}
+
+// edges which are not matched exactly are unioned by the fallback
+template<>
+template<>
+void object::test<7> ()
+{
+    checkUnion(
+        "MULTIPOLYGON (((0 0, 0 1, 2 1, 2 0, 0 0)), ((0 1, 0 2, 1 2, 1 1, 0 1)))",
+        "POLYGON ((0 0, 0 2, 1 2, 1 1, 2 1, 2 0, 0 0))",
+        true
+        );
+}
+
+// a clean cluster and an overlapping cluster
+template<>
+template<>
+void object::test<8> ()
+{
+    checkUnion(
+        "MULTIPOLYGON (((0 0, 0 1, 1 1, 1 0, 0 0)), ((1 0, 1 1, 2 1, 2 0, 1 0)), ((10 0, 10 1, 11 1, 11 0, 10 0)), ((10.5 0, 10.5 1, 12 1, 12 0, 10.5 0)), ((20 0, 20 1, 21 1, 20 0)))",
+        "MULTIPOLYGON (((0 0, 0 1, 2 1, 2 0, 0 0)), ((10 0, 10 1, 12 1, 12 0, 10 0)), ((20 0, 20 1, 21 1, 20 0)))",
+        true
+        );
+}
+
+// empty input
+template<>
+template<>
+void object::test<9> ()
+{
+    std::unique_ptr<Geometry> geom = r.read("MULTIPOLYGON EMPTY");
+    std::unique_ptr<Geometry> result = CoverageUnion::geomunion(geom.get());
+    ensure(result->isEmpty());
+}
+
+} // namespace tut
@@ -14,6 +14,7 @@
 // geos
 #include <geos/operation/overlayng/OverlayNGRobust.h>
 #include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/geom/PrecisionModel.h>
 
 // std
 #include <memory>
@@ -93,6 +94,38 @@ void object::test<2> ()
     checkOverlaySuccess(a, b, OverlayNG::INTERSECTION);
 }
 
+/**
+* Floating noding failure is reported as a status,
+* and the strategy which computed the result is counted.
+*/
+template<>
+template<>
+void object::test<3> ()
+{
+    std::string a = "POLYGON ((654948.3853299792 1794977.105854025, 655016.3812220972 1794939.918901604, 655016.2022581929 1794940.1099794197, 655014.9264068712 1794941.4254068714, 655014.7408834674 1794941.6101225375, 654948.3853299792 1794977.105854025))";
+    std::string b = "POLYGON ((655103.6628454948 1794805.456674405, 655016.20226 1794940.10998, 655014.8317182435 1794941.5196832407, 655014.8295602322 1794941.5218318563, 655014.740883467 1794941.610122538, 655016.6029214273 1794938.7590508445, 655103.6628454948 1794805.456674405))";
+    std::unique_ptr<Geometry> geom_a = r.read(a);
+    std::unique_ptr<Geometry> geom_b = r.read(b);
+
+    PrecisionModel pmFloat;
+    OverlayNG ov(geom_a.get(), geom_b.get(), &pmFloat, OverlayNG::INTERSECTION);
+    ov.setThrowOnInvalidNoding(false);
+    ensure(ov.getResult() == nullptr);
+    ensure(! ov.getNodingError().empty());
+
+    OverlayNGRobust::resetStrategyCounts();
+    std::unique_ptr<Geometry> result = OverlayNGRobust::Overlay(geom_a.get(), geom_b.get(), OverlayNG::INTERSECTION);
+    ensure(result != nullptr);
+    ensure_equals(OverlayNGRobust::getStrategyCount(OverlayNGRobust::STRATEGY_FLOATING), 0u);
+    ensure_equals(OverlayNGRobust::getStrategyCount(OverlayNGRobust::STRATEGY_SNAPPING)
+                  + OverlayNGRobust::getStrategyCount(OverlayNGRobust::STRATEGY_SNAP_BOTH)
+                  + OverlayNGRobust::getStrategyCount(OverlayNGRobust::STRATEGY_SNAP_ROUNDING), 1u);
+
+    std::unique_ptr<Geometry> c = r.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    std::unique_ptr<Geometry> d = r.read("POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+    OverlayNGRobust::Overlay(c.get(), d.get(), OverlayNG::UNION);
+    ensure_equals(OverlayNGRobust::getStrategyCount(OverlayNGRobust::STRATEGY_FLOATING), 1u);
+}
 
 
 } // namespace tut
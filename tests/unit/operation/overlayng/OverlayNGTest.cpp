@@ -6,6 +6,9 @@
 
 // geos
 #include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
 
 // std
 #include <memory>
@@ -582,4 +585,75 @@ void object::test<45> ()
     testOverlay(a, b, exp, OverlayNG::INTERSECTION, 0);
 }
 
+template<>
+template<>
+void object::test<46> ()
+{
+    set_test_name("testPolygonDisjointComponentsUnion");
+    std::string a = "MULTIPOLYGON (((0 0, 0 10, 10 10, 10 0, 0 0)), ((100 0, 100 10, 110 10, 110 0, 100 0)))";
+    std::string b = "MULTIPOLYGON (((5 5, 5 15, 15 15, 15 5, 5 5)), ((200 0, 200 10, 210 10, 210 0, 200 0)))";
+    std::string exp = "MULTIPOLYGON (((0 0, 0 10, 5 10, 5 15, 15 15, 15 5, 10 5, 10 0, 0 0)), ((100 0, 100 10, 110 10, 110 0, 100 0)), ((200 0, 200 10, 210 10, 210 0, 200 0)))";
+    testOverlay(a, b, exp, OverlayNG::UNION, 0);
+}
+
+template<>
+template<>
+void object::test<47> ()
+{
+    set_test_name("testPolygonDisjointComponentsDifference");
+    std::string a = "MULTIPOLYGON (((0 0, 0 10, 10 10, 10 0, 0 0)), ((100 0, 100 10, 110 10, 110 0, 100 0)))";
+    std::string b = "MULTIPOLYGON (((5 5, 5 15, 15 15, 15 5, 5 5)), ((200 0, 200 10, 210 10, 210 0, 200 0)))";
+    std::string exp = "MULTIPOLYGON (((0 0, 0 10, 5 10, 5 5, 10 5, 10 0, 0 0)), ((100 0, 100 10, 110 10, 110 0, 100 0)))";
+    testOverlay(a, b, exp, OverlayNG::DIFFERENCE, 0);
+    std::string expBA = "MULTIPOLYGON (((5 10, 5 15, 15 15, 15 5, 10 5, 10 10, 5 10)), ((200 0, 200 10, 210 10, 210 0, 200 0)))";
+    testOverlay(b, a, expBA, OverlayNG::DIFFERENCE, 0);
+}
+
+template<>
+template<>
+void object::test<48> ()
+{
+    set_test_name("testPolygonDisjointComponentsSymDifference");
+    std::string a = "MULTIPOLYGON (((0 0, 0 10, 10 10, 10 0, 0 0)), ((100 0, 100 10, 110 10, 110 0, 100 0)))";
+    std::string b = "POLYGON ((200 0, 200 10, 210 10, 210 0, 200 0))";
+    std::string exp = "MULTIPOLYGON (((0 0, 0 10, 10 10, 10 0, 0 0)), ((100 0, 100 10, 110 10, 110 0, 100 0)), ((200 0, 200 10, 210 10, 210 0, 200 0)))";
+    testOverlay(a, b, exp, OverlayNG::SYMDIFFERENCE, 0);
+    // disjoint components are not partitioned when snap-rounding
+    testOverlay(a, b, exp, OverlayNG::SYMDIFFERENCE, 1);
+}
+
+template<>
+template<>
+void object::test<49> ()
+{
+    set_test_name("testPolygonDisjointComponentsMatchFullOverlay");
+    // disjoint components with CCW shells, CW holes and repeated points
+    std::string a = "MULTIPOLYGON (((0 0, 10 0, 10 0, 10 10, 0 10, 0 0), (2 2, 2 8, 8 8, 8 2, 2 2)), ((100 0, 110 0, 110 10, 100 10, 100 0)))";
+    std::string b = "MULTIPOLYGON (((5 5, 15 5, 15 15, 5 15, 5 5)), ((200 0, 210 0, 210 10, 210 10, 200 10, 200 0), (202 2, 202 8, 208 8, 208 2, 202 2)))";
+    std::unique_ptr<Geometry> geom_a = r.read(a);
+    std::unique_ptr<Geometry> geom_b = r.read(b);
+    PrecisionModel pm;
+
+    for (int opCode : { OverlayNG::UNION, OverlayNG::DIFFERENCE, OverlayNG::SYMDIFFERENCE }) {
+        OverlayNG ov(geom_a.get(), geom_b.get(), &pm, opCode);
+        std::unique_ptr<Geometry> result = ov.getResult();
+
+        OverlayNG ovFull(geom_a.get(), geom_b.get(), &pm, opCode);
+        ovFull.setOptimized(false);
+        std::unique_ptr<Geometry> expected = ovFull.getResult();
+
+        for (std::size_t i = 0; i < result->getNumGeometries(); i++) {
+            const Polygon* poly = static_cast<const Polygon*>(result->getGeometryN(i));
+            ensure(! geos::algorithm::Orientation::isCCW(poly->getExteriorRing()->getCoordinatesRO()));
+            for (std::size_t j = 0; j < poly->getNumInteriorRing(); j++) {
+                ensure(geos::algorithm::Orientation::isCCW(poly->getInteriorRingN(j)->getCoordinatesRO()));
+            }
+        }
+
+        result->normalize();
+        expected->normalize();
+        ensure(result->equalsExact(expected.get()));
+    }
+}
+
 } // namespace tut
@@ -0,0 +1,192 @@
+// Test Suite for the sorting functions of geos::shape::fractal
+
+// tut
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/shape/fractal/CurveSort.h>
+#include <geos/shape/fractal/HilbertCode.h>
+#include <geos/shape/fractal/MortonCode.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/Executor.h>
+// std
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using geos::geom::Coordinate;
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::shape::fractal::Curve;
+using geos::shape::fractal::HilbertCode;
+using geos::shape::fractal::MortonCode;
+
+namespace tut {
+
+// Common data used by tests
+struct test_curvesort_data {
+    geos::geom::GeometryFactory::Ptr factory_;
+    geos::io::WKTReader reader_;
+
+    test_curvesort_data()
+        : factory_(geos::geom::GeometryFactory::create())
+        , reader_(factory_.get())
+    {}
+
+    // Checks that an order sorts codes, keeping equal codes in their order
+    static void
+    checkOrder(const std::vector<uint32_t>& codes, const std::vector<std::size_t>& ord)
+    {
+        std::vector<std::size_t> expected(codes.size());
+        std::iota(expected.begin(), expected.end(), std::size_t(0));
+        std::stable_sort(expected.begin(), expected.end(), [&codes](std::size_t a, std::size_t b) {
+            return codes[a] < codes[b];
+        });
+        ensure(ord == expected);
+    }
+};
+
+typedef test_group<test_curvesort_data> group;
+typedef group::object object;
+
+group test_curvesort_group("geos::shape::fractal::CurveSort");
+
+//
+// Test Cases
+//
+
+// Radix sort of codes, serial and parallel
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::mt19937 rng(42);
+    std::vector<uint32_t> codes(100000);
+    for(uint32_t& c : codes) {
+        // few distinct values, to check stability
+        c = static_cast<uint32_t>(rng()) & 0xff00ff0f;
+    }
+
+    checkOrder(codes, geos::shape::fractal::sortOrder(codes));
+
+    geos::util::Executor executor(4);
+    checkOrder(codes, geos::shape::fractal::sortOrder(codes, &executor));
+    checkOrder(codes, geos::shape::fractal::sortOrder(codes, &executor, 3));
+
+    std::vector<uint32_t> empty;
+    ensure(geos::shape::fractal::sortOrder(empty).empty());
+}
+
+// Codes of points over an extent
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::vector<double> x = {0, 10, 10, 0, 5, -100, 1.0 / 0.0};
+    std::vector<double> y = {0, 0, 10, 10, 5, 5, 0};
+    Envelope extent(0, 10, 0, 10);
+    uint32_t maxOrd = HilbertCode::maxOrdinate(HilbertCode::MAX_LEVEL);
+
+    std::vector<uint32_t> codes = geos::shape::fractal::encode(x.data(), y.data(), x.size(),
+                                  Curve::HILBERT, extent);
+    ensure_equals(codes[0], HilbertCode::encode(HilbertCode::MAX_LEVEL, 0, 0));
+    ensure_equals(codes[2], HilbertCode::encode(HilbertCode::MAX_LEVEL, maxOrd, maxOrd));
+    // points outside the extent are moved to its edges
+    ensure_equals(codes[5], HilbertCode::encode(HilbertCode::MAX_LEVEL, 0, maxOrd / 2));
+    ensure_equals(codes[6], 0u);
+
+    codes = geos::shape::fractal::encode(x.data(), y.data(), x.size(), Curve::MORTON, extent);
+    ensure_equals(codes[1], MortonCode::encode(static_cast<int>(maxOrd), 0));
+    ensure_equals(codes[3], MortonCode::encode(0, static_cast<int>(maxOrd)));
+}
+
+// Hilbert order of the points of a grid visits neighbours in turn
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::vector<double> x;
+    std::vector<double> y;
+    for(int i = 0; i < 16; i++) {
+        for(int j = 0; j < 16; j++) {
+            x.push_back(i + 0.5);
+            y.push_back(j + 0.5);
+        }
+    }
+    // each point is in a different block of 2^12 x 2^12 cells of the curve
+    Envelope extent(0, 16, 0, 16);
+    std::vector<std::size_t> ord = geos::shape::fractal::order(x.data(), y.data(), x.size(),
+                                   Curve::HILBERT, &extent);
+    for(std::size_t k = 1; k < ord.size(); k++) {
+        double dx = x[ord[k]] - x[ord[k - 1]];
+        double dy = y[ord[k]] - y[ord[k - 1]];
+        ensure_equals(dx * dx + dy * dy, 1.0);
+    }
+}
+
+// Sorting geometries, with empty geometries first
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    geoms.push_back(reader_.read("POINT (10 0)"));
+    geoms.push_back(reader_.read("LINESTRING (0 0, 1 1)"));
+    geoms.push_back(reader_.read("POINT EMPTY"));
+    geoms.push_back(reader_.read("POLYGON ((0 9, 1 9, 1 10, 0 10, 0 9))"));
+    geoms.push_back(reader_.read("POINT (10 10)"));
+
+    geos::shape::fractal::sort(geoms);
+    ensure(geoms[0]->isEmpty());
+    ensure_equals_geometry(geoms[1].get(), "LINESTRING (0 0, 1 1)");
+    ensure_equals_geometry(geoms[2].get(), "POLYGON ((0 9, 1 9, 1 10, 0 10, 0 9))");
+    ensure_equals_geometry(geoms[3].get(), "POINT (10 10)");
+    ensure_equals_geometry(geoms[4].get(), "POINT (10 0)");
+
+    // an explicit extent placing all geometries in one cell keeps the
+    // order of the non-empty geometries
+    std::vector<const Geometry*> ptrs;
+    for(const auto& g : geoms) {
+        ptrs.push_back(g.get());
+    }
+    std::reverse(ptrs.begin(), ptrs.end());
+    std::vector<const Geometry*> expected = ptrs;
+    std::stable_partition(expected.begin(), expected.end(), [](const Geometry* g) {
+        return g->isEmpty();
+    });
+    Envelope hugeExtent(-1e300, 1e300, -1e300, 1e300);
+    geos::shape::fractal::sort(ptrs, Curve::MORTON, &hugeExtent);
+    ensure(ptrs == expected);
+}
+
+// Sorting a coordinate sequence
+template<>
+template<>
+void object::test<5>
+()
+{
+    geos::geom::CoordinateArraySequence seq;
+    seq.add(Coordinate(1, 1, 3));
+    seq.add(Coordinate(0, 1, 2));
+    seq.add(Coordinate(1, 0, 4));
+    seq.add(Coordinate(0, 0, 1));
+
+    geos::shape::fractal::sort(seq, Curve::MORTON);
+    ensure_equals(seq.getAt(0).z, 1.0);
+    ensure_equals(seq.getAt(1).z, 4.0);
+    ensure_equals(seq.getAt(2).z, 2.0);
+    ensure_equals(seq.getAt(3).z, 3.0);
+}
+
+} // namespace tut
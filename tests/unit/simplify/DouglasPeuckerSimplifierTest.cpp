@@ -12,6 +12,8 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateSequenceFilter.h>
 #include <geos/simplify/DouglasPeuckerSimplifier.h>
+#include <geos/simplify/DouglasPeuckerLineSimplifier.h>
+#include <geos/util/Executor.h>
 #include <geos/util.h>
 // std
 #include <string>
@@ -433,4 +435,59 @@ void object::test<15>
 }
 
 
+// Long lines and the batch API
+template<>
+template<>
+void object::test<16>
+()
+{
+    typedef DouglasPeuckerLineSimplifier::CoordsVect CoordsVect;
+
+    // a zigzag keeps all its points, a straight line only its endpoints
+    CoordsVect zigzag;
+    CoordsVect straight;
+    for(int i = 0; i < 100000; i++) {
+        zigzag.emplace_back(i, (i % 2) * 10);
+        straight.emplace_back(i, 2 * i);
+    }
+
+    std::vector<const CoordsVect*> lines{ &zigzag, &straight };
+    std::vector<DouglasPeuckerLineSimplifier::CoordsVectAutoPtr> results =
+        DouglasPeuckerLineSimplifier::simplify(lines, 1.0);
+
+    ensure_equals(results.size(), 2u);
+    ensure_equals(results[0]->size(), zigzag.size());
+    ensure_equals(results[1]->size(), 2u);
+    ensure_equals(results[1]->back(), straight.back());
+}
+
+// Lines simplified in several threads give the serial result
+template<>
+template<>
+void object::test<17>
+()
+{
+    typedef DouglasPeuckerLineSimplifier::CoordsVect CoordsVect;
+
+    std::vector<CoordsVect> inputs(100);
+    std::vector<const CoordsVect*> lines;
+    for(std::size_t i = 0; i < inputs.size(); i++) {
+        for(std::size_t j = 0; j < 1000; j++) {
+            inputs[i].emplace_back(double(j), double((j * j + i) % 17));
+        }
+        lines.push_back(&inputs[i]);
+    }
+
+    geos::util::Executor executor(4);
+    std::vector<DouglasPeuckerLineSimplifier::CoordsVectAutoPtr> expected =
+        DouglasPeuckerLineSimplifier::simplify(lines, 4.0);
+    std::vector<DouglasPeuckerLineSimplifier::CoordsVectAutoPtr> results =
+        DouglasPeuckerLineSimplifier::simplify(lines, 4.0, &executor);
+
+    ensure_equals(results.size(), lines.size());
+    for(std::size_t i = 0; i < results.size(); i++) {
+        ensure(*results[i] == *expected[i]);
+    }
+}
+
 } // namespace tut
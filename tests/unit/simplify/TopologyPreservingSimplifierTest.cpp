@@ -6,7 +6,9 @@
 #include <utility.h>
 // geos
 #include <geos/simplify/TopologyPreservingSimplifier.h>
+#include <geos/util/Executor.h>
 // std
+#include <sstream>
 #include <string>
 #include <memory>
 
@@ -354,5 +356,55 @@ void object::test<16>
     ensure_equals(wktwriter.write(simp.get()),
                   "GEOMETRYCOLLECTION (LINESTRING (0 0, 10 0))");
 }
-} // namespace tut
+// Lines in separate clusters are simplified independently,
+// while conflicts within each cluster are still detected
+template<>
+template<>
+void object::test<17>
+()
+{
+    std::string wkt("MULTILINESTRING ( \
+                    (0 0, 50 5, 100 0), (50 -2, 50 2), \
+                    (1000 0, 1050 5, 1100 0), (1000 30, 1100 30))");
+
+    GeomPtr g(wktreader.read(wkt));
+    GeomPtr simp = TopologyPreservingSimplifier::simplify(g.get(), 10);
+
+    ensure("Simplified geometry is invalid!", simp->isValid());
+    ensure_equals(wktwriter.write(simp.get()),
+                  "MULTILINESTRING ((0 0, 50 5, 100 0), (50 -2, 50 2), "
+                  "(1000 0, 1100 0), (1000 30, 1100 30))");
+}
 
+// Clusters simplified in several threads give the serial result
+template<>
+template<>
+void object::test<18>
+()
+{
+    std::ostringstream wkt;
+    wkt << "MULTILINESTRING (";
+    for(std::size_t i = 0; i < 200; i++) {
+        std::size_t x0 = i * 1000;
+        wkt << (i ? ", " : "") << "(" << x0 << " 0";
+        for(std::size_t j = 1; j <= 50; j++) {
+            wkt << ", " << x0 + j * 10 << " " << (j * j * (i + 1)) % 13;
+        }
+        wkt << "), (" << x0 + 250 << " -2, " << x0 + 250 << " 14)";
+    }
+    wkt << ")";
+    GeomPtr g(wktreader.read(wkt.str()));
+
+    GeomPtr expected = TopologyPreservingSimplifier::simplify(g.get(), 5);
+
+    geos::util::Executor executor(4);
+    TopologyPreservingSimplifier tps(g.get());
+    tps.setDistanceTolerance(5);
+    tps.setExecutor(&executor);
+    GeomPtr simp = tps.getResultGeometry();
+
+    ensure("Simplified geometry is invalid!", simp->isValid());
+    ensure(simp->equalsExact(expected.get()));
+}
+
+} // namespace tut
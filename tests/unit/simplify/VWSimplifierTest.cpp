@@ -0,0 +1,224 @@
+//
+// Test Suite for geos::simplify::VWSimplifier
+
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Geometry.h>
+#include <geos/simplify/VWSimplifier.h>
+#include <geos/simplify/VWLineSimplifier.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace tut {
+using namespace geos::simplify;
+using geos::geom::Coordinate;
+
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_vwsimp_data {
+    geos::io::WKTReader wktreader;
+    geos::io::WKTWriter wktwriter;
+
+    typedef geos::geom::Geometry::Ptr GeomPtr;
+
+    test_vwsimp_data()
+        :
+        wktreader()
+    {
+        wktwriter.setTrim(true);
+    }
+
+    void
+    checkSimplify(const std::string& wkt, double tolerance, const std::string& wktExpected,
+                  bool isPreserveTopology = false)
+    {
+        GeomPtr g(wktreader.read(wkt));
+        VWSimplifier simp(g.get());
+        simp.setDistanceTolerance(tolerance);
+        simp.setPreserveTopology(isPreserveTopology);
+        GeomPtr result = simp.getResultGeometry();
+
+        ensure("Simplified geometry is invalid!", result->isValid());
+        ensure_equals(wktwriter.write(result.get()), wktExpected);
+    }
+
+    /*
+     * The straightforward O(n^2) algorithm,
+     * which repeatedly scans for the vertex with the smallest area.
+     */
+    static std::vector<Coordinate>
+    simplifyNaive(std::vector<Coordinate> pts, double tolerance)
+    {
+        auto area = [&pts](std::size_t i) {
+            const Coordinate& a = pts[i - 1];
+            const Coordinate& b = pts[i];
+            const Coordinate& c = pts[i + 1];
+            return std::fabs((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) / 2.0;
+        };
+        for(;;) {
+            std::size_t minIndex = 0;
+            double minArea = tolerance * tolerance;
+            for(std::size_t i = 1; i + 1 < pts.size(); i++) {
+                if(area(i) < minArea) {
+                    minArea = area(i);
+                    minIndex = i;
+                }
+            }
+            if(minIndex == 0) {
+                return pts;
+            }
+            pts.erase(pts.begin() + static_cast<long>(minIndex));
+        }
+    }
+};
+
+typedef test_group<test_vwsimp_data> group;
+typedef group::object object;
+
+group test_vwsimp_group("geos::simplify::VWSimplifier");
+
+//
+// Test Cases
+//
+
+// EmptyPolygon
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkSimplify("POLYGON EMPTY", 1, "POLYGON EMPTY");
+}
+
+// Point
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkSimplify("POINT (10 10)", 10, "POINT (10 10)");
+}
+
+// Collinear vertices are removed
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkSimplify("POLYGON ((20 220, 40 220, 60 220, 80 220, 100 220, 120 220, 140 220, 140 180, 100 180, 60 180, 20 180, 20 220))",
+                  10,
+                  "POLYGON ((20 220, 140 220, 140 180, 20 180, 20 220))");
+}
+
+// Areas are updated after each removal
+template<>
+template<>
+void object::test<4>
+()
+{
+    checkSimplify("LINESTRING (0 0, 10 1, 20 0, 30 5, 40 0)", 3,
+                  "LINESTRING (0 0, 10 1, 20 0, 30 5, 40 0)");
+    checkSimplify("LINESTRING (0 0, 10 1, 20 0, 30 5, 40 0)", 4,
+                  "LINESTRING (0 0, 20 0, 30 5, 40 0)");
+    checkSimplify("LINESTRING (0 0, 10 1, 20 0, 30 5, 40 0)", 10,
+                  "LINESTRING (0 0, 30 5, 40 0)");
+    checkSimplify("LINESTRING (0 0, 10 1, 20 0, 30 5, 40 0)", 11,
+                  "LINESTRING (0 0, 40 0)");
+}
+
+// Collapsed polygon is removed
+template<>
+template<>
+void object::test<5>
+()
+{
+    checkSimplify("POLYGON ((0 0, 0 1, 1 1, 1 0, 0 0))", 10, "POLYGON EMPTY");
+}
+
+// Topology preserving rings keep 4 points
+template<>
+template<>
+void object::test<6>
+()
+{
+    checkSimplify("POLYGON ((0 0, 0 1, 1 1, 1 0, 0 0))", 10,
+                  "POLYGON ((0 0, 1 1, 1 0, 0 0))", true);
+}
+
+// Topology preserving simplification does not cross other lines
+template<>
+template<>
+void object::test<7>
+()
+{
+    std::string wkt("MULTILINESTRING ((0 0, 50 5, 100 0), (50 -2, 50 2))");
+    checkSimplify(wkt, 20, "MULTILINESTRING ((0 0, 100 0), (50 -2, 50 2))");
+    checkSimplify(wkt, 20, "MULTILINESTRING ((0 0, 50 5, 100 0), (50 -2, 50 2))", true);
+}
+
+// Topology preserving simplification does not cross a hole
+template<>
+template<>
+void object::test<8>
+()
+{
+    std::string wkt("POLYGON ((0 0, 0 100, 50 102, 100 100, 100 0, 0 0), (40 90, 60 90, 50 101, 40 90))");
+    checkSimplify(wkt, 20,
+                  "POLYGON ((0 0, 0 100, 50 102, 100 100, 100 0, 0 0), (40 90, 60 90, 50 101, 40 90))",
+                  true);
+}
+
+// Heap order gives the same result as the naive algorithm
+template<>
+template<>
+void object::test<9>
+()
+{
+    std::vector<Coordinate> pts;
+    uint32_t seed = 12345;
+    for(int i = 0; i < 1000; i++) {
+        seed = seed * 1103515245 + 12345;
+        double noise = static_cast<double>((seed >> 16) % 1000) / 100.0;
+        // integer coordinates give many equal areas
+        pts.emplace_back(i, std::floor(20 * std::sin(i * 0.05) + noise));
+    }
+
+    for(double tolerance : {0.5, 1.0, 3.0, 10.0}) {
+        auto result = VWLineSimplifier::simplify(pts, tolerance);
+        auto expected = simplifyNaive(pts, tolerance);
+        ensure_equals(result->size(), expected.size());
+        for(std::size_t i = 0; i < expected.size(); i++) {
+            ensure_equals(result->at(i), expected[i]);
+        }
+    }
+}
+
+// Negative tolerance is invalid
+template<>
+template<>
+void object::test<10>
+()
+{
+    GeomPtr g(wktreader.read("LINESTRING (0 0, 1 1)"));
+    VWSimplifier simp(g.get());
+    try {
+        simp.setDistanceTolerance(-1);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
+} // namespace tut
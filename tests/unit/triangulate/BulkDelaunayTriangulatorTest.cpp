@@ -0,0 +1,268 @@
+//
+// Test Suite for geos::triangulate::BulkDelaunayTriangulator
+//
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/triangulate/BulkDelaunayTriangulator.h>
+#include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/VoronoiDiagramBuilder.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/Point.h>
+
+#include <random>
+
+using namespace geos::triangulate;
+using namespace geos::geom;
+using namespace geos::io;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_bulkdelaunay_data {
+    WKTReader reader;
+    GeometryFactory::Ptr geomFact;
+
+    test_bulkdelaunay_data()
+        : geomFact(GeometryFactory::create())
+    {}
+
+    std::unique_ptr<Geometry>
+    randomSites(std::size_t n)
+    {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<double> dist(0, 100);
+        CoordinateArraySequence seq;
+        for (std::size_t i = 0; i < n; i++) {
+            seq.add(Coordinate(dist(rng), dist(rng)));
+        }
+        return std::unique_ptr<Geometry>(geomFact->createMultiPoint(seq));
+    }
+
+    std::unique_ptr<Geometry>
+    gridSites(std::size_t n)
+    {
+        CoordinateArraySequence seq;
+        for (std::size_t i = 0; i < n; i++) {
+            for (std::size_t j = 0; j < n; j++) {
+                seq.add(Coordinate(double(i), double(j)));
+            }
+        }
+        return std::unique_ptr<Geometry>(geomFact->createMultiPoint(seq));
+    }
+
+    std::unique_ptr<Geometry>
+    triangles(const Geometry& sites, bool isBulk, double tolerance = 0.0)
+    {
+        DelaunayTriangulationBuilder builder;
+        builder.setTolerance(tolerance);
+        builder.setSites(sites);
+        builder.setBulk(isBulk);
+        std::unique_ptr<Geometry> result = builder.getTriangles(*geomFact);
+        result->normalize();
+        return result;
+    }
+
+    void
+    checkSameAsIncremental(const Geometry& sites, double tolerance = 0.0)
+    {
+        auto expected = triangles(sites, false, tolerance);
+        auto actual = triangles(sites, true, tolerance);
+        ensure(actual->toString(), actual->equalsExact(expected.get()));
+    }
+
+    void
+    checkSameDiagram(const Geometry& sites)
+    {
+        VoronoiDiagramBuilder expectedBuilder;
+        expectedBuilder.setSites(sites);
+        expectedBuilder.setBulk(false);
+        auto expected = expectedBuilder.getDiagram(*geomFact);
+
+        VoronoiDiagramBuilder actualBuilder;
+        actualBuilder.setSites(sites);
+        actualBuilder.setBulk(true);
+        auto actual = actualBuilder.getDiagram(*geomFact);
+
+        ensure_equals(actual->getNumGeometries(), expected->getNumGeometries());
+        ensure_distance(actual->getArea(), expected->getArea(), 1e-6);
+
+        auto expectedEdges = expectedBuilder.getDiagramEdges(*geomFact);
+        auto actualEdges = actualBuilder.getDiagramEdges(*geomFact);
+        ensure_distance(actualEdges->getLength(), expectedEdges->getLength(), 1e-6);
+    }
+};
+
+typedef test_group<test_bulkdelaunay_data> group;
+typedef group::object object;
+
+group test_bulkdelaunay_group("geos::triangulate::BulkDelaunayTriangulator");
+
+//
+// Test Cases
+//
+
+// Simple triangulations are the same as the incremental engine
+// (for sites which are not cocircular)
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkSameAsIncremental(*reader.read("MULTIPOINT ((10 10), (10 20), (20 20))"));
+    checkSameAsIncremental(*reader.read("MULTIPOINT ((10 10), (10 20), (20 20), (20 0), (0 0), (5 12))"));
+}
+
+// Random sites give the same triangulation as the incremental engine
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkSameAsIncremental(*randomSites(2000));
+}
+
+// Cocircular grid sites: diagonals may differ, but the triangles cover the hull
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto sites = gridSites(30);
+    auto expected = triangles(*sites, false);
+    auto actual = triangles(*sites, true);
+
+    ensure_equals(actual->getNumGeometries(), expected->getNumGeometries());
+    ensure_distance(actual->getArea(), 29.0 * 29.0, 1e-9);
+}
+
+// Degenerate inputs
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto empty = triangles(*reader.read("MULTIPOINT EMPTY"), true);
+    ensure(empty->isEmpty());
+
+    auto single = triangles(*reader.read("POINT (1 1)"), true);
+    ensure(single->isEmpty());
+
+    DelaunayTriangulationBuilder builder;
+    builder.setSites(*reader.read("MULTIPOINT ((0 0), (1 1), (2 2), (3 3))"));
+    builder.setBulk(true);
+    ensure(builder.getTriangles(*geomFact)->isEmpty());
+    ensure_equals(builder.getEdges(*geomFact)->getNumGeometries(), 3u);
+}
+
+// Sites within the tolerance are merged
+template<>
+template<>
+void object::test<5>
+()
+{
+    auto sites = reader.read("MULTIPOINT ((0 0), (1 0), (0 1), (1.0000001 0), (0 1.0000001))");
+    auto tris = triangles(*sites, true, 0.001);
+    ensure_equals(tris->getNumGeometries(), 1u);
+    ensure_distance(tris->getArea(), 0.5, 1e-6);
+}
+
+// The half-edge structure is consistent
+template<>
+template<>
+void object::test<6>
+()
+{
+    auto sites = randomSites(500);
+    auto coords = sites->getCoordinates();
+    BulkDelaunayTriangulator triangulator(*coords);
+    triangulator.triangulate();
+
+    const auto& tri = triangulator.getTriangleVertexIndexes();
+    const auto& half = triangulator.getHalfEdges();
+    ensure_equals(triangulator.getVertices().size(), 503u);
+    // Euler: 2n + 1 triangles for n sites inside a frame triangle
+    ensure_equals(triangulator.getNumTriangles(), 2 * 500u + 1);
+
+    for (std::size_t e = 0; e < half.size(); e++) {
+        std::size_t opp = half[e];
+        if (opp == BulkDelaunayTriangulator::NONE) {
+            // only frame edges are unmatched
+            ensure(tri[e] < 3);
+            continue;
+        }
+        ensure_equals(half[opp], e);
+        // opposite half-edges run in opposite directions
+        std::size_t eNext = (e % 3 == 2) ? e - 2 : e + 1;
+        std::size_t oppNext = (opp % 3 == 2) ? opp - 2 : opp + 1;
+        ensure_equals(tri[opp], tri[eNext]);
+        ensure_equals(tri[oppNext], tri[e]);
+    }
+}
+
+// Voronoi diagrams are the same as with the incremental engine
+template<>
+template<>
+void object::test<7>
+()
+{
+    checkSameDiagram(*reader.read("MULTIPOINT ((150 200), (180 270), (275 163))"));
+    checkSameDiagram(*randomSites(1000));
+}
+
+// Voronoi cells are returned for every site
+template<>
+template<>
+void object::test<8>
+()
+{
+    auto sites = randomSites(200);
+    auto coords = sites->getCoordinates();
+    BulkDelaunayTriangulator triangulator(*coords);
+    triangulator.triangulate();
+
+    auto cells = triangulator.getVoronoiCellPolygons(*geomFact);
+    ensure_equals(cells.size(), 200u);
+    for (const auto& cell : cells) {
+        ensure(cell->isValid());
+        // the user data is the site of the cell
+        const Coordinate* site = static_cast<const Coordinate*>(cell->getUserData());
+        ensure(site != nullptr);
+        std::unique_ptr<Point> sitePt(geomFact->createPoint(*site));
+        ensure(cell->covers(sitePt.get()));
+    }
+}
+
+// The builders use the bulk triangulator by default for many sites
+template<>
+template<>
+void object::test<9>
+()
+{
+    auto sites = randomSites(BulkDelaunayTriangulator::DEFAULT_MIN_SITES);
+
+    DelaunayTriangulationBuilder builder;
+    builder.setSites(*sites);
+    std::unique_ptr<Geometry> actual = builder.getTriangles(*geomFact);
+    actual->normalize();
+    auto expected = triangles(*sites, true);
+    ensure(actual->equalsExact(expected.get()));
+
+    VoronoiDiagramBuilder defaultBuilder;
+    defaultBuilder.setSites(*sites);
+    VoronoiDiagramBuilder bulkBuilder;
+    bulkBuilder.setSites(*sites);
+    bulkBuilder.setBulk(true);
+    auto defaultDiagram = defaultBuilder.getDiagram(*geomFact);
+    auto bulkDiagram = bulkBuilder.getDiagram(*geomFact);
+    ensure(defaultDiagram->equalsExact(bulkDiagram.get()));
+}
+
+} // namespace tut
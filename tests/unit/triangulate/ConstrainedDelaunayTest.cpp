@@ -0,0 +1,210 @@
+//
+// Test Suite for geos::triangulate::ConstrainedDelaunayTriangulationBuilder
+//
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/triangulate/ConstrainedDelaunayTriangulationBuilder.h>
+#include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/Polygon.h>
+// std
+#include <cmath>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+using namespace geos::triangulate;
+using namespace geos::geom;
+using namespace geos::io;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_constraineddelaunay_data {
+    WKTReader reader;
+    const GeometryFactory& geomFact;
+
+    test_constraineddelaunay_data()
+        : geomFact(*GeometryFactory::getDefaultInstance())
+    {}
+
+    std::unique_ptr<GeometryCollection>
+    triangulate(const Geometry& geom)
+    {
+        ConstrainedDelaunayTriangulationBuilder builder;
+        builder.setConstraints(geom);
+        return builder.getTriangles(geomFact);
+    }
+
+    // checks that the triangles exactly cover a polygonal geometry
+    void
+    checkPolygonTriangles(const char* wkt, std::size_t expectedNumTriangles)
+    {
+        auto geom = reader.read(wkt);
+        auto tris = triangulate(*geom);
+        ensure_equals(tris->getNumGeometries(), expectedNumTriangles);
+        ensure_distance(tris->getArea(), geom->getArea(), 1e-9 * geom->getArea());
+        for (std::size_t i = 0; i < tris->getNumGeometries(); i++) {
+            ensure(geom->covers(tris->getGeometryN(i)));
+        }
+    }
+};
+
+typedef test_group<test_constraineddelaunay_data> group;
+typedef group::object object;
+
+group test_constraineddelaunay_group("geos::triangulate::ConstrainedDelaunay");
+
+//
+// Test Cases
+//
+
+// Square
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkPolygonTriangles("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))", 2);
+}
+
+// Concave polygon, whose Delaunay triangulation has an edge outside it
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkPolygonTriangles("POLYGON ((0 0, 10 0, 10 10, 5 2, 0 10, 0 0))", 3);
+}
+
+// Polygon with holes: n + 2h - 2 triangles
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkPolygonTriangles("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 1 4, 4 4, 4 1, 1 1), (6 6, 6 9, 9 9, 9 6, 6 6))", 14);
+}
+
+// Adjacent polygons: the shared edge is not a boundary
+template<>
+template<>
+void object::test<4>
+()
+{
+    checkPolygonTriangles("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((10 0, 20 0, 20 10, 10 10, 10 0)))", 4);
+}
+
+// Collinear vertices are kept
+template<>
+template<>
+void object::test<5>
+()
+{
+    checkPolygonTriangles("POLYGON ((0 0, 10 0, 20 0, 20 10, 10 10, 0 10, 0 0))", 4);
+}
+
+// Constraint lines appear as edges, and crossing lines are noded
+template<>
+template<>
+void object::test<6>
+()
+{
+    auto geom = reader.read("GEOMETRYCOLLECTION (MULTIPOINT ((0 0), (10 0), (10 10), (0 10), (3 7)), LINESTRING (1 1, 9 9), LINESTRING (1 9, 9 1))");
+    ConstrainedDelaunayTriangulationBuilder builder;
+    builder.setConstraints(*geom);
+    auto edges = builder.getEdges(geomFact);
+    ensure(edges->covers(geom->getGeometryN(1)));
+    ensure(edges->covers(geom->getGeometryN(2)));
+
+    auto tris = builder.getTriangles(geomFact);
+    ensure_distance(tris->getArea(), 100.0, 1e-9);
+    auto node = reader.read("POINT (5 5)");
+    ensure(edges->covers(node.get()));
+}
+
+// A breakline which is not a Delaunay edge
+template<>
+template<>
+void object::test<7>
+()
+{
+    auto sites = reader.read("MULTIPOINT ((0 0), (10 1), (20 0), (10 -1))");
+    auto line = reader.read("LINESTRING (0 0, 20 0)");
+
+    DelaunayTriangulationBuilder dtBuilder;
+    dtBuilder.setSites(*sites);
+    ensure(! dtBuilder.getEdges(geomFact)->covers(line.get()));
+
+    ConstrainedDelaunayTriangulationBuilder builder;
+    builder.setSites(*sites);
+    builder.setConstraints(*line);
+    ensure(builder.getEdges(geomFact)->covers(line.get()));
+    ensure_equals(builder.getTriangles(geomFact)->getNumGeometries(), 2u);
+}
+
+// Large star-shaped polygon, with many constraints crossing Delaunay edges
+template<>
+template<>
+void object::test<8>
+()
+{
+    CoordinateArraySequence pts;
+    std::size_t n = 2000;
+    for (std::size_t i = 0; i < n; i++) {
+        double a = 2 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        double r = (i % 2 == 0) ? 1.0 : 0.3 + 0.2 * std::sin(a * 7);
+        pts.add(Coordinate(r * std::cos(a), r * std::sin(a)));
+    }
+    pts.add(pts.getAt(0));
+    auto poly = geomFact.createPolygon(geomFact.createLinearRing(pts.clone()));
+    ensure(poly->isValid());
+
+    auto tris = triangulate(*poly);
+    ensure_equals(tris->getNumGeometries(), n - 2);
+    ensure_distance(tris->getArea(), poly->getArea(), 1e-9);
+    auto u = tris->Union();
+    ensure(u->symDifference(poly.get())->getArea() < 1e-9);
+}
+
+// Empty input
+template<>
+template<>
+void object::test<9>
+()
+{
+    auto geom = reader.read("POLYGON EMPTY");
+    auto tris = triangulate(*geom);
+    ensure(tris->isEmpty());
+}
+
+// Cocircular vertices, exactly on a grid and nearly on a circle
+template<>
+template<>
+void object::test<10>
+()
+{
+    checkPolygonTriangles("POLYGON ((0 0, 1 0, 2 0, 3 0, 4 0, 4 1, 4 2, 4 3, 4 4, "
+                          "3 4, 2 4, 1 4, 0 4, 0 3, 0 2, 0 1, 0 0))", 14);
+
+    std::ostringstream wkt;
+    wkt << std::setprecision(17) << "POLYGON ((";
+    const std::size_t n = 64;
+    for (std::size_t i = 0; i <= n; i++) {
+        double angle = 2 * M_PI * static_cast<double>(i % n) / static_cast<double>(n);
+        wkt << (i ? ", " : "") << 1000 * std::cos(angle) << " " << 1000 * std::sin(angle);
+    }
+    wkt << "))";
+    checkPolygonTriangles(wkt.str().c_str(), n - 2);
+}
+
+} // namespace tut
@@ -257,4 +257,29 @@ void object::test<12>
     }
 }
 
+// 13 - Hilbert insertion order gives the same triangulation
+template<>
+template<>
+void object::test<13>
+()
+{
+    WKTReader reader;
+    auto sites = reader.read(
+        "MULTIPOINT ((10 10), (10 20), (20 20), (20 0), (0 0), (5 12), (17 3), (8 31), (25 14), (3 22))");
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+
+    DelaunayTriangulationBuilder lexBuilder;
+    lexBuilder.setSites(*sites);
+    auto expected = lexBuilder.getTriangles(geomFact);
+    expected->normalize();
+
+    DelaunayTriangulationBuilder hilbertBuilder;
+    hilbertBuilder.setSites(*sites);
+    hilbertBuilder.setHilbertOrder(true);
+    auto result = hilbertBuilder.getTriangles(geomFact);
+    result->normalize();
+
+    ensure(result->toString(), result->equalsExact(expected.get()));
+}
+
 } // namespace tut
@@ -0,0 +1,194 @@
+//
+// Test Suite for geos::triangulate::polygon::PolygonTriangulator
+//
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/triangulate/polygon/PolygonTriangulator.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+// std
+#include <cmath>
+#include <memory>
+
+using geos::triangulate::polygon::PolygonTriangulator;
+using namespace geos::geom;
+using namespace geos::io;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_polygontriangulator_data {
+    WKTReader reader;
+    const GeometryFactory& geomFact;
+
+    test_polygontriangulator_data()
+        : geomFact(*GeometryFactory::getDefaultInstance())
+    {}
+
+    // checks that the triangles exactly cover a polygonal geometry
+    void
+    checkTriangulation(const Geometry& geom, std::size_t expectedNumTriangles, bool isUnionChecked = true)
+    {
+        auto tris = PolygonTriangulator::triangulate(&geom);
+        ensure_equals(tris->getNumGeometries(), expectedNumTriangles);
+        ensure_distance(tris->getArea(), geom.getArea(), 1e-9 * geom.getArea());
+        if (isUnionChecked) {
+            auto u = tris->Union();
+            ensure(u->symDifference(&geom)->getArea() <= 1e-9 * geom.getArea());
+        }
+    }
+
+    void
+    checkTriangulation(const char* wkt, std::size_t expectedNumTriangles)
+    {
+        auto geom = reader.read(wkt);
+        checkTriangulation(*geom, expectedNumTriangles);
+    }
+};
+
+typedef test_group<test_polygontriangulator_data> group;
+typedef group::object object;
+
+group test_polygontriangulator_group("geos::triangulate::polygon::PolygonTriangulator");
+
+//
+// Test Cases
+//
+
+// Square
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkTriangulation("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))", 2);
+}
+
+// Concave polygon, in clockwise order
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkTriangulation("POLYGON ((0 0, 0 10, 5 2, 10 10, 10 0, 0 0))", 3);
+}
+
+// Polygon with holes: n + 2h - 2 triangles
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkTriangulation("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 1 4, 4 4, 4 1, 1 1), (6 6, 6 9, 9 9, 9 6, 6 6), (6 1, 6 4, 9 4, 9 1, 6 1))", 20);
+}
+
+// Hole touching the shell
+template<>
+template<>
+void object::test<4>
+()
+{
+    checkTriangulation("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (0 5, 5 8, 5 2, 0 5))", 6);
+}
+
+// Holes touching at a vertex
+template<>
+template<>
+void object::test<5>
+()
+{
+    checkTriangulation("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (5 5, 6 5, 6 6, 5 6, 5 5), (6 6, 7 6, 7 7, 6 7, 6 6))", 12);
+}
+
+// MultiPolygon, with a repeated point and a collinear vertex
+template<>
+template<>
+void object::test<6>
+()
+{
+    checkTriangulation("MULTIPOLYGON (((0 0, 10 0, 10 0, 10 10, 0 10, 0 0)), ((20 0, 30 0, 40 0, 40 10, 20 10, 20 0)))", 5);
+}
+
+// Z values are preserved
+template<>
+template<>
+void object::test<7>
+()
+{
+    auto geom = reader.read("POLYGON Z ((0 0 1, 10 0 2, 10 10 3, 0 10 4, 0 0 1))");
+    auto tris = PolygonTriangulator::triangulate(geom.get());
+    ensure_equals(tris->getNumGeometries(), 2u);
+    for (std::size_t i = 0; i < tris->getNumGeometries(); i++) {
+        auto coords = tris->getGeometryN(i)->getCoordinates();
+        for (std::size_t j = 0; j < coords->size(); j++) {
+            const Coordinate& c = coords->getAt(j);
+            double expectedZ = c.x == 0 ? (c.y == 0 ? 1 : 4) : (c.y == 0 ? 2 : 3);
+            ensure_equals(c.z, expectedZ);
+        }
+    }
+}
+
+// Large polygon with long concave stretches, using the z-order index
+template<>
+template<>
+void object::test<8>
+()
+{
+    CoordinateArraySequence pts;
+    std::size_t n = 20000;
+    for (std::size_t i = 0; i < n; i++) {
+        double a = 2 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        double r = 1.0 + 0.1 * std::sin(a * 20);
+        pts.add(Coordinate(r * std::cos(a), r * std::sin(a)));
+    }
+    pts.add(pts.getAt(0));
+    auto poly = geomFact.createPolygon(geomFact.createLinearRing(pts.clone()));
+    checkTriangulation(*poly, n - 2, false);
+}
+
+// Large polygon with many holes
+template<>
+template<>
+void object::test<9>
+()
+{
+    auto shell = geomFact.createLinearRing(reader.read("LINEARRING (0 0, 105 0, 105 105, 0 105, 0 0)")->getCoordinates());
+    std::vector<LinearRing*>* holes = new std::vector<LinearRing*>();
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            double x = i * 5 + 1;
+            double y = j * 5 + 1 + (i % 2);
+            CoordinateArraySequence h;
+            h.add(Coordinate(x, y));
+            h.add(Coordinate(x, y + 2));
+            h.add(Coordinate(x + 1, y + 3));
+            h.add(Coordinate(x + 2, y));
+            h.add(Coordinate(x, y));
+            holes->push_back(geomFact.createLinearRing(h));
+        }
+    }
+    std::unique_ptr<Polygon> poly(geomFact.createPolygon(shell.release(), holes));
+    ensure(poly->isValid());
+    checkTriangulation(*poly, 4 + 400 * 4 + 2 * 400 - 2);
+}
+
+// Empty and non-polygonal inputs
+template<>
+template<>
+void object::test<10>
+()
+{
+    auto tris = PolygonTriangulator::triangulate(reader.read("POLYGON EMPTY").get());
+    ensure(tris->isEmpty());
+    tris = PolygonTriangulator::triangulate(reader.read("LINESTRING (0 0, 1 1)").get());
+    ensure(tris->isEmpty());
+}
+
+} // namespace tut
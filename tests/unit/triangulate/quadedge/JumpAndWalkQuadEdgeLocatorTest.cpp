@@ -0,0 +1,133 @@
+//
+// Test Suite for geos::triangulate::quadedge::JumpAndWalkQuadEdgeLocator
+//
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/triangulate/quadedge/JumpAndWalkQuadEdgeLocator.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+
+#include <random>
+
+using namespace geos::triangulate;
+using namespace geos::triangulate::quadedge;
+using namespace geos::geom;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_jumpandwalklocator_data {
+    GeometryFactory::Ptr geomFact;
+    CoordinateArraySequence sites;
+
+    test_jumpandwalklocator_data()
+        : geomFact(GeometryFactory::create())
+    {
+        std::mt19937 rng(4321);
+        std::uniform_real_distribution<double> dist(0, 100);
+        for (std::size_t i = 0; i < 5000; i++) {
+            sites.add(Coordinate(dist(rng), dist(rng)));
+        }
+    }
+
+    std::unique_ptr<Geometry>
+    triangulate(bool isHilbertOrder, std::size_t& locateCount, std::size_t& stepCount, std::size_t& restartCount)
+    {
+        auto vertices = DelaunayTriangulationBuilder::toVertices(sites);
+        DelaunayTriangulationBuilder::sortVertices(vertices, isHilbertOrder);
+
+        Envelope env = sites.getEnvelope();
+        QuadEdgeSubdivision subdiv(env, 0.0);
+        auto locator = new JumpAndWalkQuadEdgeLocator(&subdiv, env, vertices.size());
+        subdiv.setLocator(std::unique_ptr<QuadEdgeLocator>(locator));
+        IncrementalDelaunayTriangulator triangulator(&subdiv);
+        triangulator.insertSites(vertices);
+
+        locateCount = locator->getLocateCount();
+        stepCount = locator->getStepCount();
+        restartCount = locator->getRestartCount();
+
+        std::unique_ptr<Geometry> result = subdiv.getTriangles(*geomFact);
+        result->normalize();
+        return result;
+    }
+
+    std::unique_ptr<Geometry>
+    expectedTriangles()
+    {
+        DelaunayTriangulationBuilder builder;
+        builder.setSites(sites);
+        std::unique_ptr<Geometry> result = builder.getTriangles(*geomFact);
+        result->normalize();
+        return result;
+    }
+};
+
+typedef test_group<test_jumpandwalklocator_data> group;
+typedef group::object object;
+
+group test_jumpandwalklocator_group("geos::triangulate::quadedge::JumpAndWalkQuadEdgeLocator");
+
+//
+// Test Cases
+//
+
+// Hilbert order gives the same triangulation, with short walks
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::size_t locateCount, stepCount, restartCount;
+    auto result = triangulate(true, locateCount, stepCount, restartCount);
+
+    ensure(result->equalsExact(expectedTriangles().get()));
+    ensure_equals(locateCount, sites.size());
+    ensure_equals(restartCount, 0u);
+    ensure(stepCount < 10 * locateCount);
+}
+
+// Lexicographic order gives the same triangulation
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::size_t locateCount, stepCount, restartCount;
+    auto result = triangulate(false, locateCount, stepCount, restartCount);
+
+    ensure(result->equalsExact(expectedTriangles().get()));
+    ensure_equals(locateCount, sites.size());
+}
+
+// Locating in a degenerate extent
+template<>
+template<>
+void object::test<3>
+()
+{
+    Envelope env(0, 10, 5, 5);
+    QuadEdgeSubdivision subdiv(env, 0.0);
+    auto locator = new JumpAndWalkQuadEdgeLocator(&subdiv, env, 100);
+    subdiv.setLocator(std::unique_ptr<QuadEdgeLocator>(locator));
+    IncrementalDelaunayTriangulator triangulator(&subdiv);
+    for (int i = 0; i <= 10; i++) {
+        triangulator.insertSite(Vertex(i, 5));
+    }
+
+    ensure_equals(locator->getLocateCount(), 11u);
+    ensure(subdiv.getTriangles(*geomFact)->isEmpty());
+
+    locator->resetCounts();
+    ensure_equals(locator->getLocateCount(), 0u);
+    ensure_equals(locator->getStepCount(), 0u);
+}
+
+} // namespace tut
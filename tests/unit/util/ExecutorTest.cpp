@@ -0,0 +1,135 @@
+//
+// Test Suite for geos::util::Executor class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/util/Executor.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_executor_data {
+    typedef geos::util::Executor Executor;
+
+    // Checks that each item is processed exactly once
+    void
+    checkLoop(Executor& executor, std::size_t n, std::size_t grainSize, std::size_t maxThreads)
+    {
+        std::vector<int> counts(n, 0);
+        executor.parallelFor(n, grainSize, [&](std::size_t begin, std::size_t end) {
+            ensure("range is not empty", begin < end);
+            for(std::size_t i = begin; i < end; i++) {
+                counts[i]++;
+            }
+        }, maxThreads);
+        for(std::size_t i = 0; i < n; i++) {
+            ensure_equals(counts[i], 1);
+        }
+    }
+};
+
+typedef test_group<test_executor_data> group;
+typedef group::object object;
+
+group test_executor_group("geos::util::Executor");
+
+//
+// Test Cases
+//
+
+// Every item is processed once, whatever the number of threads and grain size
+template<>
+template<>
+void object::test<1>
+()
+{
+    for(std::size_t numThreads : {1, 2, 4, 7}) {
+        Executor executor(numThreads);
+        ensure_equals(executor.getNumThreads(), numThreads);
+        for(std::size_t n : {0, 1, 5, 100, 1000, 10007}) {
+            checkLoop(executor, n, 1, 0);
+            checkLoop(executor, n, 64, 0);
+            checkLoop(executor, n, 64, 2);
+        }
+    }
+
+    Executor hardware(0);
+    ensure_equals(hardware.getNumThreads(), Executor::getHardwareConcurrency());
+}
+
+// Small loops and single threads run in the calling thread
+template<>
+template<>
+void object::test<2>
+()
+{
+    Executor executor(4);
+    std::set<std::thread::id> ids;
+    std::mutex mutex;
+    auto recordThread = [&](std::size_t, std::size_t) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ids.insert(std::this_thread::get_id());
+    };
+
+    executor.parallelFor(100, 64, recordThread);
+    executor.parallelFor(10000, 64, recordThread, 1);
+    ensure_equals(ids.size(), 1u);
+    ensure(*ids.begin() == std::this_thread::get_id());
+}
+
+// The first exception is rethrown in the calling thread
+template<>
+template<>
+void object::test<3>
+()
+{
+    Executor executor(4);
+    std::atomic<std::size_t> processed(0);
+    try {
+        executor.parallelFor(10000, 10, [&](std::size_t begin, std::size_t end) {
+            if(begin <= 5000 && 5000 < end) {
+                throw geos::util::IllegalArgumentException("item 5000");
+            }
+            processed += end - begin;
+        });
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+    ensure(processed < 10000u);
+
+    // the executor is still usable
+    checkLoop(executor, 1000, 10, 0);
+}
+
+// Nested loops complete
+template<>
+template<>
+void object::test<4>
+()
+{
+    Executor executor(3);
+    std::atomic<std::size_t> total(0);
+    executor.parallelFor(16, 1, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; i++) {
+            executor.parallelFor(1000, 10, [&](std::size_t b, std::size_t e) {
+                total += e - b;
+            });
+        }
+    });
+    ensure_equals(total.load(), 16000u);
+}
+
+} // namespace tut
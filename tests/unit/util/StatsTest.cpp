@@ -0,0 +1,121 @@
+//
+// Test Suite for geos::util::Stats class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/util/Stats.h>
+#include <geos/geom/Geometry.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_stats_data {
+    typedef geos::util::Stats Stats;
+
+    geos::io::WKTReader reader_;
+
+    test_stats_data()
+    {
+        Stats::reset();
+    }
+
+    ~test_stats_data()
+    {
+        Stats::setEnabled(false);
+    }
+
+    void
+    runOverlay()
+    {
+        std::unique_ptr<geos::geom::Geometry> a(reader_.read("POLYGON ((0 0, 10 0, 10 10, 5 12, 0 10, 0 0))"));
+        std::unique_ptr<geos::geom::Geometry> b(reader_.read("POLYGON ((5 5, 15 5, 15 15, 5 5))"));
+        a->intersection(b.get());
+    }
+};
+
+typedef test_group<test_stats_data> group;
+typedef group::object object;
+
+group test_stats_group("geos::util::Stats");
+
+//
+// Test Cases
+//
+
+// Nothing is recorded when collection is off
+template<>
+template<>
+void object::test<1>
+()
+{
+    Stats::setEnabled(false);
+    runOverlay();
+    Stats::Snapshot snapshot = Stats::getSnapshot();
+    for(std::size_t i = 0; i < Stats::NUM_STAGES; i++) {
+        ensure_equals(snapshot.counts[i], 0u);
+        ensure_equals(snapshot.nanoseconds[i], 0u);
+    }
+}
+
+// Overlay stages are recorded, and reset
+template<>
+template<>
+void object::test<2>
+()
+{
+    ensure_not(Stats::setEnabled(true));
+    runOverlay();
+    runOverlay();
+    Stats::Snapshot snapshot = Stats::getSnapshot();
+    ensure_equals(snapshot.counts[Stats::NODING], 2u);
+    ensure_equals(snapshot.counts[Stats::GRAPH_BUILD], 2u);
+    ensure_equals(snapshot.counts[Stats::LABELLING], 2u);
+    ensure_equals(snapshot.counts[Stats::RING_BUILDING], 2u);
+    ensure_equals(snapshot.counts[Stats::ROBUSTNESS_RETRY], 0u);
+
+    Stats::reset();
+    snapshot = Stats::getSnapshot();
+    ensure_equals(snapshot.counts[Stats::NODING], 0u);
+    ensure_equals(snapshot.nanoseconds[Stats::NODING], 0u);
+}
+
+// Counters of other threads are included, after they finish
+template<>
+template<>
+void object::test<3>
+()
+{
+    Stats::setEnabled(true);
+    std::thread t1([]() {
+        Stats::count(Stats::INDEX_QUERY);
+    });
+    std::thread t2([]() {
+        Stats::count(Stats::INDEX_QUERY);
+        Stats::count(Stats::INDEX_QUERY);
+    });
+    t1.join();
+    t2.join();
+    Stats::count(Stats::INDEX_QUERY);
+    ensure_equals(Stats::getSnapshot().counts[Stats::INDEX_QUERY], 4u);
+}
+
+// Stage names
+template<>
+template<>
+void object::test<4>
+()
+{
+    ensure_equals(std::string(Stats::getStageName(Stats::NODING)), "noding");
+    ensure_equals(std::string(Stats::getStageName(Stats::ROBUSTNESS_RETRY)), "robustness retry");
+}
+
+} // namespace tut
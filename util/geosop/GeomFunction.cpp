@@ -35,12 +35,16 @@
 #include <geos/operation/relate/RelateOp.h>
 #include <geos/operation/valid/MakeValid.h>
 #include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/CoverageUnion.h>
 #include <geos/operation/polygonize/Polygonizer.h>
 #include <geos/precision/GeometryPrecisionReducer.h>
 #include <geos/simplify/DouglasPeuckerSimplifier.h>
 #include <geos/simplify/TopologyPreservingSimplifier.h>
+#include <geos/simplify/VWSimplifier.h>
+#include <geos/triangulate/ConstrainedDelaunayTriangulationBuilder.h>
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
 #include <geos/triangulate/VoronoiDiagramBuilder.h>
+#include <geos/triangulate/polygon/PolygonTriangulator.h>
 
 #include "GeomFunction.h"
 
@@ -249,6 +253,21 @@ GeomFunction::init()
             return new Result( std::move(geoms) ) ;
         });
 
+    add("constrainedDelaunay", "computes the Constrained Delaunay Triangulation of geometry A", 1, 0,
+        [](const std::unique_ptr<Geometry>& geom, const std::unique_ptr<Geometry>& geomB, double d)->Result* {
+            (void) geomB; (void)d;  // prevent unused variable warning
+            geos::triangulate::ConstrainedDelaunayTriangulationBuilder builder;
+            builder.setConstraints( *geom );
+            std::unique_ptr<Geometry> out = builder.getTriangles(*(geom->getFactory()));
+            return new Result( std::move(out) );
+        });
+
+    add("triangulatePolygon", "computes a triangulation of the polygons of geometry A by ear clipping", 1, 0,
+        [](const std::unique_ptr<Geometry>& geom, const std::unique_ptr<Geometry>& geomB, double d)->Result* {
+            (void) geomB; (void)d;  // prevent unused variable warning
+            return new Result( geos::triangulate::polygon::PolygonTriangulator::triangulate(geom.get()) );
+        });
+
     add("voronoi", "computes the Voronoi Diagram of geometry A vertices", 1, 0,
         [](const std::unique_ptr<Geometry>& geom, const std::unique_ptr<Geometry>& geomB, double d)->Result* {
             (void) geomB; (void)d;  // prevent unused variable warning
@@ -306,6 +325,19 @@ GeomFunction::init()
             (void)geomB;  // prevent unused variable warning
             return new Result( geos::simplify::TopologyPreservingSimplifier::simplify(geom.get(), d) );
          });
+    add("simplifyVW", "simplifies geometry A using Visvalingam-Whyatt with a distance tolerance", 1, 1,
+        [](const std::unique_ptr<Geometry>& geom, const std::unique_ptr<Geometry>& geomB, double d)->Result* {
+            (void)geomB;  // prevent unused variable warning
+            return new Result( geos::simplify::VWSimplifier::simplify(geom.get(), d) );
+         });
+    add("simplifyVWTP", "simplifies geometry A using Visvalingam-Whyatt with a distance tolerance, preserving topology", 1, 1,
+        [](const std::unique_ptr<Geometry>& geom, const std::unique_ptr<Geometry>& geomB, double d)->Result* {
+            (void)geomB;  // prevent unused variable warning
+            geos::simplify::VWSimplifier simp(geom.get());
+            simp.setDistanceTolerance(d);
+            simp.setPreserveTopology(true);
+            return new Result( simp.getResultGeometry() );
+         });
 
 
     add("containsPrep", "tests if geometry A contains geometry B, using PreparedGeometry", 2, 0,
@@ -365,6 +397,11 @@ GeomFunction::init()
             (void)geomB; (void)d;  // prevent unused variable warning
             return new Result( geom->Union() );
         });
+    add("coverageUnion", "computes union of a polygonal coverage", 1, 0,
+        [](const std::unique_ptr<Geometry>& geom, const std::unique_ptr<Geometry>& geomB, double d)->Result* {
+            (void)geomB; (void)d;  // prevent unused variable warning
+            return new Result( geos::operation::overlayng::CoverageUnion::geomunion(geom.get()) );
+        });
     add("union", "computes union of geometry A and B", 2, 0,
         [](const std::unique_ptr<Geometry>& geom, const std::unique_ptr<Geometry>& geomB, double d)->Result* {
             (void)d;  // prevent unused variable warning